@@ -0,0 +1,257 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <memory>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "InstrumentedComponents.hpp"
+#include "SyntheticSpecs.hpp"
+
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+using namespace tcframe;
+
+/*
+ * End-to-end benchmark of test case generation.
+ *
+ * Each scenario assembles the same components as Runner::generate(), with instrumented versions of them, and runs
+ * the whole Generator::generate() pipeline against a trivial local solution. Each scenario runs in its own process,
+ * so that the reported peak RSS belongs to that scenario only.
+ *
+ * The soak scenario generates the same test suite several times in a row, and fails if the number of open file
+ * descriptors or the resident set size keeps growing after the first two rounds, which warm up the heap.
+ *
+ * The test cases are generated into a temporary directory, which is removed afterwards.
+ *
+ * Usage: ./generation_benchmark [--verbose] [scenario...]
+ */
+
+static const int SOAK_ROUNDS = 4;
+static const int SOAK_WARMUP_ROUNDS = 2;
+static const long SOAK_RSS_GROWTH_TOLERANCE_IN_KILOBYTES = 1024;
+
+int openFileDescriptorsCount() {
+    int count = 0;
+    DIR* dir = opendir("/proc/self/fd");
+    if (dir == nullptr) {
+        return -1;
+    }
+    while (readdir(dir) != nullptr) {
+        count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+long currentRssInKilobytes() {
+    long pages = 0;
+    long residentPages = 0;
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (statm == nullptr) {
+        return -1;
+    }
+    if (fscanf(statm, "%ld %ld", &pages, &residentPages) != 2) {
+        residentPages = -1;
+    }
+    fclose(statm);
+    return residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+struct Scenario {
+    string name;
+    int testCasesCount;
+    bool (*run)(const string& tcDir, LoggerEngine* loggerEngine, StageTimings* timings);
+};
+
+template<typename TProblemSpec>
+bool runPipeline(
+        BaseTestSpec<TProblemSpec>* testSpec,
+        const string& solutionCommand,
+        const string& tcDir,
+        LoggerEngine* loggerEngine,
+        StageTimings* timings) {
+
+    Stopwatch totalStopwatch;
+
+    // The components are released after each run, so that the soak scenario only sees what generation leaks.
+    unique_ptr<BaseTestSpec<TProblemSpec>> ownedTestSpec(testSpec);
+
+    Stopwatch specStopwatch;
+    CoreSpec coreSpec = testSpec->buildCoreSpec();
+    timings->spec += specStopwatch.elapsedSeconds();
+
+    const ProblemConfig& problemConfig = coreSpec.problemConfig();
+    GeneratorConfig config = GeneratorConfigBuilder()
+            .setMultipleTestCasesCount(problemConfig.multipleTestCasesCount().value_or(nullptr))
+            .setSlug(problemConfig.slug().value_or(DefaultValues::slug()))
+            .setSolutionCommand(solutionCommand)
+            .setTestCasesDir(tcDir)
+            .build();
+
+    InstrumentedOperatingSystem os(timings);
+    InstrumentedIOManipulator ioManipulator(coreSpec.ioFormat(), timings);
+    InstrumentedVerifier verifier(coreSpec.constraintSuite(), timings);
+    GeneratorLogger logger(loggerEngine);
+    InstrumentedTestCaseGenerator testCaseGenerator(&verifier, &ioManipulator, &os, &logger, timings);
+    Generator generator(&testCaseGenerator, &verifier, &os, &logger);
+
+    Stopwatch suiteStopwatch;
+    TestSuite testSuite = TestSuiteProvider::provide(
+            coreSpec.rawTestSuite(),
+            config.slug(),
+            optional<IOManipulator*>(&ioManipulator));
+    timings->suite += suiteStopwatch.elapsedSeconds();
+
+    bool successful = generator.generate(testSuite, config);
+    timings->total += totalStopwatch.elapsedSeconds();
+    return successful;
+}
+
+bool runTiny(const string& tcDir, LoggerEngine* loggerEngine, StageTimings* timings) {
+    return runPipeline(new TinyTestSpec(), "cat", tcDir, loggerEngine, timings);
+}
+
+bool runHuge(const string& tcDir, LoggerEngine* loggerEngine, StageTimings* timings) {
+    return runPipeline(new HugeTestSpec(), "cat", tcDir, loggerEngine, timings);
+}
+
+bool runHugeTyped(const string& tcDir, LoggerEngine* loggerEngine, StageTimings* timings) {
+    return runPipeline(new HugeTypedTestSpec(), "cat", tcDir, loggerEngine, timings);
+}
+
+bool runStreamed(const string& tcDir, LoggerEngine* loggerEngine, StageTimings* timings) {
+    return runPipeline(new StreamedTestSpec(), "cat", tcDir, loggerEngine, timings);
+}
+
+bool runSoak(const string& tcDir, LoggerEngine* loggerEngine, StageTimings* timings) {
+    bool successful = true;
+    int baselineFds = 0;
+    long baselineRss = 0;
+    for (int round = 1; round <= SOAK_ROUNDS; round++) {
+        successful &= runPipeline(new TinyTestSpec(), "cat", tcDir, loggerEngine, timings);
+
+        int fds = openFileDescriptorsCount();
+        long rss = currentRssInKilobytes();
+        if (round <= SOAK_WARMUP_ROUNDS) {
+            baselineFds = fds;
+            baselineRss = rss;
+            continue;
+        }
+        if (fds > baselineFds) {
+            fprintf(stderr, "soak: open file descriptors grew from %d to %d after round %d\n", baselineFds, fds, round);
+            successful = false;
+        }
+        if (rss - baselineRss > SOAK_RSS_GROWTH_TOLERANCE_IN_KILOBYTES) {
+            fprintf(stderr, "soak: RSS grew from %ld KB to %ld KB after round %d\n", baselineRss, rss, round);
+            successful = false;
+        }
+    }
+    return successful;
+}
+
+bool runMulti(const string& tcDir, LoggerEngine* loggerEngine, StageTimings* timings) {
+    return runPipeline(new MultiTestSpec(), "tail -n +2", tcDir, loggerEngine, timings);
+}
+
+vector<Scenario> scenarios() {
+    return {
+            {"tiny", TinyTestSpec::TEST_CASES_COUNT + 1, runTiny},
+            {"huge", HugeTestSpec::TEST_CASES_COUNT, runHuge},
+            {"huge-typed", HugeTypedTestSpec::TEST_CASES_COUNT, runHugeTyped},
+            {"streamed", StreamedTestSpec::TEST_CASES_COUNT, runStreamed},
+            {"soak", SOAK_ROUNDS * (TinyTestSpec::TEST_CASES_COUNT + 1), runSoak},
+            {"multi", MultiTestSpec::TEST_GROUPS_COUNT * MultiTestSpec::TEST_CASES_PER_GROUP_COUNT, runMulti}};
+}
+
+long peakRssInKilobytes() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+void printHeader() {
+    printf("%-10s %7s %9s %8s %8s %8s %8s %8s %9s %8s %8s %12s\n",
+           "scenario", "cases", "total(s)", "spec", "suite", "apply", "verify", "print", "solution", "parse",
+           "combine", "rss(KB)");
+}
+
+int runScenarioInChild(const Scenario& scenario, const string& rootDir, bool verbose) {
+    string tcDir = rootDir + "/" + scenario.name;
+    LoggerEngine* loggerEngine = verbose ? (LoggerEngine*) new SimpleLoggerEngine() : new NullLoggerEngine();
+
+    StageTimings timings;
+    bool successful = scenario.run(tcDir, loggerEngine, &timings);
+
+    printf("%-10s %7d %9.3f %8.3f %8.3f %8.3f %8.3f %8.3f %9.3f %8.3f %8.3f %12ld%s\n",
+           scenario.name.c_str(),
+           scenario.testCasesCount,
+           timings.total,
+           timings.spec,
+           timings.suite,
+           timings.apply,
+           timings.verify,
+           timings.print,
+           timings.solution,
+           timings.parse,
+           timings.combine,
+           peakRssInKilobytes(),
+           successful ? "" : "  (FAILED)");
+    fflush(stdout);
+
+    system(("rm -rf " + tcDir).c_str());
+    return successful ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    bool verbose = false;
+    vector<string> selectedNames;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--verbose") == 0) {
+            verbose = true;
+        } else {
+            selectedNames.push_back(argv[i]);
+        }
+    }
+
+    char rootDirTemplate[] = "/tmp/tcframe_benchmark_XXXXXX";
+    if (mkdtemp(rootDirTemplate) == nullptr) {
+        perror("mkdtemp");
+        return 1;
+    }
+    string rootDir = rootDirTemplate;
+
+    printHeader();
+    fflush(stdout);
+
+    int exitCode = 0;
+    for (const Scenario& scenario : scenarios()) {
+        bool selected = selectedNames.empty();
+        for (const string& name : selectedNames) {
+            selected |= name == scenario.name;
+        }
+        if (!selected) {
+            continue;
+        }
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            _exit(runScenarioInChild(scenario, rootDir, verbose));
+        }
+
+        int status;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            exitCode = 1;
+        }
+    }
+
+    system(("rm -rf " + rootDir).c_str());
+    return exitCode;
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <string>
+
+#include "tcframe/experimental/runner.hpp"
+
+using std::string;
+
+namespace tcframe {
+
+struct StageTimings {
+    double spec = 0;
+    double suite = 0;
+    double apply = 0;
+    double verify = 0;
+    double print = 0;
+    double solution = 0;
+    double parse = 0;
+    double combine = 0;
+    double total = 0;
+
+    double testCaseStagesSum() const {
+        return verify + print + solution + parse;
+    }
+};
+
+class NullLoggerEngine : public LoggerEngine {
+public:
+    void logHeading(string) {}
+    void logParagraph(int, string) {}
+    void logHangingParagraph(int, string) {}
+    void logListItem1(int, string) {}
+    void logListItem2(int, string) {}
+};
+
+/*
+ * The components below wrap the real pipeline components and add the time spent in each call to a stage.
+ */
+
+class InstrumentedVerifier : public Verifier {
+private:
+    StageTimings* timings_;
+
+public:
+    InstrumentedVerifier(ConstraintSuite constraintSuite, StageTimings* timings)
+            : Verifier(move(constraintSuite))
+            , timings_(timings) {}
+
+    ConstraintsVerificationResult verifyConstraints(const set<int>& subtaskIds) {
+        Stopwatch stopwatch;
+        ConstraintsVerificationResult result = Verifier::verifyConstraints(subtaskIds);
+        timings_->verify += stopwatch.elapsedSeconds();
+        return result;
+    }
+
+    MultipleTestCasesConstraintsVerificationResult verifyMultipleTestCasesConstraints() {
+        Stopwatch stopwatch;
+        MultipleTestCasesConstraintsVerificationResult result = Verifier::verifyMultipleTestCasesConstraints();
+        timings_->combine += stopwatch.elapsedSeconds();
+        return result;
+    }
+};
+
+class InstrumentedIOManipulator : public IOManipulator {
+private:
+    StageTimings* timings_;
+
+public:
+    InstrumentedIOManipulator(const IOFormat& ioFormat, StageTimings* timings)
+            : IOManipulator(ioFormat)
+            , timings_(timings) {}
+
+    void printInput(ostream* out) {
+        Stopwatch stopwatch;
+        IOManipulator::printInput(out);
+        timings_->print += stopwatch.elapsedSeconds();
+    }
+
+    void parseOutput(istream* in) {
+        Stopwatch stopwatch;
+        IOManipulator::parseOutput(in);
+        timings_->parse += stopwatch.elapsedSeconds();
+    }
+};
+
+class InstrumentedOperatingSystem : public UnixOperatingSystem {
+private:
+    StageTimings* timings_;
+
+public:
+    InstrumentedOperatingSystem(StageTimings* timings)
+            : timings_(timings) {}
+
+    ostream* openForWriting(const string& filename) {
+        Stopwatch stopwatch;
+        ostream* out = UnixOperatingSystem::openForWriting(filename);
+        timings_->print += stopwatch.elapsedSeconds();
+        return out;
+    }
+
+    void closeOpenedWritingStream(ostream* out) {
+        Stopwatch stopwatch;
+        UnixOperatingSystem::closeOpenedWritingStream(out);
+        timings_->print += stopwatch.elapsedSeconds();
+    }
+
+    ExecutionResult execute(
+            const string& command,
+            const string& inputFilename,
+            const string& outputFilename,
+            const string& errorFilename) {
+
+        Stopwatch stopwatch;
+        ExecutionResult result = UnixOperatingSystem::execute(command, inputFilename, outputFilename, errorFilename);
+        timings_->solution += stopwatch.elapsedSeconds();
+        return result;
+    }
+
+    void combineMultipleTestCases(const string& testCaseBaseFilename, int testCasesCount) {
+        Stopwatch stopwatch;
+        UnixOperatingSystem::combineMultipleTestCases(testCaseBaseFilename, testCasesCount);
+        timings_->combine += stopwatch.elapsedSeconds();
+    }
+};
+
+/*
+ * Applying a test case is not observable from outside TestCaseGenerator, so it is measured as the remainder of
+ * the test case generation time after the other stages.
+ */
+class InstrumentedTestCaseGenerator : public TestCaseGenerator {
+private:
+    StageTimings* timings_;
+
+public:
+    InstrumentedTestCaseGenerator(
+            Verifier* verifier,
+            IOManipulator* ioManipulator,
+            OperatingSystem* os,
+            GeneratorLogger* logger,
+            StageTimings* timings)
+            : TestCaseGenerator(verifier, ioManipulator, os, logger)
+            , timings_(timings) {}
+
+    bool generate(const TestCase& testCase, const GeneratorConfig& config) {
+        double stagesSumBefore = timings_->testCaseStagesSum();
+        Stopwatch stopwatch;
+        bool successful = TestCaseGenerator::generate(testCase, config);
+        double elapsed = stopwatch.elapsedSeconds();
+        timings_->apply += elapsed - (timings_->testCaseStagesSum() - stagesSumBefore);
+        return successful;
+    }
+};
+
+}
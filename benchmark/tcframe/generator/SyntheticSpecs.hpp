@@ -0,0 +1,337 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "tcframe/experimental/runner.hpp"
+
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Synthetic problems for the generation benchmark. The output format of each problem mirrors its input format,
+ * so that a trivial local solution (`cat`, or `tail -n +2` for multiple test cases per file) is a valid solution.
+ */
+
+class TinyProblemSpec : public BaseProblemSpec {
+protected:
+    int N;
+    vector<int> A;
+
+    int M;
+    vector<int> B;
+
+    void Config() {
+        setSlug("tiny");
+    }
+
+    void InputFormat() {
+        LINE(N);
+        LINE(A);
+    }
+
+    void OutputFormat() {
+        LINE(M);
+        LINE(B);
+    }
+
+    void Constraints() {
+        CONS(1 <= N && N <= 10);
+        CONS((int) A.size() == N);
+        CONS(eachElementBetween(A, 1, 1000));
+    }
+
+private:
+    bool eachElementBetween(const vector<int>& v, int lo, int hi) {
+        for (int x : v) {
+            if (x < lo || x > hi) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+class TinyTestSpec : public BaseTestSpec<TinyProblemSpec> {
+public:
+    static const int TEST_CASES_COUNT = 5000;
+
+protected:
+    void SampleTestCases() {
+        SAMPLE_CASE({
+            "3",
+            "1 2 3"
+        });
+    }
+
+    void TestCases() {
+        for (int i = 0; i < TEST_CASES_COUNT; i++) {
+            CASE(N = rnd.nextInt(1, 10), randomArray());
+        }
+    }
+
+private:
+    void randomArray() {
+        A.clear();
+        for (int i = 0; i < N; i++) {
+            A.push_back(rnd.nextInt(1, 1000));
+        }
+    }
+};
+
+class HugeProblemSpec : public BaseProblemSpec {
+protected:
+    int N;
+    vector<long long> A;
+    vector<vector<char>> G;
+
+    int M;
+    vector<long long> B;
+    vector<vector<char>> H;
+
+    void Config() {
+        setSlug("huge");
+    }
+
+    void InputFormat() {
+        LINE(N);
+        LINE(A);
+        GRID(G) % SIZE(1000, 1000);
+    }
+
+    void OutputFormat() {
+        LINE(M);
+        LINE(B);
+        GRID(H) % SIZE(1000, 1000);
+    }
+
+    void Constraints() {
+        CONS(1 <= N && N <= 1000000);
+        CONS((int) A.size() == N);
+        CONS(eachElementBetween(A, 1, 1000000000000LL));
+        CONS(eachCellIn(G, '.', '#'));
+    }
+
+private:
+    bool eachElementBetween(const vector<long long>& v, long long lo, long long hi) {
+        for (long long x : v) {
+            if (x < lo || x > hi) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool eachCellIn(const vector<vector<char>>& grid, char c1, char c2) {
+        for (const vector<char>& row : grid) {
+            for (char c : row) {
+                if (c != c1 && c != c2) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+class HugeTestSpec : public BaseTestSpec<HugeProblemSpec> {
+public:
+    static const int TEST_CASES_COUNT = 3;
+
+protected:
+    void TestCases() {
+        for (int i = 0; i < TEST_CASES_COUNT; i++) {
+            CASE(N = 1000000, randomArray(), randomGrid());
+        }
+    }
+
+private:
+    void randomArray() {
+        A.clear();
+        for (int i = 0; i < N; i++) {
+            A.push_back(rnd.nextLongLong(1, 1000000000000LL));
+        }
+    }
+
+    void randomGrid() {
+        G.assign(1000, vector<char>(1000));
+        for (vector<char>& row : G) {
+            for (char& c : row) {
+                c = rnd.nextInt(2) ? '#' : '.';
+            }
+        }
+    }
+};
+
+/*
+ * The same problem as HugeProblemSpec, with its formats declared with TYPED_FORMAT().
+ */
+class HugeTypedProblemSpec : public HugeProblemSpec {
+protected:
+    void Config() {
+        setSlug("huge-typed");
+    }
+
+    void InputFormat() {
+        TYPED_FORMAT(
+                TYPED_LINE(N),
+                TYPED_LINE(A),
+                TYPED_GRID(G) % SIZE(1000, 1000));
+    }
+
+    void OutputFormat() {
+        TYPED_FORMAT(
+                TYPED_LINE(M),
+                TYPED_LINE(B),
+                TYPED_GRID(H) % SIZE(1000, 1000));
+    }
+};
+
+class HugeTypedTestSpec : public BaseTestSpec<HugeTypedProblemSpec> {
+public:
+    static const int TEST_CASES_COUNT = HugeTestSpec::TEST_CASES_COUNT;
+
+protected:
+    void TestCases() {
+        for (int i = 0; i < TEST_CASES_COUNT; i++) {
+            CASE(N = 1000000, randomArray(), randomGrid());
+        }
+    }
+
+private:
+    void randomArray() {
+        A.clear();
+        for (int i = 0; i < N; i++) {
+            A.push_back(rnd.nextLongLong(1, 1000000000000LL));
+        }
+    }
+
+    void randomGrid() {
+        G.assign(1000, vector<char>(1000));
+        for (vector<char>& row : G) {
+            for (char& c : row) {
+                c = rnd.nextInt(2) ? '#' : '.';
+            }
+        }
+    }
+};
+
+class StreamedProblemSpec : public BaseProblemSpec {
+protected:
+    int N;
+    StreamedVector<long long> A;
+
+    int M;
+    StreamedVector<long long> B;
+
+    void Config() {
+        setSlug("streamed");
+    }
+
+    void InputFormat() {
+        LINE(N);
+        LINE(A);
+    }
+
+    void OutputFormat() {
+        LINE(M);
+        LINE(B);
+    }
+
+    void Constraints() {
+        CONS(1 <= N && N <= 20000000);
+        CONS(A.size() == N);
+        CONS(eachElementBetween(A, 1, 1000000000000LL));
+    }
+};
+
+class StreamedTestSpec : public BaseTestSpec<StreamedProblemSpec> {
+public:
+    static const int TEST_CASES_COUNT = 1;
+
+protected:
+    void TestCases() {
+        CASE(N = 20000000, streamedArray());
+    }
+
+private:
+    void streamedArray() {
+        A = StreamedVector<long long>(N, rnd, [] (Random& r) {return r.nextLongLong(1, 1000000000000LL);});
+    }
+};
+
+class MultiProblemSpec : public BaseProblemSpec {
+protected:
+    int T;
+
+    int N;
+    vector<int> A;
+
+    int M;
+    vector<int> B;
+
+    void Config() {
+        setSlug("multi");
+        setMultipleTestCasesCount(T);
+    }
+
+    void InputFormat() {
+        LINE(N);
+        LINE(A);
+    }
+
+    void OutputFormat() {
+        LINE(M);
+        LINE(B);
+    }
+
+    void MultipleTestCasesConstraints() {
+        CONS(1 <= T && T <= 1000);
+    }
+
+    void Constraints() {
+        CONS(1 <= N && N <= 100);
+        CONS((int) A.size() == N);
+    }
+};
+
+class MultiTestSpec : public BaseTestSpec<MultiProblemSpec> {
+public:
+    static const int TEST_GROUPS_COUNT = 4;
+    static const int TEST_CASES_PER_GROUP_COUNT = 250;
+
+protected:
+    void TestGroup1() {
+        addTestCases();
+    }
+
+    void TestGroup2() {
+        addTestCases();
+    }
+
+    void TestGroup3() {
+        addTestCases();
+    }
+
+    void TestGroup4() {
+        addTestCases();
+    }
+
+private:
+    void addTestCases() {
+        for (int i = 0; i < TEST_CASES_PER_GROUP_COUNT; i++) {
+            CASE(N = rnd.nextInt(1, 100), randomArray());
+        }
+    }
+
+    void randomArray() {
+        A.clear();
+        for (int i = 0; i < N; i++) {
+            A.push_back(rnd.nextInt(1, 1000000));
+        }
+    }
+};
+
+}
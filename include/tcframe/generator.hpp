@@ -1,7 +1,16 @@
 #pragma once
 
+#include "tcframe/generator/DuplicateDetector.hpp"
+#include "tcframe/generator/DurationProfile.hpp"
+#include "tcframe/generator/FileManifest.hpp"
 #include "tcframe/generator/GenerationException.hpp"
+#include "tcframe/generator/GenerationJournal.hpp"
 #include "tcframe/generator/Generator.hpp"
 #include "tcframe/generator/GeneratorConfig.hpp"
 #include "tcframe/generator/GeneratorLogger.hpp"
+#include "tcframe/generator/InputStatisticsTable.hpp"
+#include "tcframe/generator/NdjsonGeneratorLogger.hpp"
+#include "tcframe/generator/ShardManifest.hpp"
+#include "tcframe/generator/Sharding.hpp"
 #include "tcframe/generator/TestCaseGenerator.hpp"
+#include "tcframe/generator/TestCaseMetrics.hpp"
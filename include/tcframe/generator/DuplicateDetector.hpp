@@ -0,0 +1,184 @@
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "FileManifest.hpp"
+#include "tcframe/util.hpp"
+
+using std::make_pair;
+using std::map;
+using std::pair;
+using std::set;
+using std::string;
+using std::tie;
+using std::unordered_map;
+using std::vector;
+
+namespace tcframe {
+
+/* Two test cases whose inputs differ, but are estimated to be similar. */
+struct NearDuplicateTestCases {
+private:
+    string testCaseId_;
+    string otherTestCaseId_;
+    double similarity_;
+
+public:
+    NearDuplicateTestCases(const string& testCaseId, const string& otherTestCaseId, double similarity)
+            : testCaseId_(testCaseId)
+            , otherTestCaseId_(otherTestCaseId)
+            , similarity_(similarity) {}
+
+    const string& testCaseId() const {
+        return testCaseId_;
+    }
+
+    const string& otherTestCaseId() const {
+        return otherTestCaseId_;
+    }
+
+    /* The estimated Jaccard similarity of the shingles of the two inputs, between 0 and 1. */
+    double similarity() const {
+        return similarity_;
+    }
+
+    bool operator==(const NearDuplicateTestCases& o) const {
+        return tie(testCaseId_, otherTestCaseId_, similarity_) == tie(o.testCaseId_, o.otherTestCaseId_, o.similarity_);
+    }
+};
+
+/*
+ * Collects the digests, and optionally the MinHash signatures, of the generated inputs, to find the test cases that
+ * waste judging time by repeating another test case.
+ */
+class DuplicateDetector {
+private:
+    // Locality-sensitive hashing: signatures that agree on all the bins of any band are compared.
+    static const int BANDS_COUNT = 16;
+    static const int BAND_SIZE = MinHashSignature::BINS_COUNT / BANDS_COUNT;
+
+    vector<string> testCaseIds_;
+    vector<FileDigest> digests_;
+    vector<optional<MinHashSignature>> signatures_;
+
+public:
+    virtual ~DuplicateDetector() {}
+
+    void clear() {
+        testCaseIds_.clear();
+        digests_.clear();
+        signatures_.clear();
+    }
+
+    void record(
+            const string& testCaseId,
+            const FileDigest& digest,
+            const optional<MinHashSignature>& signature = optional<MinHashSignature>()) {
+
+        testCaseIds_.push_back(testCaseId);
+        digests_.push_back(digest);
+        signatures_.push_back(signature);
+    }
+
+    /* The groups of test cases with identical inputs, each in the order in which the test cases were recorded. */
+    vector<vector<string>> duplicates() const {
+        vector<vector<string>> duplicates;
+        for (const vector<int>& group : groupIdenticalInputs()) {
+            if (group.size() > 1) {
+                vector<string> testCaseIds;
+                for (int i : group) {
+                    testCaseIds.push_back(testCaseIds_[i]);
+                }
+                duplicates.push_back(testCaseIds);
+            }
+        }
+        return duplicates;
+    }
+
+    /*
+     * The pairs of test cases with different inputs whose estimated similarity is at least minSimilarity, in the
+     * order in which the test cases were recorded. Only the first of identical inputs is paired.
+     */
+    vector<NearDuplicateTestCases> nearDuplicates(double minSimilarity) const {
+        vector<unordered_map<unsigned long long, vector<int>>> buckets(BANDS_COUNT);
+        for (const vector<int>& group : groupIdenticalInputs()) {
+            int i = group[0];
+            if (!signatures_[i]) {
+                continue;
+            }
+            for (int band = 0; band < BANDS_COUNT; band++) {
+                if (isEmptyBand(signatures_[i].value(), band)) {
+                    // Otherwise all small inputs would be compared with each other.
+                    continue;
+                }
+                buckets[band][bandHash(signatures_[i].value(), band)].push_back(i);
+            }
+        }
+
+        set<pair<int, int>> candidates;
+        for (const auto& bandBuckets : buckets) {
+            for (const auto& bucket : bandBuckets) {
+                // The indices were added in increasing order.
+                const vector<int>& indices = bucket.second;
+                for (int j = 0; j < indices.size(); j++) {
+                    for (int k = j + 1; k < indices.size(); k++) {
+                        candidates.insert(make_pair(indices[j], indices[k]));
+                    }
+                }
+            }
+        }
+
+        vector<NearDuplicateTestCases> nearDuplicates;
+        for (const pair<int, int>& candidate : candidates) {
+            double similarity = signatures_[candidate.first].value().similarity(signatures_[candidate.second].value());
+            if (similarity >= minSimilarity) {
+                nearDuplicates.push_back(NearDuplicateTestCases(
+                        testCaseIds_[candidate.first],
+                        testCaseIds_[candidate.second],
+                        similarity));
+            }
+        }
+        return nearDuplicates;
+    }
+
+private:
+    /* The indices of the recorded test cases, grouped by identical inputs, in the order of their first test cases. */
+    vector<vector<int>> groupIdenticalInputs() const {
+        map<pair<unsigned long long, long long>, int> groupIndices;
+        vector<vector<int>> groups;
+        for (int i = 0; i < digests_.size(); i++) {
+            auto key = make_pair(digests_[i].hash(), digests_[i].size());
+            auto it = groupIndices.find(key);
+            if (it == groupIndices.end()) {
+                groupIndices[key] = (int) groups.size();
+                groups.push_back({i});
+            } else {
+                groups[it->second].push_back(i);
+            }
+        }
+        return groups;
+    }
+
+    static bool isEmptyBand(const MinHashSignature& signature, int band) {
+        for (int i = band * BAND_SIZE; i < (band + 1) * BAND_SIZE; i++) {
+            if (signature.bins()[i] != MinHashSignature::EMPTY_BIN) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static unsigned long long bandHash(const MinHashSignature& signature, int band) {
+        XxHash64 hash(band);
+        hash.update((const char*) &signature.bins()[band * BAND_SIZE], BAND_SIZE * sizeof(unsigned long long));
+        return hash.digest();
+    }
+};
+
+}
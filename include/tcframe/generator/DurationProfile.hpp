@@ -0,0 +1,74 @@
+#pragma once
+
+#include <iomanip>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+using std::fixed;
+using std::istream;
+using std::map;
+using std::ostream;
+using std::runtime_error;
+using std::setprecision;
+using std::string;
+
+namespace tcframe {
+
+/*
+ * The time that generating each test case took in the previous generations, which the shards are balanced with. Only
+ * the test cases that were generated successfully are recorded.
+ */
+class DurationProfile {
+private:
+    map<string, double> durations_;
+
+public:
+    virtual ~DurationProfile() {}
+
+    /* Durations in seconds, by test case id. */
+    const map<string, double>& durations() const {
+        return durations_;
+    }
+
+    void record(const string& testCaseId, double seconds) {
+        durations_[testCaseId] = seconds;
+    }
+
+    void remove(const string& testCaseId) {
+        durations_.erase(testCaseId);
+    }
+
+    void clear() {
+        durations_.clear();
+    }
+
+    void write(ostream* out) const {
+        for (const auto& entry : durations_) {
+            *out << entry.first << " " << fixed << setprecision(3) << entry.second << "\n";
+        }
+    }
+
+    /* Adds the entries read from the stream, replacing existing entries of the same test cases. */
+    void read(istream* in) {
+        string testCaseId;
+        double seconds;
+        while (*in >> testCaseId >> seconds) {
+            if (seconds < 0) {
+                throw runtime_error("Malformed duration profile entry for " + testCaseId);
+            }
+            record(testCaseId, seconds);
+        }
+        if (!in->eof()) {
+            throw runtime_error("Malformed duration profile");
+        }
+    }
+
+    static string filename(const string& testCasesDir) {
+        return testCasesDir + "/durations.profile";
+    }
+};
+
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdio>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "tcframe/util.hpp"
+
+using std::istream;
+using std::make_pair;
+using std::map;
+using std::ostream;
+using std::runtime_error;
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+struct FileDigest {
+private:
+    unsigned long long hash_;
+    long long size_;
+
+public:
+    FileDigest(unsigned long long hash, long long size)
+            : hash_(hash)
+            , size_(size) {}
+
+    /* The XXH64 hash of the file content. */
+    unsigned long long hash() const {
+        return hash_;
+    }
+
+    long long size() const {
+        return size_;
+    }
+
+    bool operator==(const FileDigest& o) const {
+        return tie(hash_, size_) == tie(o.hash_, o.size_);
+    }
+
+    bool operator!=(const FileDigest& o) const {
+        return !(*this == o);
+    }
+
+    /* Reads the stream to the end, then rewinds it. */
+    static FileDigest of(istream* in) {
+        XxHash64 hash;
+        long long size = 0;
+        char buffer[1 << 16];
+        while (in->read(buffer, sizeof(buffer)) || in->gcount() > 0) {
+            hash.update(buffer, (size_t) in->gcount());
+            size += in->gcount();
+        }
+        in->clear();
+        in->seekg(0);
+        return FileDigest(hash.digest(), size);
+    }
+};
+
+/*
+ * The size and hash of every generated test case file, by file name relative to the test cases directory. Written as
+ * one "<hash> <size> <name>" line per file.
+ */
+class FileManifest {
+private:
+    map<string, FileDigest> digests_;
+
+public:
+    virtual ~FileManifest() {}
+
+    const map<string, FileDigest>& digests() const {
+        return digests_;
+    }
+
+    void record(const string& filename, const FileDigest& digest) {
+        digests_.erase(filename);
+        digests_.insert(make_pair(filename, digest));
+    }
+
+    void remove(const string& filename) {
+        digests_.erase(filename);
+    }
+
+    void clear() {
+        digests_.clear();
+    }
+
+    void write(ostream* out) const {
+        for (const auto& entry : digests_) {
+            *out << XxHash64::toHex(entry.second.hash()) << " " << entry.second.size() << " " << entry.first << "\n";
+        }
+    }
+
+    /* Adds the entries read from the stream, replacing existing entries of the same files. */
+    void read(istream* in) {
+        string hash;
+        long long size;
+        string filename;
+        while (*in >> hash >> size >> filename) {
+            unsigned long long parsedHash;
+            char trailing;
+            if (hash.size() != 16 || sscanf(hash.c_str(), "%llx%c", &parsedHash, &trailing) != 1) {
+                throw runtime_error("Malformed file manifest entry for " + filename);
+            }
+            record(filename, FileDigest(parsedHash, size));
+        }
+        if (!in->eof()) {
+            throw runtime_error("Malformed file manifest");
+        }
+    }
+
+    static string filename(const string& testCasesDir) {
+        return testCasesDir + "/files.manifest";
+    }
+};
+
+/* The files that differ between two file manifests, each in lexicographic order. */
+struct FileManifestDiff {
+private:
+    vector<string> addedFilenames_;
+    vector<string> removedFilenames_;
+    vector<string> changedFilenames_;
+    int unchangedCount_;
+
+public:
+    FileManifestDiff(const FileManifest& oldManifest, const FileManifest& newManifest)
+            : unchangedCount_(0) {
+        for (const auto& entry : newManifest.digests()) {
+            auto oldEntry = oldManifest.digests().find(entry.first);
+            if (oldEntry == oldManifest.digests().end()) {
+                addedFilenames_.push_back(entry.first);
+            } else if (oldEntry->second != entry.second) {
+                changedFilenames_.push_back(entry.first);
+            } else {
+                unchangedCount_++;
+            }
+        }
+        for (const auto& entry : oldManifest.digests()) {
+            if (!newManifest.digests().count(entry.first)) {
+                removedFilenames_.push_back(entry.first);
+            }
+        }
+    }
+
+    const vector<string>& addedFilenames() const {
+        return addedFilenames_;
+    }
+
+    const vector<string>& removedFilenames() const {
+        return removedFilenames_;
+    }
+
+    const vector<string>& changedFilenames() const {
+        return changedFilenames_;
+    }
+
+    int unchangedCount() const {
+        return unchangedCount_;
+    }
+};
+
+}
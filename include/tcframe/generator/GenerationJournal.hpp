@@ -0,0 +1,186 @@
+#pragma once
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "GeneratorConfig.hpp"
+#include "tcframe/os.hpp"
+#include "tcframe/testcase.hpp"
+#include "tcframe/util.hpp"
+
+using std::getline;
+using std::istream;
+using std::istringstream;
+using std::map;
+using std::ostream;
+using std::runtime_error;
+using std::string;
+
+namespace tcframe {
+
+/*
+ * The test cases, and the combined multiple test cases, that were generated successfully in the test cases directory,
+ * each with the fingerprint of what it was generated from, so that an interrupted generation can be resumed without
+ * generating them again. While open, the journal file is a log that every change is appended to.
+ */
+class GenerationJournal {
+private:
+    map<string, string> fingerprints_;
+    OperatingSystem* os_;
+    ostream* log_;
+    string logFilename_;
+
+public:
+    virtual ~GenerationJournal() {
+        close();
+    }
+
+    GenerationJournal()
+            : os_(nullptr)
+            , log_(nullptr) {}
+
+    /* Fingerprints by test case id, or by base id for combined multiple test cases. */
+    const map<string, string>& fingerprints() const {
+        return fingerprints_;
+    }
+
+    bool contains(const string& id, const string& fingerprint) const {
+        auto entry = fingerprints_.find(id);
+        return entry != fingerprints_.end() && entry->second == fingerprint;
+    }
+
+    void record(const string& id, const string& fingerprint) {
+        fingerprints_[id] = fingerprint;
+        append("record " + fingerprint + " " + id);
+    }
+
+    void remove(const string& id) {
+        if (fingerprints_.erase(id)) {
+            append("remove " + id);
+        }
+    }
+
+    /* Only clears the entries; the journal file is left as it is. */
+    void clear() {
+        fingerprints_.clear();
+    }
+
+    void write(ostream* out) const {
+        for (const auto& entry : fingerprints_) {
+            *out << "record " << entry.second << " " << entry.first << "\n";
+        }
+    }
+
+    /* Compacts the journal file, then appends every later change to it, durably, instead of rewriting it. */
+    void open(OperatingSystem* os, const GeneratorConfig& config) {
+        compact(os, config);
+        os_ = os;
+        logFilename_ = filename(config);
+        log_ = os->openForAppending(logFilename_);
+    }
+
+    void close() {
+        if (log_ != nullptr) {
+            os_->closeOpenedWritingStream(log_);
+            log_ = nullptr;
+        }
+    }
+
+    /*
+     * Closes the journal, and rewrites its file with only the current entries: to a temporary file that then replaces
+     * it, so that an interruption leaves a whole journal.
+     */
+    void compact(OperatingSystem* os, const GeneratorConfig& config) {
+        close();
+        string temporaryFilename = filename(config) + ".tmp";
+        ostream* out = os->openForWriting(temporaryFilename);
+        write(out);
+        os->closeOpenedWritingStream(out);
+        os->syncFile(temporaryFilename);
+        os->renameFile(temporaryFilename, filename(config));
+    }
+
+    /* Replays the changes read from the stream onto the entries. */
+    void read(istream* in) {
+        string line;
+        while (getline(*in, line)) {
+            if (in->eof()) {
+                // The last change was cut short by an interruption.
+                break;
+            }
+            istringstream change(line);
+            string action;
+            string fingerprint;
+            string id;
+            string rest;
+            change >> action;
+            if (action == "record" && change >> fingerprint >> id && fingerprint.size() == 16 && !(change >> rest)) {
+                fingerprints_[id] = fingerprint;
+            } else if (action == "remove" && change >> id && !(change >> rest)) {
+                fingerprints_.erase(id);
+            } else {
+                throw runtime_error("Malformed generation journal line: " + line);
+            }
+        }
+    }
+
+    /*
+     * Identifies what the files of a test case are generated from: the slug, the seed, the solutions, and the id,
+     * description and subtasks of the test case. A change to code that the description does not show, such as a
+     * helper function of the closure, is not detected.
+     */
+    static string fingerprint(const TestCase& testCase, const GeneratorConfig& config) {
+        XxHash64 hash;
+        hash.update(config.slug() + "\n" + StringUtils::toString(config.seed()) + "\n");
+        hash.update(config.noOutput() ? "no output\n" : "solution " + config.solutionCommand() + "\n");
+        for (const string& command : config.alternativeSolutionCommands()) {
+            hash.update("alternative solution " + command + "\n");
+        }
+        hash.update("case " + testCase.id() + " " + testCase.description() + " subtasks");
+        for (int subtaskId : testCase.subtaskIds()) {
+            hash.update(" " + StringUtils::toString(subtaskId));
+        }
+        return XxHash64::toHex(hash.digest());
+    }
+
+    /* Identifies what a combined multiple test cases file is generated from: all of its test cases. */
+    static string fingerprint(const TestGroup& testGroup, const GeneratorConfig& config) {
+        XxHash64 hash;
+        for (const TestCase& testCase : testGroup.testCases()) {
+            hash.update(fingerprint(testCase, config) + "\n");
+        }
+        return XxHash64::toHex(hash.digest());
+    }
+
+    /* Each shard keeps its own journal, as shards may be generated in the same directory at the same time. */
+    static string filename(const GeneratorConfig& config) {
+        if (config.isSharded()) {
+            return config.testCasesDir() + "/shard-" + StringUtils::toString(config.shardIndex())
+                   + "-of-" + StringUtils::toString(config.shardsCount()) + ".journal";
+        }
+        return config.testCasesDir() + "/generation.journal";
+    }
+
+    static bool isShardFilename(const string& filename) {
+        string suffix = ".journal";
+        return filename.compare(0, 6, "shard-") == 0
+               && filename.size() > suffix.size()
+               && filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+private:
+    void append(const string& change) {
+        if (log_ == nullptr) {
+            return;
+        }
+        *log_ << change << "\n";
+        log_->flush();
+        os_->syncFile(logFilename_);
+    }
+};
+
+}
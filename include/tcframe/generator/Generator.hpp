@@ -1,12 +1,21 @@
 #pragma once
 
 #include <functional>
+#include <map>
+#include <memory>
 #include <vector>
 #include <set>
 #include <sstream>
 #include <string>
 
+#include "DuplicateDetector.hpp"
+#include "DurationProfile.hpp"
+#include "FileManifest.hpp"
+#include "GenerationJournal.hpp"
 #include "GeneratorLogger.hpp"
+#include "InputStatisticsTable.hpp"
+#include "ShardManifest.hpp"
+#include "Sharding.hpp"
 #include "TestCaseGenerator.hpp"
 #include "tcframe/os.hpp"
 #include "tcframe/testcase.hpp"
@@ -14,9 +23,11 @@
 
 using std::function;
 using std::istringstream;
+using std::map;
 using std::vector;
 using std::set;
 using std::string;
+using std::unique_ptr;
 
 namespace tcframe {
 
@@ -27,6 +38,12 @@ private:
     OperatingSystem* os_;
     GeneratorLogger* logger_;
 
+    // The shard of each test case, in a sharded generation.
+    map<string, int> shardIndices_;
+
+    // The files in the test cases directory before a resumed generation.
+    set<string> existingFilenames_;
+
 public:
     virtual ~Generator() {}
 
@@ -41,15 +58,173 @@ public:
             , logger_(logger) {}
 
     virtual bool generate(const TestSuite& testSuite, const GeneratorConfig& config) {
+        TraceSpan span(testCaseGenerator_->tracer(), "generate", "generator");
         logger_->logIntroduction();
 
-        os_->forceMakeDir(config.testCasesDir());
+        map<string, double> partitionDurations;
+        if (config.isSharded() && config.durationsFilename()) {
+            try {
+                partitionDurations = readPartitionDurations(config.durationsFilename().value());
+            } catch (runtime_error& e) {
+                logger_->logSimpleFailure(e.what());
+                logger_->logFailedResult();
+                return false;
+            }
+        }
+
+        if (config.dryRun()) {
+            // Nothing is written.
+        } else if (config.isSelective()) {
+            os_->makeDir(config.testCasesDir());
+        } else {
+            os_->forceMakeDir(config.testCasesDir());
+        }
+        if (config.snapshotDir() && !config.fromSnapshots() && !config.dryRun()) {
+            os_->makeDir(config.snapshotDir().value());
+        }
+        FileManifest* fileManifest = testCaseGenerator_->fileManifest();
+        if (fileManifest != nullptr) {
+            fileManifest->clear();
+            if (config.isSelective() && !config.isSharded()) {
+                readFileManifest(config);
+            }
+        }
+        InputStatisticsTable* inputStatisticsTable = testCaseGenerator_->inputStatisticsTable();
+        if (inputStatisticsTable != nullptr) {
+            inputStatisticsTable->clear();
+            if (config.isSelective() && !config.isSharded()) {
+                readInputStatisticsTable(config);
+            }
+        }
+        DuplicateDetector* duplicateDetector = testCaseGenerator_->duplicateDetector();
+        if (duplicateDetector != nullptr) {
+            duplicateDetector->clear();
+        }
+        DurationProfile* durationProfile = testCaseGenerator_->durationProfile();
+        if (durationProfile != nullptr) {
+            durationProfile->clear();
+            if (config.isSelective() && !config.isSharded()) {
+                readDurationProfile(config);
+            }
+            // Test cases that this shard does not regenerate keep the durations it was partitioned with.
+            for (const auto& entry : partitionDurations) {
+                durationProfile->record(entry.first, entry.second);
+            }
+        }
+        GenerationJournal* journal = testCaseGenerator_->journal();
+        if (journal != nullptr) {
+            journal->clear();
+            if (config.isSelective() && !config.dryRun()) {
+                readJournal(config);
+            }
+            if (!config.dryRun()) {
+                journal->open(os_, config);
+            }
+        }
+        existingFilenames_.clear();
+        if (config.resume() && !config.dryRun()) {
+            vector<string> filenames = os_->listFiles(config.testCasesDir());
+            existingFilenames_.insert(filenames.begin(), filenames.end());
+        }
+        if (config.isSharded()) {
+            shardIndices_ = Sharding::assign(testSuite, config.shardsCount(), partitionDurations);
+        }
 
         bool successful = true;
+        vector<string> generatedTestCaseIds;
+        vector<string> failedTestCaseIds;
         for (const TestGroup& testGroup : testSuite.testGroups()) {
-            successful &= generateTestGroup(testGroup, config);
+            successful &= generateTestGroup(testGroup, config, generatedTestCaseIds, failedTestCaseIds);
+        }
+        if (journal != nullptr && !config.dryRun()) {
+            closeJournal(successful, config);
+        }
+        if (config.isSharded() && !config.dryRun()) {
+            string durationsDigest = Sharding::durationsDigest(partitionDurations);
+            writeShardManifest(ShardManifest(
+                    config.shardIndex(),
+                    config.shardsCount(),
+                    config.seed(),
+                    Sharding::fingerprint(testSuite, config, durationsDigest),
+                    generatedTestCaseIds,
+                    failedTestCaseIds,
+                    durationsOf(generatedTestCaseIds),
+                    durationsDigest), config);
+        }
+        if (fileManifest != nullptr && !config.isSharded() && !config.dryRun()) {
+            writeFileManifest(config);
+        }
+        if (inputStatisticsTable != nullptr && !config.isSharded() && !config.dryRun()) {
+            writeInputStatisticsTable(testSuite, config);
+        }
+        if (durationProfile != nullptr && !config.isSharded() && !config.dryRun()) {
+            writeDurationProfile(config);
+        }
+        if (duplicateDetector != nullptr && !config.dryRun()) {
+            successful &= checkDuplicates(*duplicateDetector, config);
+        }
+        if (verifier_->profile() != nullptr) {
+            logger_->logConstraintProfile(*verifier_->profile());
+        }
+        if (successful) {
+            logger_->logSuccessfulResult();
+        } else {
+            logger_->logFailedResult();
+        }
+        return successful;
+    }
+
+    /*
+     * Checks that the shards in the test cases directory were all generated successfully from the same spec and seed,
+     * and together cover the whole test suite; then combines the multiple test cases, if any.
+     */
+    virtual bool merge(const TestSuite& testSuite, const GeneratorConfig& config) {
+        TraceSpan span(testCaseGenerator_->tracer(), "merge", "generator");
+        logger_->logMergeIntroduction(config.testCasesDir());
+
+        vector<string> failures;
+        vector<string> manifestFilenames;
+        vector<string> journalFilenames;
+        for (const string& filename : os_->listFiles(config.testCasesDir())) {
+            if (Sharding::isManifestFilename(filename)) {
+                manifestFilenames.push_back(config.testCasesDir() + "/" + filename);
+            } else if (GenerationJournal::isShardFilename(filename)) {
+                journalFilenames.push_back(config.testCasesDir() + "/" + filename);
+            }
+        }
+        vector<ShardManifest> manifests = readShardManifests(manifestFilenames, failures);
+        if (failures.empty()) {
+            checkShardManifests(manifests, testSuite, config, failures);
+        }
+        if (!failures.empty()) {
+            for (const string& failure : failures) {
+                logger_->logMergeFailure(failure);
+            }
+            logger_->logFailedResult();
+            return false;
+        }
+
+        bool successful = true;
+        if (config.multipleTestCasesCount() != nullptr) {
+            for (const TestGroup& testGroup : testSuite.testGroups()) {
+                if (!testGroup.testCases().empty()) {
+                    successful &= combineMultipleTestCases(testGroup, config);
+                }
+            }
         }
         if (successful) {
+            for (const string& manifestFilename : manifestFilenames) {
+                os_->removeFile(manifestFilename);
+            }
+            for (const string& journalFilename : journalFilenames) {
+                os_->removeFile(journalFilename);
+            }
+            if (testCaseGenerator_->fileManifest() != nullptr) {
+                rebuildFileManifest(config);
+            }
+            if (testCaseGenerator_->durationProfile() != nullptr) {
+                mergeDurationProfile(manifests, config);
+            }
             logger_->logSuccessfulResult();
         } else {
             logger_->logFailedResult();
@@ -58,28 +233,403 @@ public:
     }
 
 private:
-    bool generateTestGroup(const TestGroup& testGroup, const GeneratorConfig& config) {
-        logger_->logTestGroupIntroduction(testGroup.id());
+    bool generateTestGroup(
+            const TestGroup& testGroup,
+            const GeneratorConfig& config,
+            vector<string>& generatedTestCaseIds,
+            vector<string>& failedTestCaseIds) {
+
+        // Combining removes the individual test case files, so a combined file can only be rebuilt as a whole.
+        // Shards leave the combining to the merge instead.
+        bool wholeTestGroup = isSelected(testGroup, config)
+                && config.multipleTestCasesCount() != nullptr
+                && !config.isSharded();
+
+        bool introduced = !config.isSelective();
+        if (introduced) {
+            logger_->logTestGroupIntroduction(testGroup.id());
+        }
+
+        if (wholeTestGroup && isResumed(testGroup, config)) {
+            if (!introduced) {
+                logger_->logTestGroupIntroduction(testGroup.id());
+            }
+            for (const TestCase& testCase : testGroup.testCases()) {
+                skip(testCase, config);
+                generatedTestCaseIds.push_back(testCase.id());
+            }
+            string baseId = TestCaseIdCreator::createBaseId(config.slug(), testGroup.id());
+            logger_->logMultipleTestCasesCombinationIntroduction(baseId);
+            logger_->logResumedResult();
+            keepFiles(baseId, config);
+            return true;
+        }
 
         bool successful = true;
         for (const TestCase& testCase : testGroup.testCases()) {
-            successful &= testCaseGenerator_->generate(testCase, config);
+            if (!wholeTestGroup && !isSelected(testGroup.id(), testCase, config)) {
+                skip(testCase, config);
+                continue;
+            }
+            if (!introduced) {
+                logger_->logTestGroupIntroduction(testGroup.id());
+                introduced = true;
+            }
+            if (isResumed(testCase, config)) {
+                skip(testCase, config);
+                logger_->logTestCaseIntroduction(testCase.id());
+                logger_->logResumedResult();
+                keepFiles(testCase.id(), config);
+                generatedTestCaseIds.push_back(testCase.id());
+                continue;
+            }
+            if (testCaseGenerator_->generate(testCase, config)) {
+                generatedTestCaseIds.push_back(testCase.id());
+            } else {
+                failedTestCaseIds.push_back(testCase.id());
+                successful = false;
+            }
         }
-        if (successful && config.multipleTestCasesCount() != nullptr && !testGroup.testCases().empty()) {
+        if (!introduced) {
+            return true;
+        }
+        if (successful
+                && config.multipleTestCasesCount() != nullptr
+                && !config.isSharded()
+                && !testGroup.testCases().empty()) {
             return combineMultipleTestCases(testGroup, config);
         }
         return successful;
     }
 
+    /* Whether the journal lists the test case with the same fingerprint, and its files are still there. */
+    bool isResumed(const TestCase& testCase, const GeneratorConfig& config) const {
+        GenerationJournal* journal = testCaseGenerator_->journal();
+        return config.resume()
+                && journal != nullptr
+                && journal->contains(testCase.id(), GenerationJournal::fingerprint(testCase, config))
+                && hasFiles(testCase.id(), config);
+    }
+
+    bool isResumed(const TestGroup& testGroup, const GeneratorConfig& config) const {
+        GenerationJournal* journal = testCaseGenerator_->journal();
+        string baseId = TestCaseIdCreator::createBaseId(config.slug(), testGroup.id());
+        return config.resume()
+                && journal != nullptr
+                && !testGroup.testCases().empty()
+                && journal->contains(baseId, GenerationJournal::fingerprint(testGroup, config))
+                && hasFiles(baseId, config);
+    }
+
+    bool hasFiles(const string& id, const GeneratorConfig& config) const {
+        return existingFilenames_.count(id + ".in") && (config.noOutput() || existingFilenames_.count(id + ".out"));
+    }
+
+    /* The files of a resumed generation were digested by the interrupted one, whose file manifest is lost. */
+    void keepFiles(const string& id, const GeneratorConfig& config) {
+        FileManifest* fileManifest = testCaseGenerator_->fileManifest();
+        if (fileManifest == nullptr || config.isSharded()) {
+            return;
+        }
+        for (const string& filename : {id + ".in", id + ".out"}) {
+            if (existingFilenames_.count(filename) && !fileManifest->digests().count(filename)) {
+                recordFileDigest(filename, config);
+            }
+        }
+    }
+
+    bool isSelected(const TestGroup& testGroup, const GeneratorConfig& config) {
+        for (const TestCase& testCase : testGroup.testCases()) {
+            if (isSelected(testGroup.id(), testCase, config)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool isSelected(int testGroupId, const TestCase& testCase, const GeneratorConfig& config) {
+        if (config.isSharded() && shardIndices_[testCase.id()] != config.shardIndex()) {
+            return false;
+        }
+        if (!config.testGroupIds() && !config.testCaseIds()) {
+            return true;
+        }
+        return (config.testGroupIds() && config.testGroupIds().value().count(testGroupId))
+                || (config.testCaseIds() && config.testCaseIds().value().count(testCase.id()));
+    }
+
+    /* Reports the generated test cases whose inputs repeat another one; this fails only if asked to. */
+    bool checkDuplicates(const DuplicateDetector& duplicateDetector, const GeneratorConfig& config) {
+        vector<vector<string>> duplicates = duplicateDetector.duplicates();
+        vector<NearDuplicateTestCases> nearDuplicates;
+        if (config.nearDuplicateSimilarity()) {
+            nearDuplicates = duplicateDetector.nearDuplicates(config.nearDuplicateSimilarity().value() / 100.0);
+        }
+        if (duplicates.empty() && nearDuplicates.empty()) {
+            return true;
+        }
+        logger_->logDuplicateTestCases(duplicates, nearDuplicates);
+        return !config.failOnDuplicates();
+    }
+
+    void writeShardManifest(const ShardManifest& manifest, const GeneratorConfig& config) {
+        ostream* out = os_->openForWriting(
+                Sharding::manifestFilename(config.testCasesDir(), manifest.shardIndex(), manifest.shardsCount()));
+        manifest.write(out);
+        os_->closeOpenedWritingStream(out);
+    }
+
+    void readJournal(const GeneratorConfig& config) {
+        GenerationJournal* journal = testCaseGenerator_->journal();
+        unique_ptr<istream> in(os_->openForReading(GenerationJournal::filename(config)));
+        try {
+            journal->read(in.get());
+        } catch (runtime_error&) {
+            // Without a journal, every test case is generated again.
+            journal->clear();
+        }
+    }
+
+    /* Once every test case is generated, there is nothing left to resume. */
+    void closeJournal(bool successful, const GeneratorConfig& config) {
+        GenerationJournal* journal = testCaseGenerator_->journal();
+        if (successful && !config.testGroupIds() && !config.testCaseIds() && !config.isSharded()) {
+            journal->close();
+            os_->removeFile(GenerationJournal::filename(config));
+        } else {
+            journal->compact(os_, config);
+        }
+    }
+
+    void readDurationProfile(const GeneratorConfig& config) {
+        DurationProfile* durationProfile = testCaseGenerator_->durationProfile();
+        unique_ptr<istream> in(os_->openForReading(DurationProfile::filename(config.testCasesDir())));
+        try {
+            durationProfile->read(in.get());
+        } catch (runtime_error&) {
+            // The profile is only maintained here; it is rebuilt from the test cases generated this time.
+            durationProfile->clear();
+        }
+    }
+
+    /*
+     * Every shard must be partitioned with the same durations, so a profile that cannot be read fails the generation
+     * rather than silently falling back to the hashes of the test case ids.
+     */
+    map<string, double> readPartitionDurations(const string& filename) {
+        unique_ptr<istream> in(os_->openForReading(filename));
+        if (in == nullptr || !*in) {
+            throw runtime_error("Cannot read duration profile " + filename);
+        }
+        DurationProfile durationProfile;
+        try {
+            durationProfile.read(in.get());
+        } catch (runtime_error& e) {
+            throw runtime_error(filename + ": " + e.what());
+        }
+        return durationProfile.durations();
+    }
+
+    void writeDurationProfile(const GeneratorConfig& config) {
+        ScopedWritingStream out(os_, os_->openForWriting(DurationProfile::filename(config.testCasesDir())));
+        testCaseGenerator_->durationProfile()->write(out.get());
+    }
+
+    /* The shards do not write the profile, which they all have to read the same; the merge writes it instead. */
+    void mergeDurationProfile(const vector<ShardManifest>& manifests, const GeneratorConfig& config) {
+        DurationProfile* durationProfile = testCaseGenerator_->durationProfile();
+        durationProfile->clear();
+        for (const ShardManifest& manifest : manifests) {
+            for (const auto& entry : manifest.durations()) {
+                durationProfile->record(entry.first, entry.second);
+            }
+        }
+        writeDurationProfile(config);
+    }
+
+    map<string, double> durationsOf(const vector<string>& testCaseIds) const {
+        map<string, double> durations;
+        DurationProfile* durationProfile = testCaseGenerator_->durationProfile();
+        if (durationProfile == nullptr) {
+            return durations;
+        }
+        for (const string& testCaseId : testCaseIds) {
+            auto duration = durationProfile->durations().find(testCaseId);
+            if (duration != durationProfile->durations().end()) {
+                durations.insert(*duration);
+            }
+        }
+        return durations;
+    }
+
+    void readFileManifest(const GeneratorConfig& config) {
+        FileManifest* fileManifest = testCaseGenerator_->fileManifest();
+        unique_ptr<istream> in(os_->openForReading(FileManifest::filename(config.testCasesDir())));
+        try {
+            fileManifest->read(in.get());
+        } catch (runtime_error&) {
+            // A missing or corrupt manifest only means that the digests of the untouched files are unknown.
+            fileManifest->clear();
+        }
+    }
+
+    void writeFileManifest(const GeneratorConfig& config) {
+        ostream* out = os_->openForWriting(FileManifest::filename(config.testCasesDir()));
+        testCaseGenerator_->fileManifest()->write(out);
+        os_->closeOpenedWritingStream(out);
+    }
+
+    void readInputStatisticsTable(const GeneratorConfig& config) {
+        InputStatisticsTable* inputStatisticsTable = testCaseGenerator_->inputStatisticsTable();
+        unique_ptr<istream> in(os_->openForReading(InputStatisticsTable::filename(config.testCasesDir())));
+        try {
+            inputStatisticsTable->read(in.get());
+        } catch (runtime_error&) {
+            // The rows of the untouched test cases are then missing until they are regenerated.
+            inputStatisticsTable->clear();
+        }
+    }
+
+    void writeInputStatisticsTable(const TestSuite& testSuite, const GeneratorConfig& config) {
+        vector<string> testCaseIds;
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                testCaseIds.push_back(testCase.id());
+            }
+        }
+        ScopedWritingStream out(os_, os_->openForWriting(InputStatisticsTable::filename(config.testCasesDir())));
+        testCaseGenerator_->inputStatisticsTable()->write(testCaseIds, out.get());
+    }
+
+    /*
+     * Shards are generated separately, so the merged files that were not just combined have to be read again to be
+     * digested.
+     */
+    void rebuildFileManifest(const GeneratorConfig& config) {
+        FileManifest* fileManifest = testCaseGenerator_->fileManifest();
+        for (const string& filename : os_->listFiles(config.testCasesDir())) {
+            if (isTestCaseFilename(filename) && !fileManifest->digests().count(filename)) {
+                recordFileDigest(filename, config);
+            }
+        }
+        writeFileManifest(config);
+    }
+
+    void recordFileDigest(const string& filename, const GeneratorConfig& config) {
+        unique_ptr<istream> in(os_->openForReading(config.testCasesDir() + "/" + filename));
+        if (!in->fail()) {
+            testCaseGenerator_->fileManifest()->record(filename, FileDigest::of(in.get()));
+        }
+    }
+
+    /* Names starting with an underscore are scratch files of the solutions, which are not test case files. */
+    static bool isTestCaseFilename(const string& filename) {
+        if (filename.empty() || filename[0] == '_') {
+            return false;
+        }
+        return filename.size() > 3 && (filename.compare(filename.size() - 3, 3, ".in") == 0
+                                       || (filename.size() > 4 && filename.compare(filename.size() - 4, 4, ".out") == 0));
+    }
+
+    vector<ShardManifest> readShardManifests(const vector<string>& manifestFilenames, vector<string>& failures) {
+        vector<ShardManifest> manifests;
+        for (const string& manifestFilename : manifestFilenames) {
+            unique_ptr<istream> in(os_->openForReading(manifestFilename));
+            try {
+                manifests.push_back(ShardManifest::read(in.get()));
+            } catch (runtime_error& e) {
+                failures.push_back(manifestFilename + ": " + e.what());
+            }
+        }
+        return manifests;
+    }
+
+    static void checkShardManifests(
+            const vector<ShardManifest>& manifests,
+            const TestSuite& testSuite,
+            const GeneratorConfig& config,
+            vector<string>& failures) {
+
+        if (manifests.empty()) {
+            failures.push_back("No shard manifests found");
+            return;
+        }
+
+        int shardsCount = manifests[0].shardsCount();
+        set<int> shardIndices;
+        set<string> generatedTestCaseIds;
+        set<string> overlappingTestCaseIds;
+        for (const ShardManifest& manifest : manifests) {
+            string shard = "Shard " + StringUtils::toString(manifest.shardIndex())
+                           + "/" + StringUtils::toString(manifest.shardsCount());
+            if (manifest.shardsCount() != shardsCount) {
+                failures.push_back(shard + " does not have the same number of shards as the others");
+            }
+            if (manifest.seed() != manifests[0].seed()) {
+                failures.push_back(shard + " was generated with a different seed");
+            }
+            if (manifest.durationsDigest() != manifests[0].durationsDigest()) {
+                failures.push_back(shard + " was partitioned with a different duration profile");
+            }
+            if (manifest.fingerprint() != Sharding::fingerprint(testSuite, config, manifest.durationsDigest())) {
+                failures.push_back(shard + " was generated from a different spec");
+            }
+            for (const string& testCaseId : manifest.failedTestCaseIds()) {
+                failures.push_back(shard + " failed to generate " + testCaseId);
+            }
+            shardIndices.insert(manifest.shardIndex());
+            for (const string& testCaseId : manifest.generatedTestCaseIds()) {
+                if (!generatedTestCaseIds.insert(testCaseId).second && overlappingTestCaseIds.insert(testCaseId).second) {
+                    failures.push_back(testCaseId + " was generated by more than one shard");
+                }
+            }
+        }
+        for (int shardIndex = 1; shardIndex <= shardsCount; shardIndex++) {
+            if (!shardIndices.count(shardIndex)) {
+                failures.push_back("Shard " + StringUtils::toString(shardIndex)
+                                   + "/" + StringUtils::toString(shardsCount) + " is missing");
+            }
+        }
+        if (!failures.empty()) {
+            return;
+        }
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                if (!generatedTestCaseIds.count(testCase.id())) {
+                    failures.push_back(testCase.id() + " was not generated by any shard");
+                }
+            }
+        }
+    }
+
+    /*
+     * Test cases that are not regenerated are still applied, so that the random number generator is in the same
+     * state for the following test cases as in a full generation. Test cases restored from snapshots do not depend
+     * on that state.
+     */
+    void skip(const TestCase& testCase, const GeneratorConfig& config) {
+        if (config.fromSnapshots()) {
+            return;
+        }
+        try {
+            testCase.applier()();
+        } catch (runtime_error&) {
+            // The failure belongs to a test case that is not regenerated.
+        }
+    }
+
     bool combineMultipleTestCases(const TestGroup& testGroup, const GeneratorConfig& config) {
         string baseId = TestCaseIdCreator::createBaseId(config.slug(), testGroup.id());
+        TraceSpan span(testCaseGenerator_->tracer(), "combine", "testGroup", baseId);
         logger_->logMultipleTestCasesCombinationIntroduction(baseId);
 
         *config.multipleTestCasesCount() = (int) testGroup.testCases().size();
 
         try {
             verify();
-            combine(testGroup, config);
+            if (!config.dryRun()) {
+                combine(testGroup, config);
+            }
         } catch (GenerationException& e) {
             logger_->logMultipleTestCasesCombinationFailedResult();
             e.callback()();
@@ -104,7 +654,31 @@ private:
     void combine(const TestGroup& testGroup, const GeneratorConfig& config) {
         string baseId = TestCaseIdCreator::createBaseId(config.slug(), testGroup.id());
         string baseFilename = config.testCasesDir() + "/" + baseId;
+        GenerationJournal* journal = testCaseGenerator_->journal();
+        if (journal != nullptr) {
+            journal->remove(baseId);
+        }
         os_->combineMultipleTestCases(baseFilename, (int) testGroup.testCases().size());
+        if (journal != nullptr) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                journal->remove(testCase.id());
+            }
+            os_->syncFile(baseFilename + ".in");
+            if (!config.noOutput()) {
+                os_->syncFile(baseFilename + ".out");
+            }
+            journal->record(baseId, GenerationJournal::fingerprint(testGroup, config));
+        }
+
+        FileManifest* fileManifest = testCaseGenerator_->fileManifest();
+        if (fileManifest != nullptr && !config.isSharded()) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                fileManifest->remove(testCase.id() + ".in");
+                fileManifest->remove(testCase.id() + ".out");
+            }
+            recordFileDigest(baseId + ".in", config);
+            recordFileDigest(baseId + ".out", config);
+        }
     }
 };
 
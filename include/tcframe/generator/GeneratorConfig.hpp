@@ -1,14 +1,19 @@
 #pragma once
 
+#include <set>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "tcframe/spec/core.hpp"
+#include "tcframe/util.hpp"
 
 using std::move;
+using std::set;
 using std::string;
 using std::tie;
+using std::vector;
 
 namespace tcframe {
 
@@ -20,7 +25,20 @@ private:
     unsigned seed_;
     string slug_;
     string solutionCommand_;
+    vector<string> alternativeSolutionCommands_;
     string testCasesDir_;
+    bool noOutput_;
+    bool dryRun_;
+    optional<set<int>> testGroupIds_;
+    optional<set<string>> testCaseIds_;
+    int shardIndex_;
+    int shardsCount_;
+    optional<string> durationsFilename_;
+    optional<string> snapshotDir_;
+    bool fromSnapshots_;
+    bool failOnDuplicates_;
+    optional<int> nearDuplicateSimilarity_;
+    bool resume_;
 
 public:
     int* multipleTestCasesCount() const {
@@ -39,13 +57,91 @@ public:
         return solutionCommand_;
     }
 
+    /* The commands of the solutions whose outputs are cross-checked against the output of solutionCommand(). */
+    const vector<string>& alternativeSolutionCommands() const {
+        return alternativeSolutionCommands_;
+    }
+
     const string& testCasesDir() const {
         return testCasesDir_;
     }
 
+    /* Whether only the input files are written, without running the solution. */
+    bool noOutput() const {
+        return noOutput_;
+    }
+
+    /* Whether the test cases are only applied and verified, without writing any files. */
+    bool dryRun() const {
+        return dryRun_;
+    }
+
+    /* The test groups to regenerate, or none if all of them are regenerated. */
+    const optional<set<int>>& testGroupIds() const {
+        return testGroupIds_;
+    }
+
+    /* The test cases to regenerate, or none if all of them are regenerated. */
+    const optional<set<string>>& testCaseIds() const {
+        return testCaseIds_;
+    }
+
+    /* The 1-based index of the shard to generate, out of shardsCount(). */
+    int shardIndex() const {
+        return shardIndex_;
+    }
+
+    int shardsCount() const {
+        return shardsCount_;
+    }
+
+    bool isSharded() const {
+        return shardsCount_ > 1;
+    }
+
+    /* The duration profile that the test cases are balanced across the shards with, if any. */
+    const optional<string>& durationsFilename() const {
+        return durationsFilename_;
+    }
+
+    /* The directory that the snapshots of the applied test cases are saved into, if any. */
+    const optional<string>& snapshotDir() const {
+        return snapshotDir_;
+    }
+
+    /* Whether the test cases are restored from their snapshots in snapshotDir(), instead of being applied. */
+    bool fromSnapshots() const {
+        return fromSnapshots_;
+    }
+
+    /* Whether the generation fails if some test cases have duplicate or near-duplicate inputs. */
+    bool failOnDuplicates() const {
+        return failOnDuplicates_;
+    }
+
+    /* The minimum similarity in percent of the inputs reported as near-duplicates, if they are detected at all. */
+    const optional<int>& nearDuplicateSimilarity() const {
+        return nearDuplicateSimilarity_;
+    }
+
+    /* Whether the test cases that the journal of an interrupted generation lists are kept instead of regenerated. */
+    bool resume() const {
+        return resume_;
+    }
+
+    /* Whether only some test cases are regenerated, in place. */
+    bool isSelective() const {
+        return testGroupIds_ || testCaseIds_ || isSharded() || resume_;
+    }
+
     bool operator==(const GeneratorConfig& o) const {
-        return tie(multipleTestCasesCount_, seed_, slug_, solutionCommand_, testCasesDir_) ==
-                tie(o.multipleTestCasesCount_, o.seed_, o.slug_, o.solutionCommand_, o.testCasesDir_);
+        return tie(multipleTestCasesCount_, seed_, slug_, solutionCommand_, alternativeSolutionCommands_,
+                   testCasesDir_, noOutput_, dryRun_, testGroupIds_, testCaseIds_, shardIndex_, shardsCount_,
+                   durationsFilename_, snapshotDir_, fromSnapshots_, failOnDuplicates_, nearDuplicateSimilarity_, resume_) ==
+                tie(o.multipleTestCasesCount_, o.seed_, o.slug_, o.solutionCommand_, o.alternativeSolutionCommands_,
+                    o.testCasesDir_, o.noOutput_, o.dryRun_, o.testGroupIds_, o.testCaseIds_, o.shardIndex_,
+                    o.shardsCount_, o.durationsFilename_, o.snapshotDir_, o.fromSnapshots_, o.failOnDuplicates_, o.nearDuplicateSimilarity_,
+                    o.resume_);
     }
 };
 
@@ -64,6 +160,13 @@ public:
         subject_.slug_ = DefaultValues::slug();
         subject_.solutionCommand_ = DefaultValues::solutionCommand();
         subject_.testCasesDir_ = DefaultValues::testCasesDir();
+        subject_.noOutput_ = false;
+        subject_.dryRun_ = false;
+        subject_.shardIndex_ = 1;
+        subject_.shardsCount_ = 1;
+        subject_.fromSnapshots_ = false;
+        subject_.failOnDuplicates_ = false;
+        subject_.resume_ = false;
     }
 
     GeneratorConfigBuilder& setMultipleTestCasesCount(int* var) {
@@ -86,11 +189,72 @@ public:
         return *this;
     }
 
+    GeneratorConfigBuilder& setAlternativeSolutionCommands(const vector<string>& alternativeSolutionCommands) {
+        subject_.alternativeSolutionCommands_ = alternativeSolutionCommands;
+        return *this;
+    }
+
     GeneratorConfigBuilder& setTestCasesDir(string testCasesDir) {
         subject_.testCasesDir_ = testCasesDir;
         return *this;
     }
 
+    GeneratorConfigBuilder& setNoOutput(bool noOutput) {
+        subject_.noOutput_ = noOutput;
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setDryRun(bool dryRun) {
+        subject_.dryRun_ = dryRun;
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setTestGroupIds(const set<int>& testGroupIds) {
+        subject_.testGroupIds_ = optional<set<int>>(testGroupIds);
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setTestCaseIds(const set<string>& testCaseIds) {
+        subject_.testCaseIds_ = optional<set<string>>(testCaseIds);
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setShard(int shardIndex, int shardsCount) {
+        subject_.shardIndex_ = shardIndex;
+        subject_.shardsCount_ = shardsCount;
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setDurationsFilename(string durationsFilename) {
+        subject_.durationsFilename_ = optional<string>(durationsFilename);
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setSnapshotDir(string snapshotDir) {
+        subject_.snapshotDir_ = optional<string>(snapshotDir);
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setFromSnapshots(bool fromSnapshots) {
+        subject_.fromSnapshots_ = fromSnapshots;
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setFailOnDuplicates(bool failOnDuplicates) {
+        subject_.failOnDuplicates_ = failOnDuplicates;
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setNearDuplicateSimilarity(int nearDuplicateSimilarity) {
+        subject_.nearDuplicateSimilarity_ = optional<int>(nearDuplicateSimilarity);
+        return *this;
+    }
+
+    GeneratorConfigBuilder& setResume(bool resume) {
+        subject_.resume_ = resume;
+        return *this;
+    }
+
     GeneratorConfig build() {
         return move(subject_);
     }
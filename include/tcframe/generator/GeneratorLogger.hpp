@@ -1,17 +1,24 @@
 #pragma once
 
 #include <cstring>
+#include <iomanip>
 #include <iostream>
 #include <streambuf>
 #include <string>
 #include <vector>
 
+#include "DuplicateDetector.hpp"
+#include "TestCaseMetrics.hpp"
 #include "tcframe/logger.hpp"
 #include "tcframe/os.hpp"
+#include "tcframe/testcase.hpp"
 #include "tcframe/util.hpp"
 #include "tcframe/verifier.hpp"
 
+using std::fixed;
 using std::istreambuf_iterator;
+using std::ostringstream;
+using std::setprecision;
 using std::string;
 using std::vector;
 
@@ -43,6 +50,11 @@ public:
         engine_->logParagraph(0, "OK");
     }
 
+    /* The test case, or combined multiple test cases, was kept from the generation that is resumed. */
+    virtual void logResumedResult() {
+        engine_->logParagraph(0, "RESUMED");
+    }
+
     virtual void logTestCaseFailedResult(const string& testCaseDescription) {
         engine_->logParagraph(0, "FAILED");
         engine_->logParagraph(2, "Description: " + testCaseDescription);
@@ -103,9 +115,81 @@ public:
         }
     }
 
+    /* Each disagreement names an alternative solution and how it disagrees with the solution. */
+    virtual void logSolutionsDisagreement(const vector<string>& disagreements) {
+        engine_->logListItem1(2, "Alternative solutions disagree with the solution:");
+        for (const string& disagreement : disagreements) {
+            engine_->logListItem2(3, disagreement);
+        }
+    }
+
+    virtual void logMergeIntroduction(const string& testCasesDir) {
+        engine_->logParagraph(0, "Merging shards in " + testCasesDir + "...");
+    }
+
+    virtual void logMergeFailure(const string& message) {
+        engine_->logListItem1(1, message);
+    }
+
     virtual void logSimpleFailure(const string& message) {
         engine_->logListItem1(2, message);
     }
+
+    /* Called once per test case, after its result has been logged. */
+    virtual void logTestCaseMetrics(const TestCase& testCase, const TestCaseMetrics& metrics) {
+        if (metrics.solutionDurations().size() > 1) {
+            string slowestSolution = metrics.slowestSolution().value();
+            for (const auto& solutionDuration : metrics.solutionDurations()) {
+                if (solutionDuration.first == slowestSolution) {
+                    engine_->logListItem1(2, "Slowest solution: " + slowestSolution
+                            + " (" + formatDuration(solutionDuration.second * 1e3) + " ms)");
+                }
+            }
+        }
+    }
+
+    virtual void logConstraintProfile(const ConstraintProfile& profile) {
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Most expensive constraints:");
+        for (const ConstraintProfileEntry& entry : profile.topEntries(10)) {
+            engine_->logListItem1(1, entry.description());
+            engine_->logListItem2(2, StringUtils::toString(entry.callsCount()) + " calls, "
+                    + formatDuration(entry.totalSeconds() * 1e3) + " ms total, "
+                    + formatDuration(entry.meanSeconds() * 1e6) + " us mean");
+        }
+    }
+
+    virtual void logDuplicateTestCases(
+            const vector<vector<string>>& duplicates,
+            const vector<NearDuplicateTestCases>& nearDuplicates) {
+
+        if (!duplicates.empty()) {
+            engine_->logParagraph(0, "");
+            engine_->logParagraph(0, "Test cases with identical inputs:");
+            for (const vector<string>& testCaseIds : duplicates) {
+                string joinedTestCaseIds = testCaseIds[0];
+                for (int i = 1; i < testCaseIds.size(); i++) {
+                    joinedTestCaseIds += ", " + testCaseIds[i];
+                }
+                engine_->logListItem1(1, joinedTestCaseIds);
+            }
+        }
+        if (!nearDuplicates.empty()) {
+            engine_->logParagraph(0, "");
+            engine_->logParagraph(0, "Test cases with near-duplicate inputs:");
+            for (const NearDuplicateTestCases& nearDuplicate : nearDuplicates) {
+                engine_->logListItem1(1, nearDuplicate.testCaseId() + ", " + nearDuplicate.otherTestCaseId()
+                        + " (" + StringUtils::toString((int) (nearDuplicate.similarity() * 100 + 0.5)) + "% similar)");
+            }
+        }
+    }
+
+private:
+    static string formatDuration(double duration) {
+        ostringstream out;
+        out << fixed << setprecision(3) << duration;
+        return out.str();
+    }
  };
 
 }
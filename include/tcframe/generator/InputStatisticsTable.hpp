@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdlib>
+#include <iomanip>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tcframe/spec/variable.hpp"
+#include "tcframe/util.hpp"
+
+using std::fixed;
+using std::getline;
+using std::istream;
+using std::map;
+using std::ostream;
+using std::ostringstream;
+using std::runtime_error;
+using std::setprecision;
+using std::string;
+using std::strtold;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * The size, the number of tokens and the statistics of the input variables of every generated test case. Written as a
+ * CSV table with one row per test case, in which a scalar has a column with its value, and any other variable has
+ * columns with the number of its values and their range; followed by an "extremes" row with the smallest value of
+ * every minimum column and the largest value of every other column.
+ */
+class InputStatisticsTable {
+private:
+    vector<string> columns_;
+    map<string, vector<string>> rows_;
+
+public:
+    virtual ~InputStatisticsTable() {}
+
+    /* The columns after the test case id. */
+    const vector<string>& columns() const {
+        return columns_;
+    }
+
+    const map<string, vector<string>>& rows() const {
+        return rows_;
+    }
+
+    /* Records a row; the rows with different columns, which were read from an outdated table, are dropped. */
+    void record(const string& testCaseId, long long inputSize, const vector<VariableStatistics>& statistics) {
+        vector<string> columns = {"bytes", "tokens"};
+        vector<string> row = {StringUtils::toString(inputSize), ""};
+        long long tokensCount = 0;
+        for (const VariableStatistics& variableStatistics : statistics) {
+            tokensCount += variableStatistics.tokensCount();
+            if (variableStatistics.type() == VariableType::SCALAR) {
+                columns.push_back(variableStatistics.name());
+                row.push_back(formatMin(variableStatistics));
+            } else {
+                columns.push_back(variableStatistics.name() + ".count");
+                columns.push_back(variableStatistics.name() + ".min");
+                columns.push_back(variableStatistics.name() + ".max");
+                row.push_back(StringUtils::toString(variableStatistics.valuesCount()));
+                row.push_back(formatMin(variableStatistics));
+                row.push_back(formatMax(variableStatistics));
+            }
+        }
+        row[1] = StringUtils::toString(tokensCount);
+
+        if (columns != columns_) {
+            columns_ = columns;
+            rows_.clear();
+        }
+        rows_[testCaseId] = row;
+    }
+
+    void remove(const string& testCaseId) {
+        rows_.erase(testCaseId);
+    }
+
+    void clear() {
+        columns_.clear();
+        rows_.clear();
+    }
+
+    /* Writes the rows of the given test cases, in the given order. */
+    void write(const vector<string>& testCaseIds, ostream* out) const {
+        *out << "testCase";
+        for (const string& column : columns_) {
+            *out << "," << column;
+        }
+        *out << "\n";
+
+        vector<const vector<string>*> writtenRows;
+        for (const string& testCaseId : testCaseIds) {
+            auto row = rows_.find(testCaseId);
+            if (row != rows_.end()) {
+                writeRow(testCaseId, row->second, out);
+                writtenRows.push_back(&row->second);
+            }
+        }
+        if (!writtenRows.empty()) {
+            writeRow(extremesRowId(), extremes(writtenRows), out);
+        }
+    }
+
+    /* Replaces the table with the one read from the stream, without its extremes row. */
+    void read(istream* in) {
+        clear();
+        string line;
+        if (!getline(*in, line)) {
+            return;
+        }
+        vector<string> header = splitFields(line);
+        if (header.empty() || header[0] != "testCase") {
+            throw runtime_error("Malformed input statistics table");
+        }
+        columns_.assign(header.begin() + 1, header.end());
+
+        while (getline(*in, line)) {
+            vector<string> fields = splitFields(line);
+            if (fields.size() != header.size()) {
+                clear();
+                throw runtime_error("Malformed input statistics table");
+            }
+            if (fields[0] != extremesRowId()) {
+                rows_[fields[0]] = vector<string>(fields.begin() + 1, fields.end());
+            }
+        }
+    }
+
+    static string filename(const string& testCasesDir) {
+        return testCasesDir + "/statistics.csv";
+    }
+
+private:
+    static string extremesRowId() {
+        return "extremes";
+    }
+
+    /* Unlike StringUtils::split(), keeps the trailing empty fields. */
+    static vector<string> splitFields(const string& line) {
+        vector<string> fields;
+        size_t begin = 0;
+        while (true) {
+            size_t end = line.find(',', begin);
+            fields.push_back(line.substr(begin, end == string::npos ? string::npos : end - begin));
+            if (end == string::npos) {
+                return fields;
+            }
+            begin = end + 1;
+        }
+    }
+
+    static void writeRow(const string& testCaseId, const vector<string>& row, ostream* out) {
+        *out << testCaseId;
+        for (const string& field : row) {
+            *out << "," << field;
+        }
+        *out << "\n";
+    }
+
+    vector<string> extremes(const vector<const vector<string>*>& rows) const {
+        vector<string> extremes;
+        for (int i = 0; i < columns_.size(); i++) {
+            bool isMinColumn = columns_[i].size() > 4 && columns_[i].compare(columns_[i].size() - 4, 4, ".min") == 0;
+            string extreme;
+            long double extremeValue = 0;
+            for (const vector<string>* row : rows) {
+                const string& field = (*row)[i];
+                if (field.empty()) {
+                    continue;
+                }
+                long double value = strtold(field.c_str(), nullptr);
+                if (extreme.empty() || (isMinColumn ? value < extremeValue : value > extremeValue)) {
+                    extreme = field;
+                    extremeValue = value;
+                }
+            }
+            extremes.push_back(extreme);
+        }
+        return extremes;
+    }
+
+    static string formatMin(const VariableStatistics& statistics) {
+        return statistics.hasRange() ? formatNumber(statistics.min(), statistics.isIntegral()) : "";
+    }
+
+    static string formatMax(const VariableStatistics& statistics) {
+        return statistics.hasRange() ? formatNumber(statistics.max(), statistics.isIntegral()) : "";
+    }
+
+    static string formatNumber(long double number, bool integral) {
+        ostringstream out;
+        if (integral) {
+            out << fixed << setprecision(0) << number;
+        } else {
+            out << setprecision(10) << number;
+        }
+        return out.str();
+    }
+};
+
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "GeneratorLogger.hpp"
+#include "TestCaseMetrics.hpp"
+#include "tcframe/logger.hpp"
+#include "tcframe/os.hpp"
+#include "tcframe/testcase.hpp"
+#include "tcframe/util.hpp"
+#include "tcframe/verifier.hpp"
+
+using std::ostream;
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Generator logger that, in addition to the usual human-readable log, writes one JSON record per line for each
+ * test case, each multiple test cases combination, and each group of duplicate test cases. A record is written once
+ * the next one starts, or when the generation finishes.
+ */
+class NdjsonGeneratorLogger : public GeneratorLogger {
+private:
+    ostream* out_;
+    int currentTestGroupId_;
+
+    bool hasPendingRecord_;
+    string pendingType_;
+    string pendingId_;
+    bool pendingSuccessful_;
+    vector<string> pendingReasons_;
+    string pendingMetricsFields_;
+
+public:
+    virtual ~NdjsonGeneratorLogger() {}
+
+    NdjsonGeneratorLogger(LoggerEngine* engine, ostream* out)
+            : GeneratorLogger(engine)
+            , out_(out)
+            , currentTestGroupId_(0)
+            , hasPendingRecord_(false)
+            , pendingSuccessful_(false) {}
+
+    void logSuccessfulResult() {
+        writePendingRecord();
+        out_->flush();
+        GeneratorLogger::logSuccessfulResult();
+    }
+
+    void logFailedResult() {
+        writePendingRecord();
+        out_->flush();
+        GeneratorLogger::logFailedResult();
+    }
+
+    void logTestGroupIntroduction(int testGroupId) {
+        writePendingRecord();
+        currentTestGroupId_ = testGroupId;
+        GeneratorLogger::logTestGroupIntroduction(testGroupId);
+    }
+
+    void logTestCaseIntroduction(string testCaseId) {
+        startRecord("testCase", testCaseId);
+        GeneratorLogger::logTestCaseIntroduction(testCaseId);
+    }
+
+    void logTestCaseSuccessfulResult() {
+        pendingSuccessful_ = true;
+        GeneratorLogger::logTestCaseSuccessfulResult();
+    }
+
+    void logResumedResult() {
+        pendingSuccessful_ = true;
+        pendingMetricsFields_ = ",\"resumed\":true";
+        GeneratorLogger::logResumedResult();
+    }
+
+    void logTestCaseFailedResult(const string& testCaseDescription) {
+        pendingSuccessful_ = false;
+        GeneratorLogger::logTestCaseFailedResult(testCaseDescription);
+    }
+
+    void logMultipleTestCasesCombinationIntroduction(const string& testCaseBaseId) {
+        startRecord("combination", testCaseBaseId);
+        GeneratorLogger::logMultipleTestCasesCombinationIntroduction(testCaseBaseId);
+    }
+
+    void logMultipleTestCasesCombinationSuccessfulResult() {
+        pendingSuccessful_ = true;
+        GeneratorLogger::logMultipleTestCasesCombinationSuccessfulResult();
+    }
+
+    void logMultipleTestCasesCombinationFailedResult() {
+        pendingSuccessful_ = false;
+        GeneratorLogger::logMultipleTestCasesCombinationFailedResult();
+    }
+
+    void logConstraintsVerificationFailure(const ConstraintsVerificationResult& result) {
+        for (const string& failure : result.describeFailures()) {
+            pendingReasons_.push_back(failure);
+        }
+        GeneratorLogger::logConstraintsVerificationFailure(result);
+    }
+
+    void logMultipleTestCasesConstraintsVerificationFailure(
+            const MultipleTestCasesConstraintsVerificationResult& result) {
+
+        for (const string& failure : result.describeFailures()) {
+            pendingReasons_.push_back(failure);
+        }
+        GeneratorLogger::logMultipleTestCasesConstraintsVerificationFailure(result);
+    }
+
+    void logSolutionExecutionFailure(const ExecutionResult& result) {
+        pendingReasons_.push_back("Execution of solution failed: " + result.describeExitStatus());
+        GeneratorLogger::logSolutionExecutionFailure(result);
+    }
+
+    void logSolutionsDisagreement(const vector<string>& disagreements) {
+        for (const string& disagreement : disagreements) {
+            pendingReasons_.push_back("Alternative solution disagrees: " + disagreement);
+        }
+        GeneratorLogger::logSolutionsDisagreement(disagreements);
+    }
+
+    void logSimpleFailure(const string& message) {
+        pendingReasons_.push_back(message);
+        GeneratorLogger::logSimpleFailure(message);
+    }
+
+    void logTestCaseMetrics(const TestCase& testCase, const TestCaseMetrics& metrics) {
+        ostringstream fields;
+        fields << ",\"description\":" << StringUtils::toJsonString(testCase.description());
+
+        fields << ",\"subtasks\":[";
+        bool first = true;
+        for (int subtaskId : testCase.subtaskIds()) {
+            fields << (first ? "" : ",") << subtaskId;
+            first = false;
+        }
+        fields << "]";
+
+        if (metrics.inputSize()) {
+            fields << ",\"inputBytes\":" << metrics.inputSize().value();
+        }
+        if (metrics.outputSize()) {
+            fields << ",\"outputBytes\":" << metrics.outputSize().value();
+        }
+
+        fields << ",\"durations\":{";
+        first = true;
+        for (const auto& stageDuration : metrics.stageDurations()) {
+            fields << (first ? "" : ",") << StringUtils::toJsonString(stageDuration.first) << ":" << stageDuration.second;
+            first = false;
+        }
+        fields << "}";
+
+        if (!metrics.solutionDurations().empty()) {
+            fields << ",\"solutions\":{";
+            first = true;
+            for (const auto& solutionDuration : metrics.solutionDurations()) {
+                fields << (first ? "" : ",") << StringUtils::toJsonString(solutionDuration.first) << ":"
+                       << solutionDuration.second;
+                first = false;
+            }
+            fields << "},\"slowestSolution\":" << StringUtils::toJsonString(metrics.slowestSolution().value());
+        }
+
+        pendingMetricsFields_ = fields.str();
+        GeneratorLogger::logTestCaseMetrics(testCase, metrics);
+    }
+
+    void logDuplicateTestCases(
+            const vector<vector<string>>& duplicates,
+            const vector<NearDuplicateTestCases>& nearDuplicates) {
+
+        writePendingRecord();
+        for (const vector<string>& testCaseIds : duplicates) {
+            *out_ << "{\"type\":\"duplicates\",\"ids\":" << toJsonArray(testCaseIds) << "}\n";
+        }
+        for (const NearDuplicateTestCases& nearDuplicate : nearDuplicates) {
+            *out_ << "{\"type\":\"nearDuplicates\",\"ids\":"
+                  << toJsonArray({nearDuplicate.testCaseId(), nearDuplicate.otherTestCaseId()})
+                  << ",\"similarity\":" << nearDuplicate.similarity() << "}\n";
+        }
+        GeneratorLogger::logDuplicateTestCases(duplicates, nearDuplicates);
+    }
+
+private:
+    void startRecord(const string& type, const string& id) {
+        writePendingRecord();
+        hasPendingRecord_ = true;
+        pendingType_ = type;
+        pendingId_ = id;
+        pendingSuccessful_ = false;
+        pendingReasons_.clear();
+        pendingMetricsFields_.clear();
+    }
+
+    void writePendingRecord() {
+        if (!hasPendingRecord_) {
+            return;
+        }
+        hasPendingRecord_ = false;
+
+        *out_ << "{\"type\":" << StringUtils::toJsonString(pendingType_)
+              << ",\"id\":" << StringUtils::toJsonString(pendingId_)
+              << ",\"group\":" << currentTestGroupId_
+              << pendingMetricsFields_
+              << ",\"verdict\":" << (pendingSuccessful_ ? "\"OK\"" : "\"FAILED\"")
+              << ",\"reasons\":" << toJsonArray(pendingReasons_) << "}\n";
+    }
+
+    static string toJsonArray(const vector<string>& values) {
+        string array = "[";
+        for (int i = 0; i < values.size(); i++) {
+            array += (i > 0 ? "," : "") + StringUtils::toJsonString(values[i]);
+        }
+        return array + "]";
+    }
+};
+
+}
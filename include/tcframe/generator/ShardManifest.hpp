@@ -0,0 +1,158 @@
+#pragma once
+
+#include <iomanip>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using std::fixed;
+using std::istream;
+using std::map;
+using std::ostream;
+using std::runtime_error;
+using std::setprecision;
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+/* Records what a single shard of a sharded generation produced, so that the shards can be merged later. */
+struct ShardManifest {
+private:
+    int shardIndex_;
+    int shardsCount_;
+    unsigned seed_;
+    string fingerprint_;
+    vector<string> generatedTestCaseIds_;
+    vector<string> failedTestCaseIds_;
+    map<string, double> durations_;
+    string durationsDigest_;
+
+public:
+    ShardManifest(
+            int shardIndex,
+            int shardsCount,
+            unsigned seed,
+            const string& fingerprint,
+            const vector<string>& generatedTestCaseIds,
+            const vector<string>& failedTestCaseIds,
+            const map<string, double>& durations = map<string, double>(),
+            const string& durationsDigest = "")
+            : shardIndex_(shardIndex)
+            , shardsCount_(shardsCount)
+            , seed_(seed)
+            , fingerprint_(fingerprint)
+            , generatedTestCaseIds_(generatedTestCaseIds)
+            , failedTestCaseIds_(failedTestCaseIds)
+            , durations_(durations)
+            , durationsDigest_(durationsDigest) {}
+
+    int shardIndex() const {
+        return shardIndex_;
+    }
+
+    int shardsCount() const {
+        return shardsCount_;
+    }
+
+    unsigned seed() const {
+        return seed_;
+    }
+
+    const string& fingerprint() const {
+        return fingerprint_;
+    }
+
+    const vector<string>& generatedTestCaseIds() const {
+        return generatedTestCaseIds_;
+    }
+
+    const vector<string>& failedTestCaseIds() const {
+        return failedTestCaseIds_;
+    }
+
+    /* Durations in seconds of the generated test cases, for the duration profile of the merged test cases. */
+    const map<string, double>& durations() const {
+        return durations_;
+    }
+
+    /* The digest of the durations that the shards were partitioned with; empty if they were partitioned by hashes. */
+    const string& durationsDigest() const {
+        return durationsDigest_;
+    }
+
+    void write(ostream* out) const {
+        *out << "shard " << shardIndex_ << " " << shardsCount_ << "\n";
+        *out << "seed " << seed_ << "\n";
+        *out << "fingerprint " << fingerprint_ << "\n";
+        if (!durationsDigest_.empty()) {
+            *out << "partitioned " << durationsDigest_ << "\n";
+        }
+        for (const string& testCaseId : generatedTestCaseIds_) {
+            *out << "generated " << testCaseId << "\n";
+        }
+        for (const string& testCaseId : failedTestCaseIds_) {
+            *out << "failed " << testCaseId << "\n";
+        }
+        for (const auto& entry : durations_) {
+            *out << "duration " << entry.first << " " << fixed << setprecision(3) << entry.second << "\n";
+        }
+    }
+
+    static ShardManifest read(istream* in) {
+        string key;
+        int shardIndex;
+        int shardsCount;
+        unsigned seed;
+        string fingerprint;
+        if (!(*in >> key >> shardIndex >> shardsCount) || key != "shard"
+                || !(*in >> key >> seed) || key != "seed"
+                || !(*in >> key >> fingerprint) || key != "fingerprint") {
+            throw runtime_error("Malformed shard manifest header");
+        }
+
+        vector<string> generatedTestCaseIds;
+        vector<string> failedTestCaseIds;
+        map<string, double> durations;
+        string durationsDigest;
+        string testCaseId;
+        while (*in >> key >> testCaseId) {
+            if (key == "partitioned") {
+                durationsDigest = testCaseId;
+            } else if (key == "generated") {
+                generatedTestCaseIds.push_back(testCaseId);
+            } else if (key == "failed") {
+                failedTestCaseIds.push_back(testCaseId);
+            } else if (key == "duration") {
+                if (!(*in >> durations[testCaseId])) {
+                    throw runtime_error("Malformed shard manifest duration of " + testCaseId);
+                }
+            } else {
+                throw runtime_error("Malformed shard manifest entry: " + key);
+            }
+        }
+        return ShardManifest(
+                shardIndex,
+                shardsCount,
+                seed,
+                fingerprint,
+                generatedTestCaseIds,
+                failedTestCaseIds,
+                durations,
+                durationsDigest);
+    }
+
+    bool operator==(const ShardManifest& o) const {
+        return tie(shardIndex_, shardsCount_, seed_, fingerprint_, generatedTestCaseIds_, failedTestCaseIds_,
+                   durations_, durationsDigest_) ==
+                tie(o.shardIndex_, o.shardsCount_, o.seed_, o.fingerprint_, o.generatedTestCaseIds_,
+                    o.failedTestCaseIds_, o.durations_, o.durationsDigest_);
+    }
+};
+
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GeneratorConfig.hpp"
+#include "tcframe/testcase.hpp"
+#include "tcframe/util.hpp"
+
+using std::map;
+using std::min_element;
+using std::stable_sort;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+class Sharding {
+public:
+    Sharding() = delete;
+
+    /*
+     * Assigns every test case to a shard, returning the shard index by test case id. Without known durations, test
+     * cases are assigned by a hash of their ids, so that the assignment does not depend on the machine, and adding a
+     * test case does not move the others to different shards. Otherwise, the test cases are balanced by the longest-processing-time-first rule:
+     * from the longest to the shortest, each test case goes to the shard with the least total duration so far, so that
+     * a few long test cases do not end up in the same shard. Test cases without a known duration are assumed to take
+     * the average duration. Every shard must be given the same durations to compute the same assignment.
+     */
+    static map<string, int> assign(
+            const TestSuite& testSuite,
+            int shardsCount,
+            const map<string, double>& durations = map<string, double>()) {
+
+        vector<string> testCaseIds;
+        double knownDurationsSum = 0;
+        int knownDurationsCount = 0;
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                testCaseIds.push_back(testCase.id());
+                auto duration = durations.find(testCase.id());
+                if (duration != durations.end()) {
+                    knownDurationsSum += duration->second;
+                    knownDurationsCount++;
+                }
+            }
+        }
+
+        map<string, int> shardIndices;
+        if (knownDurationsCount == 0) {
+            for (const string& testCaseId : testCaseIds) {
+                shardIndices[testCaseId] = (int) (hash(testCaseId) % shardsCount) + 1;
+            }
+            return shardIndices;
+        }
+
+        double averageDuration = knownDurationsSum / knownDurationsCount;
+        vector<double> testCaseDurations;
+        vector<int> order;
+        for (int i = 0; i < testCaseIds.size(); i++) {
+            auto duration = durations.find(testCaseIds[i]);
+            testCaseDurations.push_back(duration != durations.end() ? duration->second : averageDuration);
+            order.push_back(i);
+        }
+        stable_sort(order.begin(), order.end(), [&] (int i, int j) {
+            return testCaseDurations[i] > testCaseDurations[j];
+        });
+
+        vector<double> shardDurations(shardsCount, 0.0);
+        for (int i : order) {
+            int shard = (int) (min_element(shardDurations.begin(), shardDurations.end()) - shardDurations.begin());
+            shardDurations[shard] += testCaseDurations[i];
+            shardIndices[testCaseIds[i]] = shard + 1;
+        }
+        return shardIndices;
+    }
+
+    /*
+     * Identifies the durations that the test cases are assigned to the shards with, as written in a duration profile;
+     * empty if there are none, and the test cases are assigned by the hashes of their ids.
+     */
+    static string durationsDigest(const map<string, double>& durations) {
+        if (durations.empty()) {
+            return "";
+        }
+        XxHash64 hash;
+        for (const auto& entry : durations) {
+            char formatted[32];
+            snprintf(formatted, sizeof(formatted), " %.3f\n", entry.second);
+            hash.update(entry.first + formatted);
+        }
+        return XxHash64::toHex(hash.digest());
+    }
+
+    /*
+     * Identifies what a generation produces: the slug, whether test cases are combined, the id, description and
+     * subtasks of every test case, and the digest of the durations that the test cases are assigned to the shards
+     * with, if any. Shards are only merged if they were generated from the same spec and partitioned the same way.
+     */
+    static string fingerprint(
+            const TestSuite& testSuite,
+            const GeneratorConfig& config,
+            const string& durationsDigest = "") {
+
+        string canonical = config.slug() + "\n" + (config.multipleTestCasesCount() != nullptr ? "multiple" : "single");
+        if (!durationsDigest.empty()) {
+            canonical += "\ndurations " + durationsDigest;
+        }
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            canonical += "\ngroup " + StringUtils::toString(testGroup.id());
+            for (const TestCase& testCase : testGroup.testCases()) {
+                canonical += "\ncase " + testCase.id() + " " + testCase.description() + " subtasks";
+                for (int subtaskId : testCase.subtaskIds()) {
+                    canonical += " " + StringUtils::toString(subtaskId);
+                }
+            }
+        }
+
+        char formatted[17];
+        snprintf(formatted, sizeof(formatted), "%016llx", hash(canonical));
+        return formatted;
+    }
+
+    static string manifestFilename(const string& testCasesDir, int shardIndex, int shardsCount) {
+        return testCasesDir + "/shard-" + StringUtils::toString(shardIndex)
+               + "-of-" + StringUtils::toString(shardsCount) + ".manifest";
+    }
+
+    static bool isManifestFilename(const string& filename) {
+        string suffix = ".manifest";
+        return filename.compare(0, 6, "shard-") == 0
+               && filename.size() > suffix.size()
+               && filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+private:
+    // 64-bit FNV-1a.
+    static unsigned long long hash(const string& s) {
+        unsigned long long h = 14695981039346656037ULL;
+        for (char c : s) {
+            h ^= (unsigned char) c;
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+};
+
+}
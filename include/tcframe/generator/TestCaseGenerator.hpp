@@ -1,23 +1,37 @@
 #pragma once
 
+#include <cstring>
 #include <iostream>
 #include <functional>
+#include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
+#include "DuplicateDetector.hpp"
+#include "DurationProfile.hpp"
+#include "FileManifest.hpp"
 #include "GenerationException.hpp"
+#include "GenerationJournal.hpp"
 #include "GeneratorConfig.hpp"
 #include "GeneratorLogger.hpp"
+#include "InputStatisticsTable.hpp"
+#include "TestCaseMetrics.hpp"
 #include "tcframe/io_manipulator.hpp"
 #include "tcframe/os.hpp"
 #include "tcframe/spec.hpp"
 #include "tcframe/testcase.hpp"
+#include "tcframe/util.hpp"
 #include "tcframe/verifier.hpp"
 
 using std::endl;
 using std::function;
+using std::ios;
 using std::set;
+using std::streamsize;
 using std::string;
+using std::unique_ptr;
+using std::vector;
 
 namespace tcframe {
 
@@ -27,6 +41,12 @@ private:
     IOManipulator* ioManipulator_;
     OperatingSystem* os_;
     GeneratorLogger* logger_;
+    FileManifest* fileManifest_;
+    DuplicateDetector* duplicateDetector_;
+    InputStatisticsTable* inputStatisticsTable_;
+    DurationProfile* durationProfile_;
+    GenerationJournal* journal_;
+    Tracer* tracer_;
 
 public:
     virtual ~TestCaseGenerator() {}
@@ -35,42 +55,201 @@ public:
             Verifier* verifier,
             IOManipulator* ioManipulator,
             OperatingSystem* os,
-            GeneratorLogger* logger)
+            GeneratorLogger* logger,
+            FileManifest* fileManifest = nullptr,
+            DuplicateDetector* duplicateDetector = nullptr,
+            InputStatisticsTable* inputStatisticsTable = nullptr,
+            DurationProfile* durationProfile = nullptr,
+            GenerationJournal* journal = nullptr,
+            Tracer* tracer = nullptr)
             : verifier_(verifier)
             , ioManipulator_(ioManipulator)
             , os_(os)
-            , logger_(logger) {}
+            , logger_(logger)
+            , fileManifest_(fileManifest)
+            , duplicateDetector_(duplicateDetector)
+            , inputStatisticsTable_(inputStatisticsTable)
+            , durationProfile_(durationProfile)
+            , journal_(journal)
+            , tracer_(tracer) {}
+
+    /* Returns the manifest that the digests of the generated files are recorded into, if any. */
+    virtual FileManifest* fileManifest() const {
+        return fileManifest_;
+    }
+
+    /* Returns the detector that the inputs of the generated test cases are recorded into, if any. */
+    virtual DuplicateDetector* duplicateDetector() const {
+        return duplicateDetector_;
+    }
+
+    /* Returns the table that the statistics of the inputs of the generated test cases are recorded into, if any. */
+    virtual InputStatisticsTable* inputStatisticsTable() const {
+        return inputStatisticsTable_;
+    }
+
+    /* Returns the profile that the durations of the generated test cases are recorded into, if any. */
+    virtual DurationProfile* durationProfile() const {
+        return durationProfile_;
+    }
+
+    /* Returns the journal that the generated test cases are recorded into, if any. */
+    virtual GenerationJournal* journal() const {
+        return journal_;
+    }
+
+    /* Returns the tracer that the stages of the generated test cases are recorded into, if any. */
+    virtual Tracer* tracer() const {
+        return tracer_;
+    }
 
     virtual bool generate(const TestCase& testCase, const GeneratorConfig& config) {
+        TraceSpan span(tracer_, "generate", "testCase", testCase.id());
         logger_->logTestCaseIntroduction(testCase.id());
 
         string inputFilename = config.testCasesDir() + "/" + testCase.id() + ".in";
         string outputFilename = config.testCasesDir() + "/" + testCase.id() + ".out";
 
+        if (fileManifest_ != nullptr) {
+            fileManifest_->remove(testCase.id() + ".in");
+            fileManifest_->remove(testCase.id() + ".out");
+        }
+        if (inputStatisticsTable_ != nullptr) {
+            inputStatisticsTable_->remove(testCase.id());
+            ioManipulator_->collectInputStatistics();
+        }
+        if (durationProfile_ != nullptr) {
+            durationProfile_->remove(testCase.id());
+        }
+
+        TestCaseMetricsBuilder metrics;
+        bool successful = true;
         try {
-            apply(testCase.applier());
+            if (journal_ != nullptr && !config.dryRun()) {
+                // Otherwise, an interruption would leave the files half-written but still journaled.
+                journal_->remove(testCase.id());
+            }
+            Stopwatch stopwatch;
+            if (config.fromSnapshots()) {
+                restoreSnapshot(snapshotFilename(testCase, config));
+            } else {
+                apply(testCase.applier());
+            }
+            endStage("apply", testCase, stopwatch, metrics);
             verify(testCase.subtaskIds());
-            generateInput(inputFilename, config);
-            generateOutput(inputFilename, outputFilename, config.solutionCommand());
+            endStage("verify", testCase, stopwatch, metrics);
+            if (config.snapshotDir() && !config.fromSnapshots() && !config.dryRun()) {
+                writeSnapshot(snapshotFilename(testCase, config));
+                endStage("snapshot", testCase, stopwatch, metrics);
+            }
+            optional<FileDigest> inputDigest;
+            optional<FileDigest> outputDigest;
+            optional<MinHashSignature> inputSignature;
+            if (!config.dryRun()) {
+                inputDigest = generateInput(inputFilename, config, inputSignature);
+                metrics.setInputSize(inputDigest.value().size());
+                endStage("print", testCase, stopwatch, metrics);
+            }
+            if (!config.dryRun() && !config.noOutput()) {
+                ExecutionResult result = config.alternativeSolutionCommands().empty()
+                        ? execute(inputFilename, outputFilename, scratchFilename(testCase, "error", config),
+                                  config.solutionCommand())
+                        : executeCrossChecked(testCase, inputFilename, outputFilename, config, metrics);
+                endStage("execute", testCase, stopwatch, metrics);
+                outputDigest = parseOutput(result);
+                metrics.setOutputSize(outputDigest.value().size());
+                endStage("parse", testCase, stopwatch, metrics);
+            }
+            if (fileManifest_ != nullptr && inputDigest) {
+                fileManifest_->record(testCase.id() + ".in", inputDigest.value());
+            }
+            if (fileManifest_ != nullptr && outputDigest) {
+                fileManifest_->record(testCase.id() + ".out", outputDigest.value());
+            }
+            if (duplicateDetector_ != nullptr && inputDigest) {
+                duplicateDetector_->record(testCase.id(), inputDigest.value(), inputSignature);
+            }
+            if (inputStatisticsTable_ != nullptr && inputDigest) {
+                inputStatisticsTable_->record(
+                        testCase.id(),
+                        inputDigest.value().size(),
+                        ioManipulator_->inputStatistics());
+            }
+            if (journal_ != nullptr && !config.dryRun()) {
+                journalFiles(testCase, inputFilename, outputFilename, config);
+            }
         } catch (GenerationException& e) {
             logger_->logTestCaseFailedResult(testCase.description());
             e.callback()();
-            return false;
+            successful = false;
         } catch (runtime_error& e) {
             logger_->logTestCaseFailedResult(testCase.description());
             logger_->logSimpleFailure(e.what());
-            return false;
+            successful = false;
         }
 
-        logger_->logTestCaseSuccessfulResult();
-        return true;
+        TestCaseMetrics builtMetrics = metrics.build();
+        if (successful) {
+            logger_->logTestCaseSuccessfulResult();
+            if (durationProfile_ != nullptr && !config.dryRun()) {
+                durationProfile_->record(testCase.id(), builtMetrics.totalDuration());
+            }
+        }
+        logger_->logTestCaseMetrics(testCase, builtMetrics);
+        return successful;
     }
 
 private:
+    /* The files are made durable first, as a resumed generation trusts every journaled test case whose files exist. */
+    void journalFiles(
+            const TestCase& testCase,
+            const string& inputFilename,
+            const string& outputFilename,
+            const GeneratorConfig& config) {
+
+        os_->syncFile(inputFilename);
+        if (!config.noOutput()) {
+            os_->syncFile(outputFilename);
+        }
+        journal_->record(testCase.id(), GenerationJournal::fingerprint(testCase, config));
+    }
+
+    /* Records the duration of the stage that just ended into the metrics, and into the trace if there is one. */
+    void endStage(
+            const char* stage,
+            const TestCase& testCase,
+            Stopwatch& stopwatch,
+            TestCaseMetricsBuilder& metrics) {
+
+        double seconds = stopwatch.lap();
+        metrics.addStageDuration(stage, seconds);
+        if (tracer_ != nullptr) {
+            long long endMicros = tracer_->nowMicros();
+            tracer_->record(stage, "testCase", testCase.id(), endMicros - (long long) (seconds * 1e6), endMicros);
+        }
+    }
+
     void apply(const function<void()>& applier) {
         applier();
     }
 
+    static string snapshotFilename(const TestCase& testCase, const GeneratorConfig& config) {
+        return config.snapshotDir().value() + "/" + testCase.id() + ".snap";
+    }
+
+    void writeSnapshot(const string& snapshotFilename) {
+        ScopedWritingStream snapshot(os_, os_->openForWriting(snapshotFilename));
+        ioManipulator_->snapshotInput(snapshot.get());
+    }
+
+    void restoreSnapshot(const string& snapshotFilename) {
+        unique_ptr<istream> snapshot(os_->openForReading(snapshotFilename));
+        if (snapshot->fail()) {
+            throw runtime_error("Cannot read snapshot " + snapshotFilename);
+        }
+        ioManipulator_->restoreInput(snapshot.get());
+    }
+
     void verify(const set<int>& subtaskIds) {
         ConstraintsVerificationResult result = verifier_->verifyConstraints(subtaskIds);
         if (!result.isValid()) {
@@ -78,21 +257,148 @@ private:
         }
     }
 
-    void generateInput(const string& inputFilename, const GeneratorConfig& config) {
-        ostream* testCaseInput = os_->openForWriting(inputFilename);
+    /* Also computes the signature of the input, if near-duplicates are detected. */
+    FileDigest generateInput(
+            const string& inputFilename,
+            const GeneratorConfig& config,
+            optional<MinHashSignature>& signature) {
+
+        ScopedWritingStream testCaseInput(os_, os_->openForWriting(inputFilename));
+        if (fileManifest_ == nullptr && duplicateDetector_ == nullptr) {
+            printInput(testCaseInput.get(), config);
+            return FileDigest(0, testCaseInput.get()->tellp());
+        }
+
+        // The input is hashed while it is written, rather than read back afterwards.
+        HashingStreamBuf hashingBuf(testCaseInput.get()->rdbuf());
+        if (duplicateDetector_ == nullptr || !config.nearDuplicateSimilarity()) {
+            ostream hashingInput(&hashingBuf);
+            printInput(&hashingInput, config);
+            hashingInput.flush();
+        } else {
+            MinHashStreamBuf minHashBuf(&hashingBuf);
+            ostream sketchingInput(&minHashBuf);
+            printInput(&sketchingInput, config);
+            sketchingInput.flush();
+            signature = optional<MinHashSignature>(minHashBuf.signature());
+        }
+        return FileDigest(hashingBuf.digest(), hashingBuf.size());
+    }
+
+    void printInput(ostream* out, const GeneratorConfig& config) {
         if (config.multipleTestCasesCount() != nullptr) {
-            *testCaseInput << "1" << endl;
+            *out << "1" << endl;
         }
-        ioManipulator_->printInput(testCaseInput);
-        os_->closeOpenedWritingStream(testCaseInput);
+        ioManipulator_->printInput(out);
+    }
+
+    /*
+     * A file that the solutions write temporarily while the test case is generated. It is named after the test case
+     * and kept in the test cases directory, so that shards generating into other directories do not share it.
+     */
+    static string scratchFilename(const TestCase& testCase, const string& name, const GeneratorConfig& config) {
+        return config.testCasesDir() + "/_" + testCase.id() + "_" + name + ".tmp";
     }
 
-    void generateOutput(const string& inputFilename, const string& outputFilename, const string& solutionCommand) {
-        ExecutionResult result = os_->execute(solutionCommand, inputFilename, outputFilename, "_error.out");
+    ExecutionResult execute(
+            const string& inputFilename,
+            const string& outputFilename,
+            const string& errorFilename,
+            const string& solutionCommand) {
+
+        ExecutionResult result = os_->execute(solutionCommand, inputFilename, outputFilename, errorFilename);
         if (result.exitStatus() != 0) {
             throw GenerationException([=] {logger_->logSolutionExecutionFailure(result);});
         }
-        ioManipulator_->parseOutput(result.outputStream());
+        return result;
+    }
+
+    /*
+     * Runs the solution and the alternative solutions concurrently on the input, and fails unless all of them exit
+     * successfully with the same output as the solution. Returns the result of the solution.
+     */
+    ExecutionResult executeCrossChecked(
+            const TestCase& testCase,
+            const string& inputFilename,
+            const string& outputFilename,
+            const GeneratorConfig& config,
+            TestCaseMetricsBuilder& metrics) {
+
+        vector<string> commands = {config.solutionCommand()};
+        vector<string> outputFilenames = {outputFilename};
+        vector<string> errorFilenames = {scratchFilename(testCase, "error", config)};
+        for (const string& alternativeSolutionCommand : config.alternativeSolutionCommands()) {
+            outputFilenames.push_back(
+                    scratchFilename(testCase, "alternative_" + StringUtils::toString(commands.size()), config));
+            errorFilenames.push_back("");
+            commands.push_back(alternativeSolutionCommand);
+        }
+
+        vector<ExecutionResult> results =
+                os_->executeConcurrently(commands, inputFilename, outputFilenames, errorFilenames);
+        for (int i = 0; i < commands.size(); i++) {
+            metrics.addSolutionDuration(commands[i], results[i].durationInSeconds());
+        }
+
+        ExecutionResult result = results[0];
+        vector<string> disagreements;
+        for (int i = 1; i < commands.size() && result.exitStatus() == 0; i++) {
+            if (results[i].exitStatus() != 0) {
+                disagreements.push_back(commands[i] + ": " + results[i].describeExitStatus());
+            } else if (!haveSameContents(result.outputStream(), results[i].outputStream())) {
+                disagreements.push_back(commands[i] + ": different output");
+            }
+        }
+        for (int i = 1; i < commands.size(); i++) {
+            os_->removeFile(outputFilenames[i]);
+        }
+
+        if (result.exitStatus() != 0) {
+            throw GenerationException([=] {logger_->logSolutionExecutionFailure(result);});
+        }
+        if (!disagreements.empty()) {
+            throw GenerationException([=] {logger_->logSolutionsDisagreement(disagreements);});
+        }
+        return result;
+    }
+
+    /* Compares the outputs byte by byte, and rewinds the solution output afterwards. */
+    static bool haveSameContents(istream* output, istream* alternativeOutput) {
+        static const int CHUNK_SIZE = 1 << 16;
+        vector<char> chunk(CHUNK_SIZE);
+        vector<char> alternativeChunk(CHUNK_SIZE);
+
+        bool same = true;
+        streamsize readCount;
+        do {
+            output->read(&chunk[0], CHUNK_SIZE);
+            alternativeOutput->read(&alternativeChunk[0], CHUNK_SIZE);
+            readCount = output->gcount();
+            if (readCount != alternativeOutput->gcount() || memcmp(&chunk[0], &alternativeChunk[0], readCount) != 0) {
+                same = false;
+                break;
+            }
+        } while (readCount == CHUNK_SIZE);
+
+        output->clear();
+        output->seekg(0, ios::beg);
+        return same;
+    }
+
+    /* The output is hashed while it is parsed, if there is a manifest to record it; otherwise, only its size is taken. */
+    FileDigest parseOutput(const ExecutionResult& result) {
+        istream* in = result.outputStream();
+        if (fileManifest_ == nullptr) {
+            in->seekg(0, ios::end);
+            long long size = in->tellg();
+            in->seekg(0, ios::beg);
+            ioManipulator_->parseOutput(in);
+            return FileDigest(0, size);
+        }
+        HashingInputStreamBuf hashingBuf(in->rdbuf());
+        istream hashingIn(&hashingBuf);
+        ioManipulator_->parseOutput(&hashingIn);
+        return FileDigest(hashingBuf.digest(), hashingBuf.size());
     }
 };
 
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "tcframe/util.hpp"
+
+using std::make_pair;
+using std::move;
+using std::pair;
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+struct TestCaseMetrics {
+    friend class TestCaseMetricsBuilder;
+
+private:
+    vector<pair<string, double>> stageDurations_;
+    optional<long long> inputSize_;
+    optional<long long> outputSize_;
+    vector<pair<string, double>> solutionDurations_;
+
+public:
+    /* Durations in seconds, in the order in which the stages were run. */
+    const vector<pair<string, double>>& stageDurations() const {
+        return stageDurations_;
+    }
+
+    double totalDuration() const {
+        double total = 0;
+        for (const auto& stageDuration : stageDurations_) {
+            total += stageDuration.second;
+        }
+        return total;
+    }
+
+    const optional<long long>& inputSize() const {
+        return inputSize_;
+    }
+
+    const optional<long long>& outputSize() const {
+        return outputSize_;
+    }
+
+    /* Durations in seconds of the solution and the alternative solutions, when they are cross-checked. */
+    const vector<pair<string, double>>& solutionDurations() const {
+        return solutionDurations_;
+    }
+
+    /* The command of the slowest cross-checked solution, if any. */
+    optional<string> slowestSolution() const {
+        optional<string> slowest;
+        double slowestDuration = -1;
+        for (const auto& solutionDuration : solutionDurations_) {
+            if (solutionDuration.second > slowestDuration) {
+                slowest = optional<string>(solutionDuration.first);
+                slowestDuration = solutionDuration.second;
+            }
+        }
+        return slowest;
+    }
+
+    bool operator==(const TestCaseMetrics& o) const {
+        return tie(stageDurations_, inputSize_, outputSize_, solutionDurations_) ==
+                tie(o.stageDurations_, o.inputSize_, o.outputSize_, o.solutionDurations_);
+    }
+};
+
+class TestCaseMetricsBuilder {
+private:
+    TestCaseMetrics subject_;
+
+public:
+    TestCaseMetricsBuilder& addStageDuration(string stage, double seconds) {
+        subject_.stageDurations_.push_back(make_pair(stage, seconds));
+        return *this;
+    }
+
+    TestCaseMetricsBuilder& setInputSize(long long inputSize) {
+        subject_.inputSize_ = optional<long long>(inputSize);
+        return *this;
+    }
+
+    TestCaseMetricsBuilder& setOutputSize(long long outputSize) {
+        subject_.outputSize_ = optional<long long>(outputSize);
+        return *this;
+    }
+
+    TestCaseMetricsBuilder& addSolutionDuration(string solutionCommand, double seconds) {
+        subject_.solutionDurations_.push_back(make_pair(solutionCommand, seconds));
+        return *this;
+    }
+
+    TestCaseMetrics build() {
+        return move(subject_);
+    }
+};
+
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "tcframe/io_manipulator/EdgesIOSegmentManipulator.hpp"
 #include "tcframe/io_manipulator/GridIOSegmentManipulator.hpp"
 #include "tcframe/io_manipulator/IOManipulator.hpp"
 #include "tcframe/io_manipulator/LineIOSegmentManipulator.hpp"
 #include "tcframe/io_manipulator/LinesIOSegmentManipulator.hpp"
+#include "tcframe/io_manipulator/TypedIOSegmentManipulator.hpp"
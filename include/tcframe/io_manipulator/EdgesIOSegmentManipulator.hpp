@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LinesIOSegmentManipulator.hpp"
+#include "tcframe/spec/io.hpp"
+#include "tcframe/spec/variable.hpp"
+#include "tcframe/util.hpp"
+
+using std::istream;
+using std::max;
+using std::min;
+using std::ostream;
+using std::runtime_error;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Prints and parses edge lists. The endpoints are accessed through their concrete vector<int> storage, and the
+ * optional checks of the segment are run on each edge as it is printed or parsed.
+ */
+class EdgesIOSegmentManipulator {
+public:
+    EdgesIOSegmentManipulator() = delete;
+
+    static void parse(EdgesIOSegment* segment, istream* in) {
+        VectorImpl<int>* from = segment->from();
+        VectorImpl<int>* to = segment->to();
+        Vector* weight = segment->weight();
+
+        from->clear();
+        to->clear();
+        if (weight != nullptr) {
+            weight->clear();
+        }
+
+        EdgeChecker checker(segment);
+        for (int j = 0; j < segment->size(); j++) {
+            from->parseAndAddElementFrom(in);
+            if (!WhitespaceManipulator::skipSpace(in)) {
+                WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(from->name(), j));
+            }
+            to->parseAndAddElementFrom(in);
+
+            const string* lastName = &to->name();
+            if (weight != nullptr) {
+                if (!WhitespaceManipulator::skipSpace(in)) {
+                    WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(to->name(), j));
+                }
+                weight->parseAndAddElementFrom(in);
+                lastName = &weight->name();
+            }
+            if (!WhitespaceManipulator::skipNewline(in)) {
+                WhitespaceManipulator::parseNewline(in, TokenFormatter::formatVectorElement(*lastName, j));
+            }
+
+            checker.check(j, from->value()[j], to->value()[j]);
+        }
+    }
+
+    static void print(EdgesIOSegment* segment, ostream* out) {
+        VectorImpl<int>* from = segment->from();
+        VectorImpl<int>* to = segment->to();
+        Vector* weight = segment->weight();
+
+        LinesIOSegmentManipulator::checkVariableSize(from, segment->size());
+        LinesIOSegmentManipulator::checkVariableSize(to, segment->size());
+        if (weight != nullptr) {
+            LinesIOSegmentManipulator::checkVariableSize(weight, segment->size());
+        }
+
+        const vector<int>& u = from->value();
+        const vector<int>& v = to->value();
+        EdgeChecker checker(segment);
+        for (int j = 0; j < segment->size(); j++) {
+            checker.check(j, u[j], v[j]);
+            *out << u[j] << ' ' << v[j];
+            if (weight != nullptr) {
+                *out << ' ';
+                weight->printElementTo(j, out);
+            }
+            *out << '\n';
+        }
+        if (from->statistics() != nullptr) {
+            from->statistics()->addAll(u.begin(), u.end());
+        }
+        if (to->statistics() != nullptr) {
+            to->statistics()->addAll(v.begin(), v.end());
+        }
+    }
+
+private:
+    class EdgeChecker {
+    private:
+        EdgesIOSegment* segment_;
+        unordered_map<unsigned long long, int> edgeIndexByVertices_;
+
+    public:
+        explicit EdgeChecker(EdgesIOSegment* segment)
+                : segment_(segment) {
+            if (segment->noMultiEdges()) {
+                edgeIndexByVertices_.reserve((size_t) segment->size());
+            }
+        }
+
+        void check(int j, int u, int v) {
+            if (segment_->vertexRange()) {
+                checkVertex(segment_->from()->name(), j, u);
+                checkVertex(segment_->to()->name(), j, v);
+            }
+            if (segment_->noSelfLoops() && u == v) {
+                throw runtime_error("Edge " + formatEdge(j) + " is a self-loop on vertex " + StringUtils::toString(u));
+            }
+            if (segment_->noMultiEdges()) {
+                unsigned long long key = ((unsigned long long) (unsigned) min(u, v) << 32) | (unsigned) max(u, v);
+                auto inserted = edgeIndexByVertices_.insert({key, j});
+                if (!inserted.second) {
+                    throw runtime_error(
+                            "Edge " + formatEdge(j) + " duplicates edge " + formatEdge(inserted.first->second));
+                }
+            }
+        }
+
+    private:
+        void checkVertex(const string& name, int j, int vertex) {
+            int minVertex = segment_->vertexRange().value().first;
+            int maxVertex = segment_->vertexRange().value().second;
+            if (vertex < minVertex || vertex > maxVertex) {
+                throw runtime_error("Vertex " + TokenFormatter::formatVectorElement(name, j) + " = "
+                                    + StringUtils::toString(vertex) + " is out of range ["
+                                    + StringUtils::toString(minVertex) + ", "
+                                    + StringUtils::toString(maxVertex) + "]");
+            }
+        }
+
+        string formatEdge(int j) {
+            return "(" + TokenFormatter::formatVectorElement(segment_->from()->name(), j) + ", "
+                   + TokenFormatter::formatVectorElement(segment_->to()->name(), j) + ")";
+        }
+    };
+};
+
+}
@@ -24,28 +24,24 @@ public:
     }
 
     static void print(GridIOSegment* segment, ostream* out) {
-        checkMatrixSize(segment);
-
         Matrix* variable = segment->variable();
+        checkMatrixSize(variable, segment->rows(), segment->columns());
         variable->printTo(out);
     }
 
-private:
-    static void checkMatrixSize(GridIOSegment* segment) {
-        Matrix* variable = segment->variable();
-
-        if (variable->rows() != segment->rows()) {
+    static void checkMatrixSize(Matrix* variable, int rows, int columns) {
+        if (variable->rows() != rows) {
             throw runtime_error(
                     "Number of rows of matrix " + TokenFormatter::formatVariable(variable->name())
-                    + " unsatisfied. Expected: " + StringUtils::toString(segment->rows())
+                    + " unsatisfied. Expected: " + StringUtils::toString(rows)
                     + ", actual: " + StringUtils::toString(variable->rows()));
         }
         for (int r = 0; r < variable->rows(); r++) {
-            if (variable->columns(r) != segment->columns()) {
+            if (variable->columns(r) != columns) {
                 throw runtime_error(
                         "Number of columns of row " + StringUtils::toString(r)
                         + " of matrix " + TokenFormatter::formatVariable(variable->name())
-                        + " unsatisfied. Expected: " + StringUtils::toString(segment->columns())
+                        + " unsatisfied. Expected: " + StringUtils::toString(columns)
                         + ", actual: " + StringUtils::toString(variable->columns(r)));
             }
         }
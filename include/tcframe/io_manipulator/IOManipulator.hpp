@@ -1,17 +1,23 @@
 #pragma once
 
 #include <iostream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
+#include "EdgesIOSegmentManipulator.hpp"
 #include "GridIOSegmentManipulator.hpp"
 #include "tcframe/spec/io.hpp"
 #include "tcframe/spec/variable.hpp"
 #include "LineIOSegmentManipulator.hpp"
 #include "LinesIOSegmentManipulator.hpp"
+#include "TypedIOSegmentManipulator.hpp"
 
 using std::endl;
 using std::istream;
 using std::ostream;
+using std::runtime_error;
+using std::string;
 using std::vector;
 
 namespace tcframe {
@@ -19,29 +25,136 @@ namespace tcframe {
 class IOManipulator {
 private:
     IOFormat ioFormat_;
+    vector<Variable*> statisticsVariables_;
+    vector<VariableStatistics> inputStatistics_;
 
 public:
-    virtual ~IOManipulator() {}
+    virtual ~IOManipulator() {
+        for (Variable* variable : statisticsVariables_) {
+            variable->setStatistics(nullptr);
+        }
+    }
 
     IOManipulator(const IOFormat& ioFormat)
             : ioFormat_(ioFormat) {}
 
     virtual void printInput(ostream* out) {
-        print(ioFormat_.inputFormat(), out);
+        for (VariableStatistics& statistics : inputStatistics_) {
+            statistics.clear();
+        }
+        print(ioFormat_.inputFormat(), ioFormat_.typedInputFormat(), out);
+    }
+
+    /* Makes the following printInput() calls gather the statistics of the values of the input variables. */
+    virtual void collectInputStatistics() {
+        if (!statisticsVariables_.empty()) {
+            return;
+        }
+        statisticsVariables_ = inputVariables();
+        for (Variable* variable : statisticsVariables_) {
+            inputStatistics_.push_back(VariableStatistics(variable->name(), variable->type()));
+        }
+        for (int i = 0; i < statisticsVariables_.size(); i++) {
+            statisticsVariables_[i]->setStatistics(&inputStatistics_[i]);
+        }
+    }
+
+    /* The statistics of the input variables in the last printed input, in the order of the input format. */
+    virtual vector<VariableStatistics> inputStatistics() const {
+        return inputStatistics_;
     }
 
     virtual void parseInput(istream* in) {
-        parse(ioFormat_.inputFormat(), in);
+        parse(ioFormat_.inputFormat(), ioFormat_.typedInputFormat(), in);
+        WhitespaceManipulator::ensureEof(in);
+    }
+
+    /* Parses a single test case of a multiple test cases input, which may be followed by other test cases. */
+    virtual void parseInputWithoutEof(istream* in) {
+        parse(ioFormat_.inputFormat(), ioFormat_.typedInputFormat(), in);
     }
 
     virtual void parseOutput(istream* in) {
-        if (!ioFormat_.outputFormat().empty()) {
-            parse(ioFormat_.outputFormat(), in);
+        if (ioFormat_.hasOutputFormat()) {
+            parse(ioFormat_.outputFormat(), ioFormat_.typedOutputFormat(), in);
+            WhitespaceManipulator::ensureEof(in);
+        }
+    }
+
+    /*
+     * Writes the values of the variables of the input format, so that restoreInput() can later bring them back without
+     * running the test case closure again.
+     */
+    virtual void snapshotInput(ostream* out) {
+        vector<Variable*> variables = inputVariables();
+        SnapshotCodec::write(out, snapshotMagic());
+        SnapshotCodec::writeSize(out, variables.size());
+        for (Variable* variable : variables) {
+            SnapshotCodec::write(out, variable->name());
+            variable->snapshotTo(out);
+        }
+    }
+
+    virtual void restoreInput(istream* in) {
+        string magic;
+        SnapshotCodec::read(in, magic);
+        if (magic != snapshotMagic()) {
+            throw runtime_error("Snapshot is not a tcframe snapshot");
+        }
+
+        vector<Variable*> variables = inputVariables();
+        if (SnapshotCodec::readSize(in) != variables.size()) {
+            throw runtime_error("Snapshot does not match the input format");
+        }
+        for (Variable* variable : variables) {
+            string name;
+            SnapshotCodec::read(in, name);
+            if (name != variable->name()) {
+                throw runtime_error("Snapshot does not match the input format");
+            }
+            variable->restoreFrom(in);
         }
     }
 
 private:
-    void print(const vector<IOSegment*>& segments, ostream* out) {
+    static string snapshotMagic() {
+        return "tcframe-snapshot-1";
+    }
+
+    vector<Variable*> inputVariables() {
+        if (ioFormat_.typedInputFormat() != nullptr) {
+            return ioFormat_.typedInputFormat()->variables();
+        }
+
+        vector<Variable*> variables;
+        for (IOSegment* segment : ioFormat_.inputFormat()) {
+            if (segment->type() == IOSegmentType::GRID) {
+                variables.push_back(((GridIOSegment*) segment)->variable());
+            } else if (segment->type() == IOSegmentType::LINE) {
+                for (const LineIOSegmentVariable& segmentVariable : ((LineIOSegment*) segment)->variables()) {
+                    variables.push_back(segmentVariable.variable());
+                }
+            } else if (segment->type() == IOSegmentType::LINES) {
+                const vector<Variable*>& segmentVariables = ((LinesIOSegment*) segment)->variables();
+                variables.insert(variables.end(), segmentVariables.begin(), segmentVariables.end());
+            } else if (segment->type() == IOSegmentType::EDGES) {
+                EdgesIOSegment* edgesSegment = (EdgesIOSegment*) segment;
+                variables.push_back(edgesSegment->from());
+                variables.push_back(edgesSegment->to());
+                if (edgesSegment->weight() != nullptr) {
+                    variables.push_back(edgesSegment->weight());
+                }
+            }
+        }
+        return variables;
+    }
+
+    void print(const vector<IOSegment*>& segments, TypedIOFormat* typedFormat, ostream* out) {
+        if (typedFormat != nullptr) {
+            typedFormat->print(out);
+            return;
+        }
+
         for (IOSegment* segment : segments) {
             if (segment->type() == IOSegmentType::GRID) {
                 GridIOSegmentManipulator::print((GridIOSegment*) segment, out);
@@ -49,11 +162,18 @@ private:
                 LineIOSegmentManipulator::print((LineIOSegment*) segment, out);
             } else if (segment->type() == IOSegmentType::LINES) {
                 LinesIOSegmentManipulator::print((LinesIOSegment*) segment, out);
+            } else if (segment->type() == IOSegmentType::EDGES) {
+                EdgesIOSegmentManipulator::print((EdgesIOSegment*) segment, out);
             }
         }
     }
 
-    void parse(const vector<IOSegment*>& segments, istream* in) {
+    void parse(const vector<IOSegment*>& segments, TypedIOFormat* typedFormat, istream* in) {
+        if (typedFormat != nullptr) {
+            typedFormat->parse(in);
+            return;
+        }
+
         for (IOSegment* segment : segments) {
             if (segment->type() == IOSegmentType::GRID) {
                 GridIOSegmentManipulator::parse((GridIOSegment*) segment, in);
@@ -61,9 +181,10 @@ private:
                 LineIOSegmentManipulator::parse((LineIOSegment*) segment, in);
             } else if (segment->type() == IOSegmentType::LINES) {
                 LinesIOSegmentManipulator::parse((LinesIOSegment*) segment, in);
+            } else if (segment->type() == IOSegmentType::EDGES) {
+                EdgesIOSegmentManipulator::parse((EdgesIOSegment*) segment, in);
             }
         }
-        WhitespaceManipulator::ensureEof(in);
     }
 };
 
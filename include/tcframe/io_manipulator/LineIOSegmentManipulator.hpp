@@ -58,7 +58,6 @@ public:
         *out << endl;
     }
 
-private:
     static void checkVectorSize(Vector* vektor, int size) {
         if (size != -1 && vektor->size() != size) {
             throw runtime_error("Number of elements of vector " + TokenFormatter::formatVariable(vektor->name())
@@ -67,6 +66,8 @@ private:
         }
     }
 
+private:
+
     static void parseScalar(Scalar* scalar, istream* in) {
         scalar->parseFrom(in);
     }
@@ -68,24 +68,28 @@ public:
         }
     }
 
+    static void checkVariableSize(Variable* variable, int expectedSize) {
+        int size;
+        string type;
+        if (variable->type() == VariableType::VECTOR) {
+            size = ((Vector*) variable)->size();
+            type = "vector";
+        } else {
+            size = ((Matrix*) variable)->rows();
+            type = "jagged vector";
+        }
+        if (size != expectedSize) {
+            throw runtime_error(
+                    "Number of elements of " + type + " " + TokenFormatter::formatVariable(variable->name())
+                  + " unsatisfied. Expected: " + StringUtils::toString(expectedSize)
+                  + ", actual: " + StringUtils::toString(size));
+        }
+    }
+
 private:
     static void checkVectorSizes(LinesIOSegment* segment) {
         for (Variable* variable : segment->variables()) {
-            int size;
-            string type;
-            if (variable->type() == VariableType::VECTOR) {
-                size = ((Vector*) variable)->size();
-                type = "vector";
-            } else {
-                size = ((Matrix*) variable)->rows();
-                type = "jagged vector";
-            }
-            if (size != segment->size()) {
-                throw runtime_error(
-                        "Number of elements of " + type + " " + TokenFormatter::formatVariable(variable->name())
-                      + " unsatisfied. Expected: " + StringUtils::toString(segment->size())
-                      + ", actual: " + StringUtils::toString(size));
-            }
+            checkVariableSize(variable, segment->size());
         }
     }
 };
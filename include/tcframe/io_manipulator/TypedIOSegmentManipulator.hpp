@@ -0,0 +1,297 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "GridIOSegmentManipulator.hpp"
+#include "LineIOSegmentManipulator.hpp"
+#include "LinesIOSegmentManipulator.hpp"
+#include "tcframe/spec/io.hpp"
+#include "tcframe/spec/variable.hpp"
+#include "tcframe/util.hpp"
+
+using std::get;
+using std::istream;
+using std::ostream;
+using std::string;
+using std::tuple;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Prints and parses typed segments with the same layout and error messages as the other segment manipulators.
+ * Every variable is accessed through its concrete type, so the per-element calls can be inlined, and context
+ * strings for error messages are only built when an error is actually thrown.
+ */
+class TypedIOSegmentManipulator {
+public:
+    TypedIOSegmentManipulator() = delete;
+
+    template<typename... Variables>
+    static void print(TypedLineIOSegment<Variables...>& segment, ostream* out) {
+        printLine(segment.variables(), out, typename MakeIndexSequence<sizeof...(Variables)>::type());
+        *out << '\n';
+    }
+
+    template<typename... Variables>
+    static void parse(TypedLineIOSegment<Variables...>& segment, istream* in) {
+        const string* lastName = nullptr;
+        parseLine(segment.variables(), &lastName, in, typename MakeIndexSequence<sizeof...(Variables)>::type());
+        if (!WhitespaceManipulator::skipNewline(in)) {
+            string context = lastName == nullptr ? "" : TokenFormatter::formatVariable(*lastName);
+            WhitespaceManipulator::parseNewline(in, context);
+        }
+    }
+
+    template<typename... Variables>
+    static void print(TypedLinesIOSegment<Variables...>& segment, ostream* out) {
+        typename MakeIndexSequence<sizeof...(Variables)>::type indices;
+        checkLinesSizes(segment.variables(), segment.size(), indices);
+        for (int j = 0; j < segment.size(); j++) {
+            printLinesRow(segment.variables(), j, out, indices);
+            *out << '\n';
+        }
+    }
+
+    template<typename... Variables>
+    static void parse(TypedLinesIOSegment<Variables...>& segment, istream* in) {
+        typename MakeIndexSequence<sizeof...(Variables)>::type indices;
+        clearLines(segment.variables(), indices);
+        for (int j = 0; j < segment.size(); j++) {
+            const string* lastName = nullptr;
+            parseLinesRow(segment.variables(), j, &lastName, in, indices);
+            if (!WhitespaceManipulator::skipNewline(in)) {
+                WhitespaceManipulator::parseNewline(in, TokenFormatter::formatVectorElement(*lastName, j));
+            }
+        }
+    }
+
+    template<typename T>
+    static void print(TypedGridIOSegment<T>& segment, ostream* out) {
+        MatrixImpl<T>& variable = segment.variable();
+        GridIOSegmentManipulator::checkMatrixSize(&variable, segment.rows(), segment.columns());
+        for (int r = 0; r < segment.rows(); r++) {
+            variable.printRowTo(r, out);
+            *out << '\n';
+        }
+    }
+
+    template<typename T>
+    static void parse(TypedGridIOSegment<T>& segment, istream* in) {
+        MatrixImpl<T>& variable = segment.variable();
+        variable.clear();
+        variable.parseFrom(in, segment.rows(), segment.columns());
+    }
+
+    template<typename... Variables>
+    static void collectVariables(TypedLineIOSegment<Variables...>& segment, vector<Variable*>& variables) {
+        typename MakeIndexSequence<sizeof...(Variables)>::type indices;
+        collectTupleVariables(segment.variables(), variables, indices);
+    }
+
+    template<typename... Variables>
+    static void collectVariables(TypedLinesIOSegment<Variables...>& segment, vector<Variable*>& variables) {
+        typename MakeIndexSequence<sizeof...(Variables)>::type indices;
+        collectTupleVariables(segment.variables(), variables, indices);
+    }
+
+    template<typename T>
+    static void collectVariables(TypedGridIOSegment<T>& segment, vector<Variable*>& variables) {
+        variables.push_back(&segment.variable());
+    }
+
+private:
+    template<typename... Variables, size_t... Is>
+    static void collectTupleVariables(
+            tuple<Variables...>& segmentVariables,
+            vector<Variable*>& variables,
+            IndexSequence<Is...>) {
+
+        int expansion[] = {0, (variables.push_back(variableOf(get<Is>(segmentVariables))), 0)...};
+        (void) expansion;
+    }
+
+    static Variable* variableOf(Variable& variable) {
+        return &variable;
+    }
+
+    template<typename T>
+    static Variable* variableOf(TypedLineIOSegmentVector<T>& vektor) {
+        return &vektor.variable();
+    }
+
+    template<typename... Variables, size_t... Is>
+    static void printLine(tuple<Variables...>& variables, ostream* out, IndexSequence<Is...>) {
+        int expansion[] = {0, (printLineVariable(get<Is>(variables), Is, out), 0)...};
+        (void) expansion;
+    }
+
+    template<typename T>
+    static void printLineVariable(ScalarImpl<T>& scalar, size_t index, ostream* out) {
+        if (index > 0) {
+            *out << ' ';
+        }
+        scalar.printTo(out);
+    }
+
+    template<typename T>
+    static void printLineVariable(TypedLineIOSegmentVector<T>& vektor, size_t index, ostream* out) {
+        LineIOSegmentManipulator::checkVectorSize(&vektor.variable(), vektor.size());
+        if (index > 0) {
+            *out << ' ';
+        }
+        vektor.variable().printTo(out);
+    }
+
+    template<typename... Variables, size_t... Is>
+    static void parseLine(tuple<Variables...>& variables, const string** lastName, istream* in, IndexSequence<Is...>) {
+        int expansion[] = {0, (parseLineVariable(get<Is>(variables), lastName, in), 0)...};
+        (void) expansion;
+    }
+
+    template<typename T>
+    static void parseLineVariable(ScalarImpl<T>& scalar, const string** lastName, istream* in) {
+        if (*lastName != nullptr && !WhitespaceManipulator::skipSpace(in)) {
+            WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVariable(**lastName));
+        }
+        scalar.parseFrom(in);
+        *lastName = &scalar.name();
+    }
+
+    template<typename T>
+    static void parseLineVariable(TypedLineIOSegmentVector<T>& vektor, const string** lastName, istream* in) {
+        if (*lastName != nullptr && !WhitespaceManipulator::skipSpace(in)) {
+            WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVariable(**lastName));
+        }
+        VectorImpl<T>& variable = vektor.variable();
+        variable.clear();
+        if (vektor.size() == -1) {
+            variable.parseFrom(in);
+        } else {
+            variable.parseFrom(in, vektor.size());
+        }
+        *lastName = &variable.name();
+    }
+
+    template<typename... Variables, size_t... Is>
+    static void checkLinesSizes(tuple<Variables...>& variables, int size, IndexSequence<Is...>) {
+        int expansion[] = {0, (LinesIOSegmentManipulator::checkVariableSize(&get<Is>(variables), size), 0)...};
+        (void) expansion;
+    }
+
+    template<typename... Variables, size_t... Is>
+    static void clearLines(tuple<Variables...>& variables, IndexSequence<Is...>) {
+        int expansion[] = {0, (get<Is>(variables).clear(), 0)...};
+        (void) expansion;
+    }
+
+    template<typename... Variables, size_t... Is>
+    static void printLinesRow(tuple<Variables...>& variables, int j, ostream* out, IndexSequence<Is...>) {
+        int expansion[] = {0, (printLinesVariable(get<Is>(variables), Is, j, out), 0)...};
+        (void) expansion;
+    }
+
+    template<typename T>
+    static void printLinesVariable(VectorImpl<T>& vektor, size_t index, int j, ostream* out) {
+        if (index > 0) {
+            *out << ' ';
+        }
+        vektor.printElementTo(j, out);
+    }
+
+    template<typename T>
+    static void printLinesVariable(MatrixImpl<T>& matrix, size_t, int j, ostream* out) {
+        if (matrix.columns(j) > 0) {
+            *out << ' ';
+        }
+        matrix.printRowTo(j, out);
+    }
+
+    template<typename... Variables, size_t... Is>
+    static void parseLinesRow(
+            tuple<Variables...>& variables,
+            int j,
+            const string** lastName,
+            istream* in,
+            IndexSequence<Is...>) {
+
+        int expansion[] = {0, (parseLinesVariable(get<Is>(variables), j, lastName, in), 0)...};
+        (void) expansion;
+    }
+
+    template<typename T>
+    static void parseLinesVariable(VectorImpl<T>& vektor, int j, const string** lastName, istream* in) {
+        if (*lastName != nullptr && !WhitespaceManipulator::skipSpace(in)) {
+            WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(**lastName, j));
+        }
+        vektor.parseAndAddElementFrom(in);
+        *lastName = &vektor.name();
+    }
+
+    template<typename T>
+    static void parseLinesVariable(MatrixImpl<T>& matrix, int j, const string** lastName, istream* in) {
+        if (*lastName != nullptr
+                && !WhitespaceManipulator::canParseNewline(in)
+                && !WhitespaceManipulator::skipSpace(in)) {
+            WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(**lastName, j));
+        }
+        matrix.parseAndAddRowFrom(in, j);
+        *lastName = &matrix.name();
+    }
+};
+
+template<typename... Segments>
+class TypedIOFormatImpl : public TypedIOFormat {
+private:
+    tuple<Segments...> segments_;
+
+public:
+    TypedIOFormatImpl(const Segments&... segments)
+            : segments_(segments...) {
+        checkState(typename MakeIndexSequence<sizeof...(Segments)>::type());
+    }
+
+    void print(ostream* out) {
+        print(out, typename MakeIndexSequence<sizeof...(Segments)>::type());
+    }
+
+    void parse(istream* in) {
+        parse(in, typename MakeIndexSequence<sizeof...(Segments)>::type());
+    }
+
+    vector<Variable*> variables() {
+        vector<Variable*> variables;
+        collectVariables(variables, typename MakeIndexSequence<sizeof...(Segments)>::type());
+        return variables;
+    }
+
+private:
+    template<size_t... Is>
+    void checkState(IndexSequence<Is...>) {
+        int expansion[] = {0, (get<Is>(segments_).checkState(), 0)...};
+        (void) expansion;
+    }
+
+    template<size_t... Is>
+    void print(ostream* out, IndexSequence<Is...>) {
+        int expansion[] = {0, (TypedIOSegmentManipulator::print(get<Is>(segments_), out), 0)...};
+        (void) expansion;
+    }
+
+    template<size_t... Is>
+    void collectVariables(vector<Variable*>& variables, IndexSequence<Is...>) {
+        int expansion[] = {0, (TypedIOSegmentManipulator::collectVariables(get<Is>(segments_), variables), 0)...};
+        (void) expansion;
+    }
+
+    template<size_t... Is>
+    void parse(istream* in, IndexSequence<Is...>) {
+        int expansion[] = {0, (TypedIOSegmentManipulator::parse(get<Is>(segments_), in), 0)...};
+        (void) expansion;
+    }
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
 #include "tcframe/logger/BaseLogger.hpp"
+#include "tcframe/logger/BufferedLoggerEngine.hpp"
 #include "tcframe/logger/LoggerEngine.hpp"
 #include "tcframe/logger/SimpleLoggerEngine.hpp"
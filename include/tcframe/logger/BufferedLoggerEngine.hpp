@@ -0,0 +1,117 @@
+#pragma once
+
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "LoggerEngine.hpp"
+
+using std::condition_variable;
+using std::cout;
+using std::mutex;
+using std::ostream;
+using std::string;
+using std::thread;
+using std::unique_lock;
+
+namespace tcframe {
+
+/*
+ * Logger engine that formats messages into an in-memory buffer, which is written to the output stream by a
+ * background thread. Each message is appended atomically, so messages from concurrent callers never interleave
+ * and keep the order in which they were logged.
+ */
+class BufferedLoggerEngine : public LoggerEngine {
+private:
+    ostream* out_;
+
+    mutex mutex_;
+    condition_variable bufferFilled_;
+    condition_variable bufferDrained_;
+    string buffer_;
+    bool writing_;
+    bool closed_;
+
+    thread drainer_;
+
+public:
+    virtual ~BufferedLoggerEngine() {
+        {
+            unique_lock<mutex> lock(mutex_);
+            closed_ = true;
+        }
+        bufferFilled_.notify_one();
+        drainer_.join();
+    }
+
+    BufferedLoggerEngine(ostream* out = &cout)
+            : out_(out)
+            , writing_(false)
+            , closed_(false)
+            , drainer_(&BufferedLoggerEngine::drain, this) {}
+
+    void logHeading(string message) {
+        append("\n[ " + message + " ]\n");
+    }
+
+    void logParagraph(int level, string message) {
+        append(indent(level) + message + "\n");
+    }
+
+    void logHangingParagraph(int level, string message) {
+        append(indent(level) + message);
+    }
+
+    void logListItem1(int level, string message) {
+        append(indent(level) + "* " + message + "\n");
+    }
+
+    void logListItem2(int level, string message) {
+        append(indent(level) + "- " + message + "\n");
+    }
+
+    void flush() {
+        unique_lock<mutex> lock(mutex_);
+        bufferDrained_.wait(lock, [this] {return buffer_.empty() && !writing_;});
+    }
+
+private:
+    static string indent(int level) {
+        return string(2 * level, ' ');
+    }
+
+    void append(const string& text) {
+        {
+            unique_lock<mutex> lock(mutex_);
+            buffer_ += text;
+        }
+        bufferFilled_.notify_one();
+    }
+
+    void drain() {
+        string pending;
+        unique_lock<mutex> lock(mutex_);
+        while (true) {
+            bufferFilled_.wait(lock, [this] {return !buffer_.empty() || closed_;});
+            if (buffer_.empty()) {
+                return;
+            }
+
+            pending.swap(buffer_);
+            writing_ = true;
+            lock.unlock();
+
+            out_->write(pending.data(), pending.size());
+            out_->flush();
+            pending.clear();
+
+            lock.lock();
+            writing_ = false;
+            bufferDrained_.notify_all();
+        }
+    }
+};
+
+}
@@ -15,6 +15,8 @@ public:
     virtual void logHangingParagraph(int level, string message) = 0;
     virtual void logListItem1(int level, string message) = 0;
     virtual void logListItem2(int level, string message) = 0;
+
+    virtual void flush() {}
 };
 
 }
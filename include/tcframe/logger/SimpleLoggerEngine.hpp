@@ -5,7 +5,6 @@
 
 using std::cout;
 using std::endl;
-using std::flush;
 using std::string;
 
 namespace tcframe {
@@ -24,7 +23,8 @@ public:
 
     void logHangingParagraph(int level, string message) {
         indent(level);
-        cout << message << flush;
+        cout << message;
+        flush();
     }
 
     void logListItem1(int level, string message) {
@@ -37,6 +37,10 @@ public:
         cout << "- " << message << endl;
     }
 
+    void flush() {
+        cout.flush();
+    }
+
 private:
     static void indent(int level) {
         for (int i = 0; i < level; i++) {
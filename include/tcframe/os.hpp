@@ -3,3 +3,4 @@
 #include "tcframe/os/ExecutionResult.hpp"
 #include "tcframe/os/OperatingSystem.hpp"
 #include "tcframe/os/UnixOperatingSystem.hpp"
+#include "tcframe/os/WorkerPool.hpp"
@@ -1,24 +1,38 @@
 #pragma once
 
+#include <cstring>
 #include <istream>
+#include <memory>
+#include <string>
 #include <tuple>
 
+#include "tcframe/util/StringUtils.hpp"
+
 using std::istream;
+using std::shared_ptr;
+using std::string;
 using std::tie;
 
 namespace tcframe {
 
+/*
+ * The result of an execution. It owns the output and error streams, which are shared among its copies and closed
+ * when the last copy is destroyed.
+ */
 struct ExecutionResult {
 private:
     int exitStatus_;
-    istream* outputStream_;
-    istream* errorStream_;
+    shared_ptr<istream> outputStream_;
+    shared_ptr<istream> errorStream_;
+    double durationInSeconds_;
 
 public:
-    ExecutionResult(int exitStatus, istream *outputStream, istream *errorStream)
+    /* Takes ownership of the given streams. */
+    ExecutionResult(int exitStatus, istream *outputStream, istream *errorStream, double durationInSeconds = 0)
             : exitStatus_(exitStatus)
             , outputStream_(outputStream)
             , errorStream_(errorStream)
+            , durationInSeconds_(durationInSeconds)
     {}
 
     int exitStatus() const {
@@ -26,11 +40,29 @@ public:
     }
 
     istream* outputStream() const {
-        return outputStream_;
+        return outputStream_.get();
     }
 
     istream* errorStream() const {
-        return errorStream_;
+        return errorStream_.get();
+    }
+
+    /* The wall-clock time from the start of the execution until the command exited. */
+    double durationInSeconds() const {
+        return durationInSeconds_;
+    }
+
+    /* The signal that killed the command, or its exit code. */
+    string describeExitStatus() const {
+        if (exitStatus_ > 128) {
+            return strsignal(exitStatus_ - 128);
+        }
+        return "exit code " + StringUtils::toString(exitStatus_);
+    }
+
+    /* A command that could not be started is reported the way the shell reports a missing command. */
+    static int notStartedExitStatus() {
+        return 127;
     }
 
     bool operator==(const ExecutionResult& o) const {
@@ -3,12 +3,14 @@
 #include <istream>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "tcframe/os/ExecutionResult.hpp"
 
 using std::istream;
 using std::ostream;
 using std::string;
+using std::vector;
 
 namespace tcframe {
 
@@ -16,17 +18,74 @@ class OperatingSystem {
 public:
     virtual ~OperatingSystem() {}
 
+    /* The returned stream is owned by the caller. */
     virtual istream* openForReading(const string& filename) = 0;
+
+    /* The returned stream must be closed with closeOpenedWritingStream(). */
     virtual ostream* openForWriting(const string& filename) = 0;
     virtual void closeOpenedWritingStream(ostream* out) = 0;
+
+    /* Like openForWriting(), but keeps the contents of the file and writes after them. */
+    virtual ostream* openForAppending(const string& filename) = 0;
+
+    /* Makes what was written to the file durable; streams writing to it must be flushed first. */
+    virtual void syncFile(const string& filename) = 0;
     virtual void forceMakeDir(const string& dirName) = 0;
+
+    /* Creates the directory if it does not exist yet, keeping its contents otherwise. */
+    virtual void makeDir(const string& dirName) = 0;
+
+    /* Returns the names of the regular files directly inside the directory, in lexicographic order. */
+    virtual vector<string> listFiles(const string& dirName) = 0;
     virtual void removeFile(const string& filename) = 0;
+
+    /* Replaces the target file atomically, if both files are on the same file system. */
+    virtual void renameFile(const string& filename, const string& targetFilename) = 0;
     virtual ExecutionResult execute(
             const string& command,
             const string& inputFilename,
             const string& outputFilename,
             const string& errorFilename) = 0;
+
+    /*
+     * Starts all the commands at once on the same input file, and waits for all of them to exit. The results are in the
+     * order of the commands; an empty output or error filename discards that stream.
+     */
+    virtual vector<ExecutionResult> executeConcurrently(
+            const vector<string>& commands,
+            const string& inputFilename,
+            const vector<string>& outputFilenames,
+            const vector<string>& errorFilenames) = 0;
+
+    /*
+     * Like executeConcurrently(), but pipes the input to the commands and collects their outputs in memory, without any
+     * files. The error streams are discarded.
+     */
+    virtual vector<ExecutionResult> executeConcurrentlyOnInput(const vector<string>& commands, const string& input) = 0;
     virtual void combineMultipleTestCases(const string& testCaseBaseFilename, int testCasesCount) = 0;
 };
 
+/* Closes a stream opened for writing when it goes out of scope, even if writing to it throws. */
+class ScopedWritingStream {
+private:
+    OperatingSystem* os_;
+    ostream* out_;
+
+public:
+    ScopedWritingStream(OperatingSystem* os, ostream* out)
+            : os_(os)
+            , out_(out) {}
+
+    ScopedWritingStream(const ScopedWritingStream&) = delete;
+    ScopedWritingStream& operator=(const ScopedWritingStream&) = delete;
+
+    ~ScopedWritingStream() {
+        os_->closeOpenedWritingStream(out_);
+    }
+
+    ostream* get() const {
+        return out_;
+    }
+};
+
 }
@@ -1,20 +1,38 @@
 #pragma once
 
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
+#include <poll.h>
+#include <spawn.h>
+#include <stdexcept>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
 
 #include "ExecutionResult.hpp"
 #include "OperatingSystem.hpp"
+#include "tcframe/util.hpp"
 
 using std::ifstream;
+using std::sort;
 using std::istream;
 using std::istringstream;
 using std::ofstream;
 using std::ostream;
 using std::ostringstream;
+using std::runtime_error;
 using std::string;
+using std::vector;
 
 namespace tcframe {
 
@@ -36,21 +54,330 @@ public:
         delete out;
     }
 
+    ostream* openForAppending(const string& filename) {
+        ofstream* file = new ofstream();
+        file->open(filename, ofstream::app);
+        return file;
+    }
+
+    void syncFile(const string& filename) {
+        // fsync() flushes the file itself, whichever descriptor it is called on.
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw runtime_error("Cannot sync " + filename + ": " + strerror(errno));
+        }
+        int result = fsync(fd);
+        ::close(fd);
+        if (result != 0) {
+            throw runtime_error("Cannot sync " + filename + ": " + strerror(errno));
+        }
+    }
+
     void forceMakeDir(const string& dirName) {
         runCommand("rm -rf " + dirName);
         runCommand("mkdir -p " + dirName);
     }
 
+    void makeDir(const string& dirName) {
+        runCommand("mkdir -p " + dirName);
+    }
+
+    vector<string> listFiles(const string& dirName) {
+        vector<string> filenames;
+        DIR* dir = opendir(dirName.c_str());
+        if (dir == nullptr) {
+            return filenames;
+        }
+        while (dirent* entry = readdir(dir)) {
+            struct stat status;
+            if (stat((dirName + "/" + entry->d_name).c_str(), &status) == 0 && S_ISREG(status.st_mode)) {
+                filenames.push_back(entry->d_name);
+            }
+        }
+        closedir(dir);
+        sort(filenames.begin(), filenames.end());
+        return filenames;
+    }
+
     void removeFile(const string& filename) {
         runCommand("rm -rf " + filename);
     }
 
+    void renameFile(const string& filename, const string& targetFilename) {
+        if (rename(filename.c_str(), targetFilename.c_str()) != 0) {
+            throw runtime_error("Cannot rename " + filename + " to " + targetFilename + ": " + strerror(errno));
+        }
+    }
+
     ExecutionResult execute(
             const string& command,
             const string& inputFilename,
             const string& outputFilename,
             const string& errorFilename) {
 
+        Stopwatch stopwatch;
+        int exitCode = system(redirect(command, inputFilename, outputFilename, errorFilename).c_str());
+        int exitStatus = WEXITSTATUS(exitCode);
+        return collectResult(exitStatus, outputFilename, errorFilename, stopwatch.elapsedSeconds());
+    }
+
+    vector<ExecutionResult> executeConcurrently(
+            const vector<string>& commands,
+            const string& inputFilename,
+            const vector<string>& outputFilenames,
+            const vector<string>& errorFilenames) {
+
+        Stopwatch stopwatch;
+        vector<pid_t> pids;
+        int runningCount = 0;
+        for (int i = 0; i < commands.size(); i++) {
+            string shellCommand = redirect(commands[i], inputFilename, outputFilenames[i], errorFilenames[i]);
+            const char* shellArgv[] = {"sh", "-c", shellCommand.c_str(), nullptr};
+            pid_t pid;
+            if (posix_spawn(&pid, "/bin/sh", nullptr, nullptr, (char* const*) shellArgv, environ) != 0) {
+                pid = -1;
+            } else {
+                runningCount++;
+            }
+            pids.push_back(pid);
+        }
+
+        vector<int> exitStatuses(commands.size(), ExecutionResult::notStartedExitStatus());
+        vector<double> durations(commands.size(), 0);
+        // Only the spawned commands are reaped, so that the other children of this process keep their statuses. They
+        // are polled rather than waited for in turn, so that each command gets its own duration.
+        while (runningCount > 0) {
+            for (int i = 0; i < commands.size(); i++) {
+                if (pids[i] < 0) {
+                    continue;
+                }
+                int status;
+                pid_t pid = waitpid(pids[i], &status, WNOHANG);
+                if (pid == 0 || (pid < 0 && errno == EINTR)) {
+                    continue;
+                }
+                if (pid == pids[i]) {
+                    exitStatuses[i] = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+                }
+                durations[i] = stopwatch.elapsedSeconds();
+                pids[i] = -1;
+                runningCount--;
+            }
+            if (runningCount > 0) {
+                usleep(1000);
+            }
+        }
+
+        vector<ExecutionResult> results;
+        for (int i = 0; i < commands.size(); i++) {
+            results.push_back(collectResult(exitStatuses[i], outputFilenames[i], errorFilenames[i], durations[i]));
+        }
+        return results;
+    }
+
+    vector<ExecutionResult> executeConcurrentlyOnInput(const vector<string>& commands, const string& input) {
+        // A command may exit without reading all of its input; that must not kill this process.
+        struct sigaction ignoreAction, previousAction;
+        memset(&ignoreAction, 0, sizeof(ignoreAction));
+        ignoreAction.sa_handler = SIG_IGN;
+        sigaction(SIGPIPE, &ignoreAction, &previousAction);
+
+        Stopwatch stopwatch;
+        vector<pid_t> pids;
+        vector<int> inputFds;
+        vector<int> outputFds;
+        for (const string& command : commands) {
+            int inputPipe[2];
+            int outputPipe[2];
+            if (pipe(inputPipe) != 0) {
+                string error = strerror(errno);
+                abortExecution(pids, inputFds, outputFds);
+                sigaction(SIGPIPE, &previousAction, nullptr);
+                throw runtime_error("Cannot create a pipe: " + error);
+            }
+            if (pipe(outputPipe) != 0) {
+                string error = strerror(errno);
+                close(inputPipe[0]);
+                close(inputPipe[1]);
+                abortExecution(pids, inputFds, outputFds);
+                sigaction(SIGPIPE, &previousAction, nullptr);
+                throw runtime_error("Cannot create a pipe: " + error);
+            }
+            for (int fd : {inputPipe[0], inputPipe[1], outputPipe[0], outputPipe[1]}) {
+                fcntl(fd, F_SETFD, FD_CLOEXEC);
+            }
+
+            posix_spawn_file_actions_t actions;
+            posix_spawn_file_actions_init(&actions);
+            posix_spawn_file_actions_adddup2(&actions, inputPipe[0], 0);
+            posix_spawn_file_actions_adddup2(&actions, outputPipe[1], 1);
+            posix_spawn_file_actions_addopen(&actions, 2, "/dev/null", O_WRONLY, 0);
+
+            pid_t pid;
+            if (spawn(command, &actions, pid) != 0) {
+                pid = -1;
+            }
+            posix_spawn_file_actions_destroy(&actions);
+            close(inputPipe[0]);
+            close(outputPipe[1]);
+
+            fcntl(inputPipe[1], F_SETFL, O_NONBLOCK);
+            if (pid < 0 || input.empty()) {
+                close(inputPipe[1]);
+                inputPipe[1] = -1;
+            }
+            pids.push_back(pid);
+            inputFds.push_back(inputPipe[1]);
+            outputFds.push_back(outputPipe[0]);
+        }
+
+        vector<size_t> writtenSizes(commands.size(), 0);
+        vector<string> outputs(commands.size());
+        vector<double> durations(commands.size(), 0);
+        char buffer[1 << 16];
+        while (true) {
+            vector<pollfd> pollFds;
+            for (int i = 0; i < commands.size(); i++) {
+                if (inputFds[i] >= 0) {
+                    pollFds.push_back({inputFds[i], POLLOUT, 0});
+                }
+                if (outputFds[i] >= 0) {
+                    pollFds.push_back({outputFds[i], POLLIN, 0});
+                }
+            }
+            if (pollFds.empty()) {
+                break;
+            }
+            if (poll(&pollFds[0], pollFds.size(), -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            for (int i = 0; i < commands.size(); i++) {
+                if (inputFds[i] >= 0 && isReady(pollFds, inputFds[i])) {
+                    ssize_t written = write(inputFds[i], input.data() + writtenSizes[i], input.size() - writtenSizes[i]);
+                    if (written > 0) {
+                        writtenSizes[i] += written;
+                    }
+                    if ((written < 0 && errno != EAGAIN && errno != EINTR) || writtenSizes[i] == input.size()) {
+                        close(inputFds[i]);
+                        inputFds[i] = -1;
+                    }
+                }
+                if (outputFds[i] >= 0 && isReady(pollFds, outputFds[i])) {
+                    ssize_t got = read(outputFds[i], buffer, sizeof(buffer));
+                    if (got > 0) {
+                        outputs[i].append(buffer, got);
+                    } else if (got == 0 || errno != EINTR) {
+                        close(outputFds[i]);
+                        outputFds[i] = -1;
+                        durations[i] = stopwatch.elapsedSeconds();
+                    }
+                }
+            }
+        }
+
+        vector<ExecutionResult> results;
+        for (int i = 0; i < commands.size(); i++) {
+            int exitStatus = ExecutionResult::notStartedExitStatus();
+            int status;
+            if (pids[i] >= 0 && waitpid(pids[i], &status, 0) == pids[i]) {
+                exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            }
+            results.push_back(ExecutionResult(
+                    exitStatus,
+                    new istringstream(outputs[i]),
+                    new istringstream(),
+                    durations[i]));
+        }
+
+        sigaction(SIGPIPE, &previousAction, nullptr);
+        return results;
+    }
+
+    void combineMultipleTestCases(const string& testCaseBaseFilename, int testCasesCount) {
+        ostringstream sout;
+        sout << "echo " << testCasesCount << " > " << testCaseBaseFilename << ".in";
+
+        // The output files are absent when only the inputs were generated.
+        sout << " && if [ -f " << testCaseBaseFilename << "_1.out ]; then touch " << testCaseBaseFilename << ".out; fi";
+        system(sout.str().c_str());
+
+        for (int i = 1; i <= testCasesCount; i++) {
+            ostringstream sout2;
+            sout2 << "tail -n +2 " << testCaseBaseFilename << "_" << i << ".in >> " << testCaseBaseFilename << ".in";
+            sout2 << " && if [ -f " << testCaseBaseFilename << "_" << i << ".out ]; then ";
+            sout2 << "cat " << testCaseBaseFilename << "_" << i << ".out >> " << testCaseBaseFilename << ".out; fi";
+            system(sout2.str().c_str());
+
+            ostringstream sout3;
+            sout3 << "rm -f " << testCaseBaseFilename << "_" << i << ".in ";
+            sout3 << testCaseBaseFilename << "_" << i << ".out";
+            system(sout3.str().c_str());
+        }
+    }
+
+private:
+    /*
+     * Starting a shell costs about as much as starting a small solution, so a plain command (a program followed by
+     * arguments, without any shell syntax) is run directly.
+     */
+    static int spawn(const string& command, const posix_spawn_file_actions_t* actions, pid_t& pid) {
+        vector<string> arguments;
+        istringstream in(command);
+        string argument;
+        while (in >> argument) {
+            arguments.push_back(argument);
+        }
+
+        // A leading NAME=value sets an environment variable, which only the shell understands.
+        if (command.find_first_not_of(
+                "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_./+,:@=- ") != string::npos
+                || (!arguments.empty() && arguments[0].find('=') != string::npos)) {
+            const char* shellArgv[] = {"sh", "-c", command.c_str(), nullptr};
+            return posix_spawn(&pid, "/bin/sh", actions, nullptr, (char* const*) shellArgv, environ);
+        }
+        if (arguments.empty()) {
+            return EINVAL;
+        }
+        vector<char*> argv;
+        for (string& argument : arguments) {
+            argv.push_back(&argument[0]);
+        }
+        argv.push_back(nullptr);
+        return posix_spawnp(&pid, argv[0], actions, nullptr, &argv[0], environ);
+    }
+
+    /* Stops the commands started so far, when not all of them could be started. */
+    static void abortExecution(const vector<pid_t>& pids, const vector<int>& inputFds, const vector<int>& outputFds) {
+        for (int i = 0; i < pids.size(); i++) {
+            if (inputFds[i] >= 0) {
+                close(inputFds[i]);
+            }
+            close(outputFds[i]);
+            if (pids[i] >= 0) {
+                kill(pids[i], SIGKILL);
+                waitpid(pids[i], nullptr, 0);
+            }
+        }
+    }
+
+    static bool isReady(const vector<pollfd>& pollFds, int fd) {
+        for (const pollfd& pollFd : pollFds) {
+            if (pollFd.fd == fd) {
+                return pollFd.revents != 0;
+            }
+        }
+        return false;
+    }
+
+    static string redirect(
+            const string& command,
+            const string& inputFilename,
+            const string& outputFilename,
+            const string& errorFilename) {
+
         ostringstream sout;
 
         sout << "{ " << command << "; }";
@@ -68,9 +395,14 @@ public:
         } else {
             sout << " 2> " << errorFilename;
         }
+        return sout.str();
+    }
 
-        int exitCode = system(sout.str().c_str());
-        int exitStatus = WEXITSTATUS(exitCode);
+    ExecutionResult collectResult(
+            int exitStatus,
+            const string& outputFilename,
+            const string& errorFilename,
+            double durationInSeconds) {
 
         istream* outputStream;
         istream* errorStream;
@@ -87,29 +419,9 @@ public:
             errorStream = openForReadingAsStringStream(errorFilename);
         }
 
-        return ExecutionResult(exitStatus, outputStream, errorStream);
-    }
-
-    void combineMultipleTestCases(const string& testCaseBaseFilename, int testCasesCount) {
-        ostringstream sout;
-        sout << "echo " << testCasesCount << " > " << testCaseBaseFilename << ".in";
-        sout << " && touch " << testCaseBaseFilename << ".out";
-        system(sout.str().c_str());
-
-        for (int i = 1; i <= testCasesCount; i++) {
-            ostringstream sout2;
-            sout2 << "tail -n +2 " << testCaseBaseFilename << "_" << i << ".in >> " << testCaseBaseFilename << ".in";
-            sout2 << "&& cat " << testCaseBaseFilename << "_" << i << ".out >> " << testCaseBaseFilename << ".out";
-            system(sout2.str().c_str());
-
-            ostringstream sout3;
-            sout3 << "rm " << testCaseBaseFilename << "_" << i << ".in ";
-            sout3 << testCaseBaseFilename << "_" << i << ".out";
-            system(sout3.str().c_str());
-        }
+        return ExecutionResult(exitStatus, outputStream, errorStream, durationInSeconds);
     }
 
-private:
     istringstream* openForReadingAsStringStream(const string& filename) {
         ifstream file(filename);
 
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "tcframe/util.hpp"
+
+using std::exception;
+using std::function;
+using std::min;
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Runs independent tasks in forked worker processes. Each worker owns a copy of the whole address space (and hence of
+ * the problem spec variables), so tasks may freely mutate them. A task returns its result as a string, which is sent
+ * back to the parent process through a pipe.
+ */
+class WorkerPool {
+private:
+    static const char RESULT = 'r';
+    static const char FAILURE = 'f';
+
+public:
+    virtual ~WorkerPool() {}
+
+    /*
+     * Runs work(0), ..., work(tasksCount - 1) in at most workersCount processes, and returns their results in task
+     * order. Worker w runs tasks w, w + workersCount, w + 2 * workersCount, ... With a single worker, the tasks are run
+     * in the calling process. If a task throws, its worker stops, and a runtime_error with the same message is thrown
+     * once all the workers have exited; a worker that exits abnormally is reported the same way.
+     */
+    virtual vector<string> run(int workersCount, int tasksCount, const function<string(int)>& work) {
+        workersCount = min(workersCount, tasksCount);
+        if (workersCount <= 1) {
+            vector<string> results;
+            for (int task = 0; task < tasksCount; task++) {
+                results.push_back(work(task));
+            }
+            return results;
+        }
+
+        vector<pid_t> workerPids;
+        vector<int> workerFds;
+        for (int worker = 0; worker < workersCount; worker++) {
+            int fds[2];
+            if (pipe(fds) != 0) {
+                string error = strerror(errno);
+                abort(workerPids, workerFds);
+                throw runtime_error("Cannot create a pipe for worker: " + error);
+            }
+            pid_t pid = fork();
+            if (pid < 0) {
+                string error = strerror(errno);
+                close(fds[0]);
+                close(fds[1]);
+                abort(workerPids, workerFds);
+                throw runtime_error("Cannot fork worker: " + error);
+            }
+            if (pid == 0) {
+                // The worker must never return into the caller, which would then run twice.
+                close(fds[0]);
+                try {
+                    for (int task = worker; task < tasksCount; task += workersCount) {
+                        writeMessage(fds[1], RESULT, work(task));
+                    }
+                } catch (exception& e) {
+                    writeMessage(fds[1], FAILURE, e.what());
+                    _exit(1);
+                } catch (...) {
+                    _exit(1);
+                }
+                close(fds[1]);
+                _exit(0);
+            }
+            close(fds[1]);
+            workerPids.push_back(pid);
+            workerFds.push_back(fds[0]);
+        }
+
+        vector<string> results(tasksCount);
+        vector<bool> received(tasksCount, false);
+        vector<string> failures;
+        for (int worker = 0; worker < workersCount; worker++) {
+            char kind;
+            string message;
+            for (int task = worker; task < tasksCount; task += workersCount) {
+                if (!readMessage(workerFds[worker], kind, message)) {
+                    break;
+                }
+                if (kind == FAILURE) {
+                    failures.push_back(message);
+                    break;
+                }
+                results[task] = message;
+                received[task] = true;
+            }
+            close(workerFds[worker]);
+            waitpid(workerPids[worker], nullptr, 0);
+        }
+
+        if (!failures.empty()) {
+            throw runtime_error(failures[0]);
+        }
+        for (int task = 0; task < tasksCount; task++) {
+            if (!received[task]) {
+                throw runtime_error("Worker " + StringUtils::toString(task % workersCount) + " exited abnormally");
+            }
+        }
+        return results;
+    }
+
+private:
+    /* Stops the workers started so far, when not all of them could be started. */
+    static void abort(const vector<pid_t>& workerPids, const vector<int>& workerFds) {
+        for (int worker = 0; worker < workerPids.size(); worker++) {
+            close(workerFds[worker]);
+            kill(workerPids[worker], SIGKILL);
+            waitpid(workerPids[worker], nullptr, 0);
+        }
+    }
+
+    static void writeMessage(int fd, char kind, const string& message) {
+        unsigned long long size = message.size();
+        writeFully(fd, &kind, 1);
+        writeFully(fd, (const char*) &size, sizeof(size));
+        writeFully(fd, message.data(), message.size());
+    }
+
+    static bool readMessage(int fd, char& kind, string& message) {
+        unsigned long long size;
+        if (!readFully(fd, &kind, 1) || !readFully(fd, (char*) &size, sizeof(size))) {
+            return false;
+        }
+        message.assign(size, '\0');
+        return size == 0 || readFully(fd, &message[0], size);
+    }
+
+    static void writeFully(int fd, const char* data, size_t size) {
+        while (size > 0) {
+            ssize_t written = write(fd, data, size);
+            if (written <= 0) {
+                if (written < 0 && errno == EINTR) {
+                    continue;
+                }
+                _exit(1);
+            }
+            data += written;
+            size -= written;
+        }
+    }
+
+    static bool readFully(int fd, char* data, size_t size) {
+        while (size > 0) {
+            ssize_t got = read(fd, data, size);
+            if (got <= 0) {
+                if (got < 0 && errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            data += got;
+            size -= got;
+        }
+        return true;
+    }
+};
+
+}
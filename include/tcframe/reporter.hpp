@@ -0,0 +1,6 @@
+#pragma once
+
+#include "tcframe/reporter/SubtaskReport.hpp"
+#include "tcframe/reporter/SubtaskReportWriter.hpp"
+#include "tcframe/reporter/SubtaskReporter.hpp"
+#include "tcframe/reporter/SubtaskReporterLogger.hpp"
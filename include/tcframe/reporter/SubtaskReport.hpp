@@ -0,0 +1,142 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using std::set;
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+/* The subtasks a single test case is assigned to, and the subtasks it actually satisfies. */
+struct SubtaskReportRow {
+private:
+    string testCaseId_;
+    int testGroupId_;
+    set<int> assignedSubtaskIds_;
+    vector<bool> satisfied_;
+    string error_;
+
+public:
+    SubtaskReportRow(
+            const string& testCaseId,
+            int testGroupId,
+            const set<int>& assignedSubtaskIds,
+            const vector<bool>& satisfied,
+            const string& error)
+            : testCaseId_(testCaseId)
+            , testGroupId_(testGroupId)
+            , assignedSubtaskIds_(assignedSubtaskIds)
+            , satisfied_(satisfied)
+            , error_(error) {}
+
+    const string& testCaseId() const {
+        return testCaseId_;
+    }
+
+    int testGroupId() const {
+        return testGroupId_;
+    }
+
+    const set<int>& assignedSubtaskIds() const {
+        return assignedSubtaskIds_;
+    }
+
+    /* satisfied()[i] tells whether the test case satisfies the i-th subtask of the report. */
+    const vector<bool>& satisfied() const {
+        return satisfied_;
+    }
+
+    /* The reason the test case could not be analyzed, or empty. */
+    const string& error() const {
+        return error_;
+    }
+
+    bool operator==(const SubtaskReportRow& o) const {
+        return tie(testCaseId_, testGroupId_, assignedSubtaskIds_, satisfied_, error_) ==
+                tie(o.testCaseId_, o.testGroupId_, o.assignedSubtaskIds_, o.satisfied_, o.error_);
+    }
+};
+
+/*
+ * The subtasks a test group (or, for the sample test cases, a single test case) should be assigned to, so that its
+ * test cases satisfy all of them, and the subtasks that only some of its test cases satisfy.
+ */
+struct SubtaskAssignmentSuggestion {
+private:
+    string target_;
+    set<int> assignedSubtaskIds_;
+    set<int> subtaskIds_;
+    set<int> conflictingSubtaskIds_;
+
+public:
+    SubtaskAssignmentSuggestion(
+            const string& target,
+            const set<int>& assignedSubtaskIds,
+            const set<int>& subtaskIds,
+            const set<int>& conflictingSubtaskIds)
+            : target_(target)
+            , assignedSubtaskIds_(assignedSubtaskIds)
+            , subtaskIds_(subtaskIds)
+            , conflictingSubtaskIds_(conflictingSubtaskIds) {}
+
+    /* The test spec method (or sample test case) whose assignment is suggested, e.g. "TestGroup2". */
+    const string& target() const {
+        return target_;
+    }
+
+    const set<int>& assignedSubtaskIds() const {
+        return assignedSubtaskIds_;
+    }
+
+    const set<int>& subtaskIds() const {
+        return subtaskIds_;
+    }
+
+    const set<int>& conflictingSubtaskIds() const {
+        return conflictingSubtaskIds_;
+    }
+
+    bool operator==(const SubtaskAssignmentSuggestion& o) const {
+        return tie(target_, assignedSubtaskIds_, subtaskIds_, conflictingSubtaskIds_) ==
+                tie(o.target_, o.assignedSubtaskIds_, o.subtaskIds_, o.conflictingSubtaskIds_);
+    }
+};
+
+struct SubtaskReport {
+private:
+    vector<int> subtaskIds_;
+    vector<SubtaskReportRow> rows_;
+    vector<SubtaskAssignmentSuggestion> suggestions_;
+
+public:
+    SubtaskReport(
+            const vector<int>& subtaskIds,
+            const vector<SubtaskReportRow>& rows,
+            const vector<SubtaskAssignmentSuggestion>& suggestions)
+            : subtaskIds_(subtaskIds)
+            , rows_(rows)
+            , suggestions_(suggestions) {}
+
+    const vector<int>& subtaskIds() const {
+        return subtaskIds_;
+    }
+
+    const vector<SubtaskReportRow>& rows() const {
+        return rows_;
+    }
+
+    const vector<SubtaskAssignmentSuggestion>& suggestions() const {
+        return suggestions_;
+    }
+
+    bool operator==(const SubtaskReport& o) const {
+        return tie(subtaskIds_, rows_, suggestions_) == tie(o.subtaskIds_, o.rows_, o.suggestions_);
+    }
+};
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <ostream>
+#include <set>
+#include <string>
+
+#include "SubtaskReport.hpp"
+#include "tcframe/util.hpp"
+
+using std::ostream;
+using std::set;
+using std::string;
+
+namespace tcframe {
+
+class SubtaskReportWriter {
+public:
+    SubtaskReportWriter() = delete;
+
+    /*
+     * One row per test case, with a 1/0 column per subtask (a single "constraints" column for problems without
+     * subtasks). Subtask ids within a cell are separated by spaces.
+     */
+    static void writeCsv(const SubtaskReport& report, ostream* out) {
+        *out << "testCase,group,assigned";
+        for (int subtaskId : report.subtaskIds()) {
+            if (subtaskId == -1) {
+                *out << ",constraints";
+            } else {
+                *out << ",subtask" << subtaskId;
+            }
+        }
+        *out << ",error\n";
+
+        for (const SubtaskReportRow& row : report.rows()) {
+            *out << row.testCaseId() << "," << row.testGroupId() << ",";
+            bool first = true;
+            for (int subtaskId : row.assignedSubtaskIds()) {
+                *out << (first ? "" : " ") << subtaskId;
+                first = false;
+            }
+            for (bool satisfied : row.satisfied()) {
+                *out << "," << (satisfied ? 1 : 0);
+            }
+            *out << "," << formatCsvField(row.error()) << "\n";
+        }
+    }
+
+    static void writeJson(const SubtaskReport& report, ostream* out) {
+        *out << "{\"subtasks\":" << formatJsonArray(set<int>(report.subtaskIds().begin(), report.subtaskIds().end()));
+
+        *out << ",\"testCases\":[";
+        for (int r = 0; r < report.rows().size(); r++) {
+            const SubtaskReportRow& row = report.rows()[r];
+            set<int> satisfiedSubtaskIds;
+            for (int i = 0; i < report.subtaskIds().size(); i++) {
+                if (row.satisfied()[i]) {
+                    satisfiedSubtaskIds.insert(report.subtaskIds()[i]);
+                }
+            }
+            *out << (r > 0 ? "," : "")
+                 << "{\"id\":" << StringUtils::toJsonString(row.testCaseId())
+                 << ",\"group\":" << row.testGroupId()
+                 << ",\"assigned\":" << formatJsonArray(row.assignedSubtaskIds())
+                 << ",\"satisfied\":" << formatJsonArray(satisfiedSubtaskIds);
+            if (!row.error().empty()) {
+                *out << ",\"error\":" << StringUtils::toJsonString(row.error());
+            }
+            *out << "}";
+        }
+
+        *out << "],\"suggestions\":[";
+        for (int s = 0; s < report.suggestions().size(); s++) {
+            const SubtaskAssignmentSuggestion& suggestion = report.suggestions()[s];
+            *out << (s > 0 ? "," : "")
+                 << "{\"target\":" << StringUtils::toJsonString(suggestion.target())
+                 << ",\"assigned\":" << formatJsonArray(suggestion.assignedSubtaskIds())
+                 << ",\"suggested\":" << formatJsonArray(suggestion.subtaskIds())
+                 << ",\"conflicting\":" << formatJsonArray(suggestion.conflictingSubtaskIds())
+                 << "}";
+        }
+        *out << "]}\n";
+    }
+
+private:
+    static string formatCsvField(const string& field) {
+        if (field.find_first_of(",\"\n") == string::npos) {
+            return field;
+        }
+        string formatted = "\"";
+        for (char c : field) {
+            formatted += c == '"' ? "\"\"" : string(1, c);
+        }
+        return formatted + "\"";
+    }
+
+    static string formatJsonArray(const set<int>& values) {
+        string formatted = "[";
+        for (int value : values) {
+            formatted += (formatted.size() > 1 ? "," : "") + StringUtils::toString(value);
+        }
+        return formatted + "]";
+    }
+};
+
+}
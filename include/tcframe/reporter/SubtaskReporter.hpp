@@ -0,0 +1,121 @@
+#pragma once
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SubtaskReport.hpp"
+#include "SubtaskReporterLogger.hpp"
+#include "tcframe/testcase.hpp"
+#include "tcframe/util.hpp"
+#include "tcframe/verifier.hpp"
+
+using std::runtime_error;
+using std::set;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Computes which subtasks each test case satisfies, by applying the test cases and evaluating the constraints only;
+ * no input is printed and no solution is run.
+ */
+class SubtaskReporter {
+private:
+    Verifier* verifier_;
+    SubtaskReporterLogger* logger_;
+
+public:
+    virtual ~SubtaskReporter() {}
+
+    SubtaskReporter(Verifier* verifier, SubtaskReporterLogger* logger)
+            : verifier_(verifier)
+            , logger_(logger) {}
+
+    virtual SubtaskReport report(const TestSuite& testSuite) {
+        logger_->logIntroduction();
+
+        set<int> subtaskIdsSet = verifier_->subtaskIds();
+        vector<int> subtaskIds(subtaskIdsSet.begin(), subtaskIdsSet.end());
+
+        vector<SubtaskReportRow> rows;
+        vector<SubtaskAssignmentSuggestion> suggestions;
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            vector<SubtaskReportRow> testGroupRows;
+            for (const TestCase& testCase : testGroup.testCases()) {
+                testGroupRows.push_back(analyze(testCase, testGroup.id(), subtaskIds));
+            }
+            if (testGroupRows.empty()) {
+                continue;
+            }
+
+            if (testGroup.id() == 0) {
+                for (const SubtaskReportRow& row : testGroupRows) {
+                    suggestions.push_back(suggest(row.testCaseId(), {row}, subtaskIds));
+                }
+            } else {
+                string target = testGroup.id() == -1 ? "TestCases" : "TestGroup" + StringUtils::toString(testGroup.id());
+                suggestions.push_back(suggest(target, testGroupRows, subtaskIds));
+            }
+            rows.insert(rows.end(), testGroupRows.begin(), testGroupRows.end());
+        }
+
+        logger_->logSuggestions(suggestions);
+        return SubtaskReport(subtaskIds, rows, suggestions);
+    }
+
+private:
+    SubtaskReportRow analyze(const TestCase& testCase, int testGroupId, const vector<int>& subtaskIds) {
+        vector<bool> satisfied(subtaskIds.size(), false);
+        string error;
+        try {
+            testCase.applier()();
+            set<int> satisfiedSubtaskIds = verifier_->satisfiedSubtaskIds();
+            for (int i = 0; i < subtaskIds.size(); i++) {
+                satisfied[i] = satisfiedSubtaskIds.count(subtaskIds[i]) > 0;
+            }
+        } catch (runtime_error& e) {
+            error = e.what();
+            logger_->logTestCaseFailure(testCase.id(), error);
+        }
+        return SubtaskReportRow(testCase.id(), testGroupId, testCase.subtaskIds(), satisfied, error);
+    }
+
+    static SubtaskAssignmentSuggestion suggest(
+            const string& target,
+            const vector<SubtaskReportRow>& rows,
+            const vector<int>& subtaskIds) {
+
+        set<int> satisfiedByAll;
+        set<int> conflicting;
+        for (int i = 0; i < subtaskIds.size(); i++) {
+            int satisfiedCount = 0;
+            int analyzedCount = 0;
+            for (const SubtaskReportRow& row : rows) {
+                if (row.error().empty()) {
+                    analyzedCount++;
+                    satisfiedCount += row.satisfied()[i];
+                }
+            }
+            if (analyzedCount > 0 && satisfiedCount == analyzedCount) {
+                satisfiedByAll.insert(subtaskIds[i]);
+            } else if (satisfiedCount > 0) {
+                conflicting.insert(subtaskIds[i]);
+            }
+        }
+        return SubtaskAssignmentSuggestion(target, rows[0].assignedSubtaskIds(), satisfiedByAll, conflicting);
+    }
+};
+
+class SubtaskReporterFactory {
+public:
+    virtual ~SubtaskReporterFactory() {}
+
+    virtual SubtaskReporter* create(Verifier* verifier, SubtaskReporterLogger* logger) {
+        return new SubtaskReporter(verifier, logger);
+    }
+};
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <set>
+#include <string>
+
+#include "SubtaskReport.hpp"
+#include "tcframe/logger.hpp"
+#include "tcframe/util.hpp"
+
+using std::set;
+using std::string;
+
+namespace tcframe {
+
+class SubtaskReporterLogger : public BaseLogger {
+public:
+    virtual ~SubtaskReporterLogger() {}
+
+    SubtaskReporterLogger(LoggerEngine* engine)
+            : BaseLogger(engine) {}
+
+    virtual void logIntroduction() {
+        engine_->logParagraph(0, "Analyzing subtasks of test cases...");
+    }
+
+    virtual void logTestCaseFailure(const string& testCaseId, const string& message) {
+        engine_->logParagraph(1, testCaseId + ": FAILED");
+        engine_->logListItem1(2, message);
+    }
+
+    virtual void logSuggestions(const vector<SubtaskAssignmentSuggestion>& suggestions) {
+        engine_->logHeading("SUGGESTED SUBTASK ASSIGNMENTS");
+        for (const SubtaskAssignmentSuggestion& suggestion : suggestions) {
+            string message = suggestion.target() + ": " + formatSubtaskIds(suggestion.subtaskIds());
+            if (suggestion.subtaskIds() != suggestion.assignedSubtaskIds()) {
+                message += " (currently " + formatSubtaskIds(suggestion.assignedSubtaskIds()) + ")";
+            }
+            engine_->logParagraph(1, message);
+            for (int subtaskId : suggestion.conflictingSubtaskIds()) {
+                engine_->logListItem1(2, "Only some test cases satisfy subtask " + StringUtils::toString(subtaskId));
+            }
+        }
+    }
+
+    virtual void logReportWritten(const string& filename) {
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Subtask report written to " + filename + ".");
+    }
+
+private:
+    static string formatSubtaskIds(const set<int>& subtaskIds) {
+        string formatted = "{";
+        for (int subtaskId : subtaskIds) {
+            formatted += (formatted.size() > 1 ? ", " : "") + StringUtils::toString(subtaskId);
+        }
+        return formatted + "}";
+    }
+};
+
+}
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "tcframe/util.hpp"
 
+using std::set;
+using std::pair;
 using std::string;
+using std::vector;
 
 namespace tcframe {
 
@@ -13,15 +19,39 @@ struct Args {
 
 public:
     enum class Command {
-        GEN
+        GEN,
+        VALIDATE,
+        REPORT,
+        MERGE,
+        DIFF,
+        STRESS
     };
 
 private:
     Command command_;
     optional<string> slug_;
     optional<string> solution_;
+    vector<string> alternativeSolutions_;
     optional<string> tcDir_;
     optional<unsigned> seed_;
+    optional<string> jsonLog_;
+    bool profileConstraints_;
+    optional<int> jobs_;
+    optional<string> report_;
+    bool noOutput_;
+    bool dryRun_;
+    optional<set<int>> groups_;
+    optional<set<string>> cases_;
+    optional<pair<int, int>> shard_;
+    optional<string> durations_;
+    optional<string> snapshotDir_;
+    bool fromSnapshots_;
+    optional<int> iterations_;
+    bool failOnDuplicates_;
+    optional<int> nearDuplicates_;
+    bool resume_;
+    optional<string> trace_;
+    vector<string> operands_;
 
 public:
     Command command() const {
@@ -36,6 +66,11 @@ public:
         return solution_;
     }
 
+    /* The solutions given after the first --solution, to be cross-checked against it. */
+    const vector<string>& alternativeSolutions() const {
+        return alternativeSolutions_;
+    }
+
     const optional<string>& tcDir() const {
         return tcDir_;
     }
@@ -43,6 +78,83 @@ public:
     const optional<unsigned>& seed() const {
         return seed_;
     }
+
+    const optional<string>& jsonLog() const {
+        return jsonLog_;
+    }
+
+    bool profileConstraints() const {
+        return profileConstraints_;
+    }
+
+    const optional<int>& jobs() const {
+        return jobs_;
+    }
+
+    const optional<string>& report() const {
+        return report_;
+    }
+
+    bool noOutput() const {
+        return noOutput_;
+    }
+
+    bool dryRun() const {
+        return dryRun_;
+    }
+
+    const optional<set<int>>& groups() const {
+        return groups_;
+    }
+
+    const optional<set<string>>& cases() const {
+        return cases_;
+    }
+
+    /* The 1-based shard index and the number of shards. */
+    const optional<pair<int, int>>& shard() const {
+        return shard_;
+    }
+
+    /* The duration profile that the test cases are balanced across the shards with. */
+    const optional<string>& durations() const {
+        return durations_;
+    }
+
+    const optional<string>& snapshotDir() const {
+        return snapshotDir_;
+    }
+
+    bool fromSnapshots() const {
+        return fromSnapshots_;
+    }
+
+    const optional<int>& iterations() const {
+        return iterations_;
+    }
+
+    bool failOnDuplicates() const {
+        return failOnDuplicates_;
+    }
+
+    /* The minimum similarity in percent of the inputs to report as near-duplicates. */
+    const optional<int>& nearDuplicates() const {
+        return nearDuplicates_;
+    }
+
+    bool resume() const {
+        return resume_;
+    }
+
+    /* The file that the trace of the run is written to, in the Chrome trace event format. */
+    const optional<string>& trace() const {
+        return trace_;
+    }
+
+    /* The arguments after the command that are not options. */
+    const vector<string>& operands() const {
+        return operands_;
+    }
 };
 
 }
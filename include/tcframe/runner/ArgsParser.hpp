@@ -2,13 +2,18 @@
 
 #include <cstdio>
 #include <getopt.h>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include "Args.hpp"
 #include "tcframe/util.hpp"
 
 using std::runtime_error;
+using std::set;
+using std::make_pair;
+using std::pair;
 using std::string;
 
 namespace tcframe {
@@ -21,16 +26,52 @@ public:
                 { "slug",       required_argument, nullptr, 'b'},
                 { "solution",   required_argument, nullptr, 'c'},
                 { "tc-dir",     required_argument, nullptr, 'd'},
+                { "json-log",   required_argument, nullptr, 'e'},
+                { "profile-constraints", no_argument, nullptr, 'f'},
+                { "jobs",       required_argument, nullptr, 'g'},
+                { "report",     required_argument, nullptr, 'h'},
+                { "no-output",  no_argument,       nullptr, 'i'},
+                { "dry-run",    no_argument,       nullptr, 'j'},
+                { "groups",     required_argument, nullptr, 'k'},
+                { "cases",      required_argument, nullptr, 'l'},
+                { "shard",      required_argument, nullptr, 'm'},
+                { "snapshot-dir", required_argument, nullptr, 'n'},
+                { "from-snapshots", no_argument,   nullptr, 'o'},
+                { "iterations", required_argument, nullptr, 'p'},
+                { "fail-on-duplicates", no_argument, nullptr, 'q'},
+                { "near-duplicates", required_argument, nullptr, 'r'},
+                { "resume",     no_argument,       nullptr, 's'},
+                { "trace",      required_argument, nullptr, 't'},
+                { "durations",  required_argument, nullptr, 'u'},
                 { 0, 0, 0, 0 }};
 
         Args args;
         args.command_ = Args::Command::GEN;
+        args.profileConstraints_ = false;
+        args.noOutput_ = false;
+        args.dryRun_ = false;
+        args.fromSnapshots_ = false;
+        args.failOnDuplicates_ = false;
+        args.resume_ = false;
 
         optind = 1;
         opterr = 0;
 
+        // The command, if any, takes the place of the program name for getopt.
+        if (argc > 1 && argv[1][0] != '-') {
+            args.command_ = parseCommand(argv[1]);
+            argc--;
+            argv++;
+        }
+
         int c;
         unsigned seed;
+        int jobs;
+        int iterations;
+        int similarity;
+        int shardIndex;
+        int shardsCount;
+        char trailing;
         while ((c = getopt_long_only(argc, argv, ":", longopts, nullptr)) != -1) {
             switch (c) {
                 case 'a':
@@ -41,11 +82,79 @@ public:
                     args.slug_ = optional<string>(optarg);
                     break;
                 case 'c':
-                    args.solution_ = optional<string>(optarg);
+                    if (args.solution_) {
+                        args.alternativeSolutions_.push_back(optarg);
+                    } else {
+                        args.solution_ = optional<string>(optarg);
+                    }
                     break;
                 case 'd':
                     args.tcDir_ = optional<string>(optarg);
                     break;
+                case 'e':
+                    args.jsonLog_ = optional<string>(optarg);
+                    break;
+                case 'f':
+                    args.profileConstraints_ = true;
+                    break;
+                case 'g':
+                    if (sscanf(optarg, "%d", &jobs) != 1 || jobs < 1) {
+                        throw runtime_error("tcframe: option --jobs requires a positive number");
+                    }
+                    args.jobs_ = optional<int>(jobs);
+                    break;
+                case 'h':
+                    args.report_ = optional<string>(optarg);
+                    break;
+                case 'i':
+                    args.noOutput_ = true;
+                    break;
+                case 'j':
+                    args.dryRun_ = true;
+                    break;
+                case 'k':
+                    args.groups_ = optional<set<int>>(parseTestGroupIds(optarg));
+                    break;
+                case 'l':
+                    args.cases_ = optional<set<string>>(parseTestCaseIds(optarg));
+                    break;
+                case 'm':
+                    if (sscanf(optarg, "%d/%d%c", &shardIndex, &shardsCount, &trailing) != 2
+                            || shardIndex < 1 || shardIndex > shardsCount) {
+                        throw runtime_error("tcframe: option --shard requires i/n, with 1 <= i <= n");
+                    }
+                    args.shard_ = optional<pair<int, int>>(make_pair(shardIndex, shardsCount));
+                    break;
+                case 'n':
+                    args.snapshotDir_ = optional<string>(optarg);
+                    break;
+                case 'o':
+                    args.fromSnapshots_ = true;
+                    break;
+                case 'p':
+                    if (sscanf(optarg, "%d", &iterations) != 1 || iterations < 1) {
+                        throw runtime_error("tcframe: option --iterations requires a positive number");
+                    }
+                    args.iterations_ = optional<int>(iterations);
+                    break;
+                case 'q':
+                    args.failOnDuplicates_ = true;
+                    break;
+                case 'r':
+                    if (sscanf(optarg, "%d%c", &similarity, &trailing) != 1 || similarity < 1 || similarity > 100) {
+                        throw runtime_error("tcframe: option --near-duplicates requires a percentage from 1 to 100");
+                    }
+                    args.nearDuplicates_ = optional<int>(similarity);
+                    break;
+                case 's':
+                    args.resume_ = true;
+                    break;
+                case 't':
+                    args.trace_ = optional<string>(optarg);
+                    break;
+                case 'u':
+                    args.durations_ = optional<string>(optarg);
+                    break;
                 case ':':
                     throw runtime_error("tcframe: option " + string(argv[optind - 1]) + " requires an argument");
                 case '?':
@@ -55,8 +164,73 @@ public:
             }
         }
 
+        for (int i = optind; i < argc; i++) {
+            args.operands_.push_back(argv[i]);
+        }
+        if (args.durations_ && !args.shard_) {
+            throw runtime_error("tcframe: option --durations requires --shard");
+        }
+        if (args.fromSnapshots_ && !args.snapshotDir_) {
+            throw runtime_error("tcframe: option --from-snapshots requires --snapshot-dir");
+        }
+        if (args.command_ == Args::Command::DIFF && args.operands_.size() != 2) {
+            throw runtime_error("tcframe: command diff requires two file manifests");
+        }
+        if (args.command_ == Args::Command::STRESS && args.operands_.size() != 1) {
+            throw runtime_error("tcframe: command stress requires a test case id");
+        }
+        if (args.command_ == Args::Command::STRESS && args.alternativeSolutions_.empty()) {
+            throw runtime_error("tcframe: command stress requires at least two --solution options");
+        }
+
         return args;
     }
+
+private:
+    static set<int> parseTestGroupIds(const string& value) {
+        set<int> testGroupIds;
+        for (const string& token : StringUtils::split(value, ',')) {
+            int testGroupId;
+            char trailing;
+            if (sscanf(token.c_str(), "%d%c", &testGroupId, &trailing) != 1 || testGroupId < 0) {
+                throw runtime_error("tcframe: option --groups requires a comma-separated list of test group numbers");
+            }
+            testGroupIds.insert(testGroupId);
+        }
+        return testGroupIds;
+    }
+
+    static set<string> parseTestCaseIds(const string& value) {
+        set<string> testCaseIds;
+        for (const string& token : StringUtils::split(value, ',')) {
+            if (!token.empty()) {
+                testCaseIds.insert(token);
+            }
+        }
+        return testCaseIds;
+    }
+
+    static Args::Command parseCommand(const string& command) {
+        if (command == "gen") {
+            return Args::Command::GEN;
+        }
+        if (command == "validate") {
+            return Args::Command::VALIDATE;
+        }
+        if (command == "report") {
+            return Args::Command::REPORT;
+        }
+        if (command == "merge") {
+            return Args::Command::MERGE;
+        }
+        if (command == "diff") {
+            return Args::Command::DIFF;
+        }
+        if (command == "stress") {
+            return Args::Command::STRESS;
+        }
+        throw runtime_error("tcframe: command " + command + " unknown");
+    }
 };
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 
 #include "Args.hpp"
 #include "ArgsParser.hpp"
@@ -8,13 +9,17 @@
 #include "RunnerLoggerFactory.hpp"
 #include "tcframe/generator.hpp"
 #include "tcframe/os.hpp"
+#include "tcframe/reporter.hpp"
 #include "tcframe/spec.hpp"
+#include "tcframe/stresser.hpp"
 #include "tcframe/testcase.hpp"
 #include "tcframe/util.hpp"
+#include "tcframe/validator.hpp"
 #include "tcframe/verifier.hpp"
 
 using std::cout;
 using std::endl;
+using std::unique_ptr;
 
 namespace tcframe {
 
@@ -28,14 +33,24 @@ private:
 
     RunnerLoggerFactory* loggerFactory_;
     GeneratorFactory* generatorFactory_;
+    ValidatorFactory* validatorFactory_;
+    SubtaskReporterFactory* subtaskReporterFactory_;
+    StresserFactory* stresserFactory_;
 
 public:
-    Runner(BaseTestSpec<TProblemSpec>* testSpec)
+    /*
+     * The log is written directly to the standard output by default. A BufferedLoggerEngine writes it from a background
+     * thread instead; the lines that it has not written yet are lost if the spec crashes or exits.
+     */
+    Runner(BaseTestSpec<TProblemSpec>* testSpec, LoggerEngine* loggerEngine = new SimpleLoggerEngine())
             : testSpec_(testSpec)
-            , loggerEngine_(new SimpleLoggerEngine())
+            , loggerEngine_(loggerEngine)
             , os_(new UnixOperatingSystem())
             , loggerFactory_(new RunnerLoggerFactory())
-            , generatorFactory_(new GeneratorFactory()) {}
+            , generatorFactory_(new GeneratorFactory())
+            , validatorFactory_(new ValidatorFactory())
+            , subtaskReporterFactory_(new SubtaskReporterFactory())
+            , stresserFactory_(new StresserFactory()) {}
 
     /* Visible for testing. */
     Runner(
@@ -43,21 +58,46 @@ public:
             LoggerEngine* loggerEngine,
             OperatingSystem* os,
             RunnerLoggerFactory* runnerLoggerFactory,
-            GeneratorFactory* generatorFactory)
+            GeneratorFactory* generatorFactory,
+            ValidatorFactory* validatorFactory = new ValidatorFactory(),
+            SubtaskReporterFactory* subtaskReporterFactory = new SubtaskReporterFactory(),
+            StresserFactory* stresserFactory = new StresserFactory())
             : testSpec_(testSpec)
             , loggerEngine_(loggerEngine)
             , os_(os)
             , loggerFactory_(runnerLoggerFactory)
-            , generatorFactory_(generatorFactory) {}
+            , generatorFactory_(generatorFactory)
+            , validatorFactory_(validatorFactory)
+            , subtaskReporterFactory_(subtaskReporterFactory)
+            , stresserFactory_(stresserFactory) {}
 
     int run(int argc, char* argv[]) {
         auto logger = loggerFactory_->create(loggerEngine_);
 
         try {
             Args args = parseArgs(argc, argv);
+            Tracer* tracer = args.trace() ? new Tracer() : nullptr;
+            testSpec_->setTracer(tracer);
             CoreSpec coreSpec = buildCoreSpec(logger);
-            return generate(args, coreSpec) ? 0 : 1;
+            bool successful;
+            if (args.command() == Args::Command::VALIDATE) {
+                successful = validate(args, coreSpec);
+            } else if (args.command() == Args::Command::REPORT) {
+                successful = report(args, coreSpec);
+            } else if (args.command() == Args::Command::DIFF) {
+                successful = diff(args, logger);
+            } else if (args.command() == Args::Command::STRESS) {
+                successful = stress(args, coreSpec);
+            } else {
+                successful = generate(args, coreSpec, tracer);
+            }
+            if (tracer != nullptr) {
+                writeTrace(tracer, args.trace().value());
+            }
+            loggerEngine_->flush();
+            return successful ? 0 : 1;
         } catch (...) {
+            loggerEngine_->flush();
             return 1;
         }
     }
@@ -81,29 +121,208 @@ private:
         }
     }
 
-    bool generate(const Args& args, const CoreSpec& coreSpec) {
+    bool generate(const Args& args, const CoreSpec& coreSpec, Tracer* tracer) {
         const ProblemConfig& problemConfig = coreSpec.problemConfig();
 
-        GeneratorConfig config = GeneratorConfigBuilder()
+        GeneratorConfigBuilder configBuilder = GeneratorConfigBuilder()
                 .setMultipleTestCasesCount(problemConfig.multipleTestCasesCount().value_or(nullptr))
                 .setSeed(args.seed().value_or(DefaultValues::seed()))
                 .setSlug(args.slug().value_or(problemConfig.slug().value_or(DefaultValues::slug())))
                 .setSolutionCommand(args.solution().value_or(DefaultValues::solutionCommand()))
+                .setAlternativeSolutionCommands(args.alternativeSolutions())
+                .setTestCasesDir(args.tcDir().value_or(DefaultValues::testCasesDir()))
+                .setNoOutput(args.noOutput())
+                .setDryRun(args.dryRun())
+                .setFailOnDuplicates(args.failOnDuplicates())
+                .setResume(args.resume());
+        if (args.groups()) {
+            configBuilder.setTestGroupIds(args.groups().value());
+        }
+        if (args.cases()) {
+            configBuilder.setTestCaseIds(args.cases().value());
+        }
+        if (args.shard()) {
+            configBuilder.setShard(args.shard().value().first, args.shard().value().second);
+        }
+        if (args.durations()) {
+            configBuilder.setDurationsFilename(args.durations().value());
+        }
+        if (args.snapshotDir()) {
+            configBuilder.setSnapshotDir(args.snapshotDir().value()).setFromSnapshots(args.fromSnapshots());
+        }
+        if (args.nearDuplicates()) {
+            configBuilder.setNearDuplicateSimilarity(args.nearDuplicates().value());
+        }
+        GeneratorConfig config = configBuilder.build();
+
+        auto ioManipulator = new IOManipulator(coreSpec.ioFormat());
+        auto verifier = new Verifier(
+                coreSpec.constraintSuite(),
+                args.profileConstraints() ? new ConstraintProfile() : nullptr);
+        unique_ptr<ScopedWritingStream> jsonLog;
+        if (args.jsonLog()) {
+            jsonLog.reset(new ScopedWritingStream(os_, os_->openForWriting(args.jsonLog().value())));
+        }
+        auto logger = createGeneratorLogger(jsonLog.get());
+        auto testCaseGenerator = new TestCaseGenerator(
+                verifier,
+                ioManipulator,
+                os_,
+                logger,
+                new FileManifest(),
+                new DuplicateDetector(),
+                new InputStatisticsTable(),
+                new DurationProfile(),
+                new GenerationJournal(),
+                tracer);
+        auto generator = generatorFactory_->create(testCaseGenerator, verifier, os_, logger);
+
+        auto testSuite = provideTestSuite(coreSpec, config, ioManipulator, tracer);
+
+        if (args.command() == Args::Command::MERGE) {
+            return generator->merge(testSuite, config);
+        }
+        return generator->generate(testSuite, config);
+    }
+
+    bool validate(const Args& args, const CoreSpec& coreSpec) {
+        const ProblemConfig& problemConfig = coreSpec.problemConfig();
+
+        ValidatorConfig config = ValidatorConfigBuilder()
+                .setMultipleTestCasesCount(problemConfig.multipleTestCasesCount().value_or(nullptr))
+                .setSlug(args.slug().value_or(problemConfig.slug().value_or(DefaultValues::slug())))
                 .setTestCasesDir(args.tcDir().value_or(DefaultValues::testCasesDir()))
+                .setJobsCount(args.jobs().value_or(DefaultValues::jobsCount()))
                 .build();
 
         auto ioManipulator = new IOManipulator(coreSpec.ioFormat());
         auto verifier = new Verifier(coreSpec.constraintSuite());
-        auto logger = new GeneratorLogger(loggerEngine_);
-        auto testCaseGenerator = new TestCaseGenerator(verifier, ioManipulator, os_, logger);
-        auto generator = generatorFactory_->create(testCaseGenerator, verifier, os_, logger);
+        auto logger = new ValidatorLogger(loggerEngine_);
+        auto testCaseValidator = new TestCaseValidator(ioManipulator, verifier, os_);
+        auto validator = validatorFactory_->create(testCaseValidator, os_, new WorkerPool(), logger);
 
         auto testSuite = TestSuiteProvider::provide(
                 coreSpec.rawTestSuite(),
                 config.slug(),
+                optional<IOManipulator*>());
+
+        return validator->validate(testSuite, config);
+    }
+
+    bool report(const Args& args, const CoreSpec& coreSpec) {
+        const ProblemConfig& problemConfig = coreSpec.problemConfig();
+        string slug = args.slug().value_or(problemConfig.slug().value_or(DefaultValues::slug()));
+        string reportFilename = args.report().value_or(DefaultValues::reportFilename());
+
+        auto ioManipulator = new IOManipulator(coreSpec.ioFormat());
+        auto verifier = new Verifier(coreSpec.constraintSuite());
+        auto logger = new SubtaskReporterLogger(loggerEngine_);
+        auto reporter = subtaskReporterFactory_->create(verifier, logger);
+
+        auto testSuite = TestSuiteProvider::provide(
+                coreSpec.rawTestSuite(),
+                slug,
                 optional<IOManipulator*>(ioManipulator));
 
-        return generator->generate(testSuite, config);
+        SubtaskReport report = reporter->report(testSuite);
+
+        ostream* out = os_->openForWriting(reportFilename);
+        string extension = ".json";
+        if (reportFilename.size() > extension.size()
+                && reportFilename.compare(reportFilename.size() - extension.size(), extension.size(), extension) == 0) {
+            SubtaskReportWriter::writeJson(report, out);
+        } else {
+            SubtaskReportWriter::writeCsv(report, out);
+        }
+        os_->closeOpenedWritingStream(out);
+        logger->logReportWritten(reportFilename);
+
+        for (const SubtaskReportRow& row : report.rows()) {
+            if (!row.error().empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool stress(const Args& args, const CoreSpec& coreSpec) {
+        const ProblemConfig& problemConfig = coreSpec.problemConfig();
+        string slug = args.slug().value_or(problemConfig.slug().value_or(DefaultValues::slug()));
+
+        StresserConfig config = StresserConfigBuilder()
+                .setTestCaseId(args.operands()[0])
+                .setMultipleTestCasesCount(problemConfig.multipleTestCasesCount().value_or(nullptr))
+                .setSeed(args.seed().value_or(DefaultValues::seed()))
+                .setSolutionCommand(args.solution().value_or(DefaultValues::solutionCommand()))
+                .setAlternativeSolutionCommands(args.alternativeSolutions())
+                .setIterationsCount(args.iterations().value_or(DefaultValues::stressIterationsCount()))
+                .setJobsCount(args.jobs().value_or(DefaultValues::jobsCount()))
+                .build();
+
+        auto ioManipulator = new IOManipulator(coreSpec.ioFormat());
+        auto verifier = new Verifier(coreSpec.constraintSuite());
+        auto logger = new StresserLogger(loggerEngine_);
+        auto stresser = stresserFactory_->create(
+                testSpec_->random(), verifier, ioManipulator, os_, new WorkerPool(), logger);
+
+        auto testSuite = TestSuiteProvider::provide(
+                coreSpec.rawTestSuite(),
+                slug,
+                optional<IOManipulator*>(ioManipulator));
+
+        return stresser->stress(testSuite, config);
+    }
+
+    bool diff(const Args& args, RunnerLogger* logger) {
+        try {
+            FileManifest oldManifest = readFileManifest(args.operands()[0]);
+            FileManifest newManifest = readFileManifest(args.operands()[1]);
+            logger->logFileManifestDiff(FileManifestDiff(oldManifest, newManifest));
+            return true;
+        } catch (runtime_error& e) {
+            logger->logFileManifestFailure(e.what());
+            return false;
+        }
+    }
+
+    FileManifest readFileManifest(const string& filename) {
+        unique_ptr<istream> in(os_->openForReading(filename));
+        if (in == nullptr || in->fail()) {
+            throw runtime_error("Cannot read file manifest " + filename);
+        }
+        FileManifest manifest;
+        try {
+            manifest.read(in.get());
+        } catch (runtime_error& e) {
+            throw runtime_error(filename + ": " + e.what());
+        }
+        return manifest;
+    }
+
+    TestSuite provideTestSuite(
+            const CoreSpec& coreSpec,
+            const GeneratorConfig& config,
+            IOManipulator* ioManipulator,
+            Tracer* tracer) {
+
+        TraceSpan span(tracer, "provideTestSuite", "spec");
+        return TestSuiteProvider::provide(
+                coreSpec.rawTestSuite(),
+                config.slug(),
+                optional<IOManipulator*>(ioManipulator));
+    }
+
+    void writeTrace(Tracer* tracer, const string& filename) {
+        ScopedWritingStream out(os_, os_->openForWriting(filename));
+        tracer->write(out.get());
+    }
+
+    /* The JSON log is closed by its owner once the generation finishes. */
+    GeneratorLogger* createGeneratorLogger(ScopedWritingStream* jsonLog) {
+        if (jsonLog != nullptr) {
+            return new NdjsonGeneratorLogger(loggerEngine_, jsonLog->get());
+        }
+        return new GeneratorLogger(loggerEngine_);
     }
 };
 
@@ -3,7 +3,9 @@
 #include <string>
 #include <vector>
 
+#include "tcframe/generator.hpp"
 #include "tcframe/logger.hpp"
+#include "tcframe/util.hpp"
 
 using std::string;
 using std::vector;
@@ -24,6 +26,28 @@ public:
             engine_->logListItem1(1, message);
         }
     }
+
+    virtual void logFileManifestDiff(const FileManifestDiff& diff) {
+        engine_->logHeading("CHANGED FILES");
+        for (const string& filename : diff.addedFilenames()) {
+            engine_->logListItem1(1, "added: " + filename);
+        }
+        for (const string& filename : diff.changedFilenames()) {
+            engine_->logListItem1(1, "changed: " + filename);
+        }
+        for (const string& filename : diff.removedFilenames()) {
+            engine_->logListItem1(1, "removed: " + filename);
+        }
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, StringUtils::toString(diff.addedFilenames().size()) + " added, "
+                + StringUtils::toString(diff.changedFilenames().size()) + " changed, "
+                + StringUtils::toString(diff.removedFilenames().size()) + " removed, "
+                + StringUtils::toString(diff.unchangedCount()) + " unchanged.");
+    }
+
+    virtual void logFileManifestFailure(const string& message) {
+        engine_->logParagraph(0, message);
+    }
 };
 
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "tcframe/spec/constraint/BulkConstraints.hpp"
 #include "tcframe/spec/constraint/Constraint.hpp"
 #include "tcframe/spec/constraint/ConstraintSuite.hpp"
+#include "tcframe/spec/constraint/ConstraintViolation.hpp"
 #include "tcframe/spec/constraint/Subtask.hpp"
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "ConstraintViolation.hpp"
+#include "tcframe/spec/variable/StreamedVector.hpp"
+#include "tcframe/util.hpp"
+
+using std::enable_if;
+using std::is_integral;
+using std::max_element;
+using std::min;
+using std::min_element;
+using std::string;
+using std::unordered_set;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Kernels of the bulk constraint helpers below. Elements are checked in fixed-size blocks without early exits, so
+ * that the compiler can vectorize the checks; only a block that contains a violation is scanned again to find its
+ * first offending element.
+ */
+class BulkConstraintKernels {
+public:
+    BulkConstraintKernels() = delete;
+
+    /* Returns the smallest i in [0, size) such that isViolated(i), or -1 if there is none. */
+    template<typename IsViolated>
+    static long long findFirstViolation(size_t size, IsViolated isViolated) {
+        static const size_t BLOCK_SIZE = 256;
+
+        for (size_t begin = 0; begin < size; begin += BLOCK_SIZE) {
+            size_t end = min(size, begin + BLOCK_SIZE);
+
+            unsigned violationsCount = 0;
+            for (size_t i = begin; i < end; i++) {
+                violationsCount += isViolated(i);
+            }
+            if (violationsCount > 0) {
+                for (size_t i = begin; i < end; i++) {
+                    if (isViolated(i)) {
+                        return (long long) i;
+                    }
+                }
+            }
+        }
+        return -1;
+    }
+
+    /* Returns the index of the first element that is equal to an earlier element, or -1 if there is none. */
+    template<typename T>
+    static typename enable_if<is_integral<T>::value, long long>::type findFirstDuplicate(const vector<T>& v) {
+        if (v.empty()) {
+            return -1;
+        }
+
+        // Dense values are marked in a bitset spanning [min, max]; sparse values fall back to hashing.
+        T lo = *min_element(v.begin(), v.end());
+        T hi = *max_element(v.begin(), v.end());
+        unsigned long long range = (unsigned long long) hi - (unsigned long long) lo;
+        if (range >= 8 * (unsigned long long) v.size() + 64) {
+            return findFirstDuplicateByHashing(v);
+        }
+
+        vector<bool> seen(range + 1, false);
+        for (size_t i = 0; i < v.size(); i++) {
+            unsigned long long offset = (unsigned long long) v[i] - (unsigned long long) lo;
+            if (seen[offset]) {
+                return (long long) i;
+            }
+            seen[offset] = true;
+        }
+        return -1;
+    }
+
+    template<typename T>
+    static typename enable_if<!is_integral<T>::value, long long>::type findFirstDuplicate(const vector<T>& v) {
+        return findFirstDuplicateByHashing(v);
+    }
+
+    static bool reportIfViolated(long long index) {
+        if (index == -1) {
+            return true;
+        }
+        ConstraintViolation::report("first violation at index " + StringUtils::toString(index));
+        return false;
+    }
+
+    static bool reportIfViolated(long long row, long long column) {
+        if (row == -1) {
+            return true;
+        }
+        ConstraintViolation::report("first violation at row " + StringUtils::toString(row)
+                + ", column " + StringUtils::toString(column));
+        return false;
+    }
+
+private:
+    template<typename T>
+    static long long findFirstDuplicateByHashing(const vector<T>& v) {
+        unordered_set<T> seen;
+        seen.reserve(v.size());
+        for (size_t i = 0; i < v.size(); i++) {
+            if (!seen.insert(v[i]).second) {
+                return (long long) i;
+            }
+        }
+        return -1;
+    }
+};
+
+/*
+ * Bulk constraint helpers, to be used inside CONS(). When a helper is not satisfied, the verifier reports the
+ * position of the first offending element together with the constraint.
+ */
+
+template<typename T>
+struct BulkConstraintElement {
+    typedef T type;
+};
+
+/* Whether lo <= v[i] <= hi for each i. */
+template<typename T>
+bool eachElementBetween(
+        const vector<T>& v,
+        const typename BulkConstraintElement<T>::type& lo,
+        const typename BulkConstraintElement<T>::type& hi) {
+
+    const T* data = v.data();
+    return BulkConstraintKernels::reportIfViolated(BulkConstraintKernels::findFirstViolation(v.size(), [=] (size_t i) {
+        return (data[i] < lo) | (hi < data[i]);
+    }));
+}
+
+/* Whether lo <= v[i] <= hi for each i, checked chunk by chunk as the elements are produced. */
+template<typename T>
+bool eachElementBetween(
+        const StreamedVector<T>& v,
+        const typename BulkConstraintElement<T>::type& lo,
+        const typename BulkConstraintElement<T>::type& hi) {
+
+    long long index = -1;
+    v.forEachChunk([&] (const T* data, long long begin, size_t count) -> bool {
+        long long i = BulkConstraintKernels::findFirstViolation(count, [=] (size_t i) {
+            return (data[i] < lo) | (hi < data[i]);
+        });
+        if (i != -1) {
+            index = begin + i;
+        }
+        return index == -1;
+    });
+    return BulkConstraintKernels::reportIfViolated(index);
+}
+
+/* Whether lo <= m[i][j] <= hi for each i, j. */
+template<typename T>
+bool eachElementBetween(
+        const vector<vector<T>>& m,
+        const typename BulkConstraintElement<T>::type& lo,
+        const typename BulkConstraintElement<T>::type& hi) {
+
+    for (size_t r = 0; r < m.size(); r++) {
+        const T* data = m[r].data();
+        long long c = BulkConstraintKernels::findFirstViolation(m[r].size(), [=] (size_t i) {
+            return (data[i] < lo) | (hi < data[i]);
+        });
+        if (c != -1) {
+            return BulkConstraintKernels::reportIfViolated((long long) r, c);
+        }
+    }
+    return true;
+}
+
+/* Whether v[i] <= v[i + 1] for each i. */
+template<typename T>
+bool isSorted(const vector<T>& v) {
+    if (v.size() < 2) {
+        return true;
+    }
+    const T* data = v.data();
+    long long index = BulkConstraintKernels::findFirstViolation(v.size() - 1, [=] (size_t i) {
+        return data[i + 1] < data[i];
+    });
+    return BulkConstraintKernels::reportIfViolated(index == -1 ? -1 : index + 1);
+}
+
+/* Whether v[i] <= v[i + 1] for each i, checked chunk by chunk as the elements are produced. */
+template<typename T>
+bool isSorted(const StreamedVector<T>& v) {
+    long long index = -1;
+    T last = T();
+    v.forEachChunk([&] (const T* data, long long begin, size_t count) -> bool {
+        if (begin > 0 && data[0] < last) {
+            index = begin;
+            return false;
+        }
+        long long i = BulkConstraintKernels::findFirstViolation(count - 1, [=] (size_t i) {
+            return data[i + 1] < data[i];
+        });
+        if (i != -1) {
+            index = begin + i + 1;
+            return false;
+        }
+        last = data[count - 1];
+        return true;
+    });
+    return BulkConstraintKernels::reportIfViolated(index);
+}
+
+/* Whether v[i] < v[i + 1] for each i. */
+template<typename T>
+bool isStrictlySorted(const vector<T>& v) {
+    if (v.size() < 2) {
+        return true;
+    }
+    const T* data = v.data();
+    long long index = BulkConstraintKernels::findFirstViolation(v.size() - 1, [=] (size_t i) {
+        return !(data[i] < data[i + 1]);
+    });
+    return BulkConstraintKernels::reportIfViolated(index == -1 ? -1 : index + 1);
+}
+
+/* Whether all elements of v are pairwise distinct. */
+template<typename T>
+bool eachElementDistinct(const vector<T>& v) {
+    return BulkConstraintKernels::reportIfViolated(BulkConstraintKernels::findFirstDuplicate(v));
+}
+
+/* Whether each row of m has exactly the given size. */
+template<typename T>
+bool eachRowHasSize(const vector<vector<T>>& m, size_t size) {
+    const vector<T>* rows = m.data();
+    return BulkConstraintKernels::reportIfViolated(BulkConstraintKernels::findFirstViolation(m.size(), [=] (size_t i) {
+        return rows[i].size() != size;
+    }));
+}
+
+/* Whether all rows of m have the same size. */
+template<typename T>
+bool eachRowHasSameSize(const vector<vector<T>>& m) {
+    return m.empty() || eachRowHasSize(m, m[0].size());
+}
+
+/* Whether each character of grid is one of the characters of charset. */
+inline bool eachCharIn(const vector<vector<char>>& grid, const string& charset) {
+    bool allowed[256] = {};
+    for (char c : charset) {
+        allowed[(unsigned char) c] = true;
+    }
+
+    for (size_t r = 0; r < grid.size(); r++) {
+        const char* data = grid[r].data();
+        long long c = BulkConstraintKernels::findFirstViolation(grid[r].size(), [&] (size_t i) {
+            return !allowed[(unsigned char) data[i]];
+        });
+        if (c != -1) {
+            return BulkConstraintKernels::reportIfViolated((long long) r, c);
+        }
+    }
+    return true;
+}
+
+/* Whether each character of s is one of the characters of charset. */
+inline bool eachCharIn(const string& s, const string& charset) {
+    bool allowed[256] = {};
+    for (char c : charset) {
+        allowed[(unsigned char) c] = true;
+    }
+
+    const char* data = s.data();
+    return BulkConstraintKernels::reportIfViolated(BulkConstraintKernels::findFirstViolation(s.size(), [&] (size_t i) {
+        return !allowed[(unsigned char) data[i]];
+    }));
+}
+
+}
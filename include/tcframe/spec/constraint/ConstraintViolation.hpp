@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+
+using std::string;
+
+namespace tcframe {
+
+/*
+ * Holds the details of the first constraint violation reported by a constraint helper since the last take(), e.g. the
+ * index of the first offending element. The verifier clears it before evaluating a constraint and reads it after the
+ * constraint turns out to be unsatisfied, so that in e.g. "eachElementBetween(A, 1, 2) || eachElementBetween(B, 1, 2)"
+ * the violation of A is the one shown. Each thread has its own details.
+ */
+class ConstraintViolation {
+public:
+    ConstraintViolation() = delete;
+
+    /* Keeps the details, unless a violation was already reported since the last take(). */
+    static void report(const string& details) {
+        string& reportedDetails = firstDetails();
+        if (reportedDetails.empty()) {
+            reportedDetails = details;
+        }
+    }
+
+    static string take() {
+        string details;
+        details.swap(firstDetails());
+        return details;
+    }
+
+private:
+    static string& firstDetails() {
+        static thread_local string details;
+        return details;
+    }
+};
+
+}
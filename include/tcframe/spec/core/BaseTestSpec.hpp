@@ -43,10 +43,13 @@ private:
             &BaseTestSpec::TestGroup24,
             &BaseTestSpec::TestGroup25};
 
+    Tracer* tracer_ = nullptr;
+
 public:
     virtual ~BaseTestSpec() {}
 
     RawTestSuite buildRawTestSuite() {
+        TraceSpan span(tracer_, "buildRawTestSuite", "spec");
         RawTestSuiteBuilder::setInputFinalizer([this] {
             InputFinalizer();
         });
@@ -69,6 +72,7 @@ public:
     }
 
     virtual CoreSpec buildCoreSpec() {
+        TraceSpan span(tracer_, "buildCoreSpec", "spec");
         return CoreSpec(
                 TProblemSpec::buildProblemConfig(),
                 TProblemSpec::buildIOFormat(),
@@ -76,6 +80,16 @@ public:
                 buildRawTestSuite());
     }
 
+    /* The random number generator of the closures, which the stress command re-seeds before every run of a test case. */
+    Random* random() {
+        return &rnd;
+    }
+
+    /* Sets the tracer that the building of the spec is recorded into, if any. */
+    void setTracer(Tracer* tracer) {
+        tracer_ = tracer;
+    }
+
 protected:
     Random rnd;
 
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <thread>
 
 using std::string;
+using std::thread;
 
 namespace tcframe {
 
@@ -23,6 +25,18 @@ public:
     static string testCasesDir() {
         return "tc";
     }
+
+    static string reportFilename() {
+        return "subtasks.csv";
+    }
+
+    static int stressIterationsCount() {
+        return 10000;
+    }
+
+    static int jobsCount() {
+        return thread::hardware_concurrency() > 0 ? (int) thread::hardware_concurrency() : 1;
+    }
 };
 
 }
@@ -3,13 +3,16 @@
 #include <algorithm>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "tcframe/io_manipulator/TypedIOSegmentManipulator.hpp"
 #include "tcframe/logger.hpp"
 #include "tcframe/spec/io.hpp"
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
 
+using std::forward;
 using std::queue;
 using std::string;
 using std::vector;
@@ -20,12 +23,22 @@ using std::vector;
 #define LINE(...) MagicLineIOSegmentBuilder(newLineIOSegment(), #__VA_ARGS__), __VA_ARGS__
 #define LINES(...) (MagicLinesIOSegmentBuilder(newLinesIOSegment(), #__VA_ARGS__), __VA_ARGS__)
 #define GRID(...) (MagicGridIOSegmentBuilder(newGridIOSegment(), #__VA_ARGS__), __VA_ARGS__)
+#define EDGES(...) (MagicEdgesIOSegmentBuilder(newEdgesIOSegment(), #__VA_ARGS__), __VA_ARGS__)
 
 #define SIZE_IMPL1(size) VectorSize{size}
 #define SIZE_IMPL2(rows, columns) MatrixSize{rows, columns}
 #define SIZE_WITH_COUNT(_1, _2, N, ...) SIZE_IMPL ## N
 #define SIZE(...) SIZE_WITH_COUNT(__VA_ARGS__, 2, 1)(__VA_ARGS__)
 
+#define VERTICES(minVertex, maxVertex) VertexRange{minVertex, maxVertex}
+#define NO_SELF_LOOPS EdgesOption::FORBID_SELF_LOOPS
+#define NO_MULTI_EDGES EdgesOption::FORBID_MULTI_EDGES
+
+#define TYPED_FORMAT(...) setTypedFormat(TypedIOFormatFactory::create(__VA_ARGS__))
+#define TYPED_LINE(...) TypedIOSegmentFactory::createLine(#__VA_ARGS__, __VA_ARGS__)
+#define TYPED_LINES(...) TypedIOSegmentFactory::createLines(#__VA_ARGS__, __VA_ARGS__)
+#define TYPED_GRID(...) TypedIOSegmentFactory::createGrid(#__VA_ARGS__, __VA_ARGS__)
+
 
 namespace tcframe {
 
@@ -49,6 +62,16 @@ struct MatrixSize {
     int columns;
 };
 
+struct VertexRange {
+    int minVertex;
+    int maxVertex;
+};
+
+enum class EdgesOption {
+    FORBID_SELF_LOOPS,
+    FORBID_MULTI_EDGES
+};
+
 class VariableNamesExtractor {
 private:
     queue<string> names_;
@@ -66,7 +89,7 @@ public:
         return name;
     }
 
-private:
+public:
     static vector<string> extractVariableNames(const string& s) {
         vector<string> names;
         for (string namePossiblyWithSize : StringUtils::split(s, ',')) {
@@ -105,6 +128,12 @@ public:
         return *this;
     }
 
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicLineIOSegmentBuilder& operator,(StreamedVector<T>& var) {
+        builder_->addVectorVariable(Vector::create(var, extractor_.nextName()));
+        return *this;
+    }
+
     template<typename T, typename = NotScalarCompatible<T>>
     MagicLineIOSegmentBuilder& operator,(T var) {
         throw runtime_error(
@@ -177,4 +206,210 @@ public:
     }
 };
 
+class MagicEdgesIOSegmentBuilder {
+private:
+    EdgesIOSegmentBuilder* builder_;
+    VariableNamesExtractor extractor_;
+
+public:
+    MagicEdgesIOSegmentBuilder(EdgesIOSegmentBuilder& builder, string names)
+            : builder_(&builder)
+            , extractor_(VariableNamesExtractor(names)) {}
+
+    MagicEdgesIOSegmentBuilder& operator,(vector<int>& var) {
+        if (builder_->hasVertexVariables()) {
+            builder_->setWeightVariable(Vector::create(var, extractor_.nextName()));
+        } else {
+            builder_->addVertexVariable(new VectorImpl<int>(var, extractor_.nextName()));
+        }
+        return *this;
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicEdgesIOSegmentBuilder& operator,(vector<T>& var) {
+        builder_->setWeightVariable(Vector::create(var, extractor_.nextName()));
+        return *this;
+    }
+
+    template<typename T>
+    MagicEdgesIOSegmentBuilder& operator,(T var) {
+        throw runtime_error(
+                "The type of variable " + TokenFormatter::formatVariable(extractor_.nextName())
+                + " is not supported for an edges segment");
+    }
+
+    MagicEdgesIOSegmentBuilder& operator%(VectorSize size) {
+        builder_->setSize(size.size);
+        return *this;
+    }
+
+    MagicEdgesIOSegmentBuilder& operator%(VertexRange range) {
+        builder_->setVertexRange(range.minVertex, range.maxVertex);
+        return *this;
+    }
+
+    MagicEdgesIOSegmentBuilder& operator%(EdgesOption option) {
+        if (option == EdgesOption::FORBID_SELF_LOOPS) {
+            builder_->setNoSelfLoops();
+        } else {
+            builder_->setNoMultiEdges();
+        }
+        return *this;
+    }
+};
+
+/*
+ * Maps the arguments of TYPED_LINE() and TYPED_LINES() to the concrete variable types of the typed segments, so that
+ * an unsupported variable type is a compile error instead of a runtime one.
+ */
+template<typename T>
+struct TypedLineVariable;
+
+template<typename T>
+struct TypedLineVariable<T&> {
+    typedef ScalarImpl<T> type;
+    static const bool isVectorWithoutSize = false;
+
+    static type create(T& var, const string& name) {
+        return type(var, name);
+    }
+};
+
+template<typename T>
+struct TypedLineVariable<vector<T>&> {
+    typedef TypedLineIOSegmentVector<T> type;
+    static const bool isVectorWithoutSize = true;
+
+    static type create(vector<T>& var, const string& name) {
+        return type(VectorImpl<T>(var, name), -1);
+    }
+};
+
+template<typename T>
+struct TypedLineVariable<VectorWithSize<T>> {
+    typedef TypedLineIOSegmentVector<T> type;
+    static const bool isVectorWithoutSize = false;
+
+    static type create(VectorWithSize<T> var, const string& name) {
+        return type(VectorImpl<T>(*var.vektor, name), var.size.size);
+    }
+};
+
+template<typename T>
+struct TypedLinesVariable;
+
+template<typename T>
+struct TypedLinesVariable<vector<T>&> {
+    typedef VectorImpl<T> type;
+    static const bool isJaggedVector = false;
+
+    static type create(vector<T>& var, const string& name) {
+        return type(var, name);
+    }
+};
+
+template<typename T>
+struct TypedLinesVariable<vector<vector<T>>&> {
+    typedef MatrixImpl<T> type;
+    static const bool isJaggedVector = true;
+
+    static type create(vector<vector<T>>& var, const string& name) {
+        return type(var, name);
+    }
+};
+
+class TypedIOSegmentFactory {
+public:
+    TypedIOSegmentFactory() = delete;
+
+    template<typename... Ts>
+    static TypedLineIOSegment<typename TypedLineVariable<Ts>::type...> createLine(const string& names, Ts&&... vars) {
+        static_assert(!hasVectorWithoutSizeBeforeLast<Ts...>(),
+                "Vector without size can only be the last variable in a line segment");
+        return createLine(
+                VariableNamesExtractor::extractVariableNames(names),
+                typename MakeIndexSequence<sizeof...(Ts)>::type(),
+                forward<Ts>(vars)...);
+    }
+
+    template<typename... Ts>
+    static TypedLinesIOSegment<typename TypedLinesVariable<Ts>::type...> createLines(
+            const string& names,
+            Ts&&... vars) {
+
+        static_assert(!hasJaggedVectorBeforeLast<Ts...>(),
+                "Jagged vector can only be the last variable in a lines segment");
+        return createLines(
+                VariableNamesExtractor::extractVariableNames(names),
+                typename MakeIndexSequence<sizeof...(Ts)>::type(),
+                forward<Ts>(vars)...);
+    }
+
+    template<typename T, typename = ScalarCompatible<T>>
+    static TypedGridIOSegment<T> createGrid(const string& names, vector<vector<T>>& var) {
+        return TypedGridIOSegment<T>(MatrixImpl<T>(var, VariableNamesExtractor::extractVariableNames(names)[0]));
+    }
+
+private:
+    template<typename... Ts, size_t... Is>
+    static TypedLineIOSegment<typename TypedLineVariable<Ts>::type...> createLine(
+            const vector<string>& names,
+            IndexSequence<Is...>,
+            Ts&&... vars) {
+
+        return TypedLineIOSegment<typename TypedLineVariable<Ts>::type...>(
+                TypedLineVariable<Ts>::create(vars, names[Is])...);
+    }
+
+    template<typename... Ts, size_t... Is>
+    static TypedLinesIOSegment<typename TypedLinesVariable<Ts>::type...> createLines(
+            const vector<string>& names,
+            IndexSequence<Is...>,
+            Ts&&... vars) {
+
+        return TypedLinesIOSegment<typename TypedLinesVariable<Ts>::type...>(
+                TypedLinesVariable<Ts>::create(vars, names[Is])...);
+    }
+
+    template<typename T>
+    static constexpr bool hasVectorWithoutSizeBeforeLast() {
+        return false;
+    }
+
+    template<typename T, typename U, typename... Ts>
+    static constexpr bool hasVectorWithoutSizeBeforeLast() {
+        return TypedLineVariable<T>::isVectorWithoutSize || hasVectorWithoutSizeBeforeLast<U, Ts...>();
+    }
+
+    template<typename T>
+    static constexpr bool hasJaggedVectorBeforeLast() {
+        return false;
+    }
+
+    template<typename T, typename U, typename... Ts>
+    static constexpr bool hasJaggedVectorBeforeLast() {
+        return TypedLinesVariable<T>::isJaggedVector || hasJaggedVectorBeforeLast<U, Ts...>();
+    }
+};
+
+template<typename... Variables>
+TypedLinesIOSegment<Variables...> operator%(TypedLinesIOSegment<Variables...> segment, VectorSize size) {
+    return segment.setSize(size.size);
+}
+
+template<typename T>
+TypedGridIOSegment<T> operator%(TypedGridIOSegment<T> segment, MatrixSize size) {
+    return segment.setSize(size.rows, size.columns);
+}
+
+class TypedIOFormatFactory {
+public:
+    TypedIOFormatFactory() = delete;
+
+    template<typename... Segments>
+    static TypedIOFormat* create(const Segments&... segments) {
+        return new TypedIOFormatImpl<Segments...>(segments...);
+    }
+};
+
 }
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "tcframe/spec/io/EdgesIOSegment.hpp"
 #include "tcframe/spec/io/GridIOSegment.hpp"
 #include "tcframe/spec/io/IOFormat.hpp"
 #include "tcframe/spec/io/IOSegment.hpp"
 #include "tcframe/spec/io/LineIOSegment.hpp"
 #include "tcframe/spec/io/LinesIOSegment.hpp"
+#include "tcframe/spec/io/TypedIOFormat.hpp"
+#include "tcframe/spec/io/TypedIOSegment.hpp"
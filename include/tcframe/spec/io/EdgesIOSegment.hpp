@@ -0,0 +1,168 @@
+#pragma once
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "IOSegment.hpp"
+#include "tcframe/spec/variable.hpp"
+#include "tcframe/util.hpp"
+
+using std::make_pair;
+using std::pair;
+using std::runtime_error;
+using std::tie;
+
+namespace tcframe {
+
+/*
+ * An edge list: one edge per line, consisting of its endpoints and optionally its weight. The endpoints are stored
+ * in two vector<int> variables and the weights in a third vector variable, one element per edge.
+ */
+struct EdgesIOSegment : public IOSegment {
+    friend class EdgesIOSegmentBuilder;
+
+private:
+    VectorImpl<int>* from_;
+    VectorImpl<int>* to_;
+    Vector* weight_;
+    int size_;
+    optional<pair<int, int>> vertexRange_;
+    bool noSelfLoops_;
+    bool noMultiEdges_;
+
+public:
+    EdgesIOSegment()
+            : from_(nullptr)
+            , to_(nullptr)
+            , weight_(nullptr)
+            , size_(-1)
+            , noSelfLoops_(false)
+            , noMultiEdges_(false) {}
+
+    IOSegmentType type() const {
+        return IOSegmentType::EDGES;
+    }
+
+    VectorImpl<int>* from() const {
+        return from_;
+    }
+
+    VectorImpl<int>* to() const {
+        return to_;
+    }
+
+    /* The weights, or nullptr if the edges are not weighted. */
+    Vector* weight() const {
+        return weight_;
+    }
+
+    int size() const {
+        return size_;
+    }
+
+    const optional<pair<int, int>>& vertexRange() const {
+        return vertexRange_;
+    }
+
+    bool noSelfLoops() const {
+        return noSelfLoops_;
+    }
+
+    /* Whether no two edges may connect the same pair of vertices, in either direction. */
+    bool noMultiEdges() const {
+        return noMultiEdges_;
+    }
+
+    bool operator==(const EdgesIOSegment& o) const {
+        if (!variablesEqual(from_, o.from_) || !variablesEqual(to_, o.to_) || !variablesEqual(weight_, o.weight_)) {
+            return false;
+        }
+        return tie(size_, vertexRange_, noSelfLoops_, noMultiEdges_)
+               == tie(o.size_, o.vertexRange_, o.noSelfLoops_, o.noMultiEdges_);
+    }
+
+    bool equals(IOSegment* o) const {
+        return o->type() == IOSegmentType::EDGES && *this == *((EdgesIOSegment*) o);
+    }
+
+private:
+    static bool variablesEqual(Variable* a, Variable* b) {
+        if (a == nullptr || b == nullptr) {
+            return a == b;
+        }
+        return a->equals(b);
+    }
+};
+
+class EdgesIOSegmentBuilder : public IOSegmentBuilder {
+private:
+    EdgesIOSegment* subject_;
+
+public:
+    EdgesIOSegmentBuilder()
+            : subject_(new EdgesIOSegment()) {}
+
+    bool hasVertexVariables() const {
+        return subject_->to_ != nullptr;
+    }
+
+    EdgesIOSegmentBuilder& addVertexVariable(VectorImpl<int>* variable) {
+        if (subject_->from_ == nullptr) {
+            subject_->from_ = variable;
+        } else if (subject_->to_ == nullptr) {
+            subject_->to_ = variable;
+        } else {
+            throw runtime_error("Edges segment must have exactly two vertex variables");
+        }
+        return *this;
+    }
+
+    EdgesIOSegmentBuilder& setWeightVariable(Vector* variable) {
+        if (!hasVertexVariables()) {
+            throw runtime_error("Edges segment must start with two vertex variables of type vector<int>");
+        }
+        if (subject_->weight_ != nullptr) {
+            throw runtime_error("Edges segment can have at most one weight variable");
+        }
+        subject_->weight_ = variable;
+        return *this;
+    }
+
+    EdgesIOSegmentBuilder& setSize(int size) {
+        subject_->size_ = size;
+        return *this;
+    }
+
+    EdgesIOSegmentBuilder& setVertexRange(int minVertex, int maxVertex) {
+        subject_->vertexRange_ = optional<pair<int, int>>(make_pair(minVertex, maxVertex));
+        return *this;
+    }
+
+    EdgesIOSegmentBuilder& setNoSelfLoops() {
+        subject_->noSelfLoops_ = true;
+        return *this;
+    }
+
+    EdgesIOSegmentBuilder& setNoMultiEdges() {
+        subject_->noMultiEdges_ = true;
+        return *this;
+    }
+
+    EdgesIOSegment* build() {
+        checkState();
+        return subject_;
+    }
+
+private:
+    void checkState() {
+        if (!hasVertexVariables()) {
+            throw runtime_error("Edges segment must start with two vertex variables of type vector<int>");
+        }
+        if (subject_->size_ == -1) {
+            throw runtime_error("Edges segment must define the number of edges");
+        }
+    }
+};
+
+}
@@ -3,12 +3,15 @@
 #include <vector>
 #include <utility>
 
+#include "EdgesIOSegment.hpp"
 #include "GridIOSegment.hpp"
 #include "IOSegment.hpp"
 #include "LineIOSegment.hpp"
 #include "LinesIOSegment.hpp"
+#include "TypedIOFormat.hpp"
 
 using std::move;
+using std::runtime_error;
 using std::vector;
 
 namespace tcframe {
@@ -19,6 +22,8 @@ struct IOFormat {
 private:
     vector<IOSegment*> inputFormat_;
     vector<IOSegment*> outputFormat_;
+    TypedIOFormat* typedInputFormat_ = nullptr;
+    TypedIOFormat* typedOutputFormat_ = nullptr;
 
 public:
     const vector<IOSegment*>& inputFormat() const {
@@ -29,8 +34,21 @@ public:
         return outputFormat_;
     }
 
+    TypedIOFormat* typedInputFormat() const {
+        return typedInputFormat_;
+    }
+
+    TypedIOFormat* typedOutputFormat() const {
+        return typedOutputFormat_;
+    }
+
+    bool hasOutputFormat() const {
+        return !outputFormat_.empty() || typedOutputFormat_ != nullptr;
+    }
+
     bool operator==(const IOFormat& o) const {
-        return equals(inputFormat_, o.inputFormat_) && equals(outputFormat_, o.outputFormat_);
+        return equals(inputFormat_, o.inputFormat_) && equals(outputFormat_, o.outputFormat_)
+               && typedInputFormat_ == o.typedInputFormat_ && typedOutputFormat_ == o.typedOutputFormat_;
     }
 
 private:
@@ -51,11 +69,14 @@ class IOFormatBuilder {
 private:
     IOFormat subject_;
     vector<IOSegment*>* currentFormat_;
+    TypedIOFormat** currentTypedFormat_;
     IOSegmentBuilder* lastBuilder_;
 
 public:
     IOFormatBuilder()
-            : lastBuilder_(nullptr)
+            : currentFormat_(nullptr)
+            , currentTypedFormat_(nullptr)
+            , lastBuilder_(nullptr)
     {}
 
     virtual ~IOFormatBuilder() {}
@@ -63,11 +84,13 @@ public:
     void prepareForInputFormat() {
         addLastSegment();
         currentFormat_ = &subject_.inputFormat_;
+        currentTypedFormat_ = &subject_.typedInputFormat_;
     }
 
     void prepareForOutputFormat() {
         addLastSegment();
         currentFormat_ = &subject_.outputFormat_;
+        currentTypedFormat_ = &subject_.typedOutputFormat_;
     }
 
     LineIOSegmentBuilder& newLineIOSegment() {
@@ -91,16 +114,39 @@ public:
         return *builder;
     }
 
+    EdgesIOSegmentBuilder& newEdgesIOSegment() {
+        addLastSegment();
+        EdgesIOSegmentBuilder* builder = new EdgesIOSegmentBuilder();
+        lastBuilder_ = builder;
+        return *builder;
+    }
+
+    IOFormatBuilder& setTypedFormat(TypedIOFormat* typedFormat) {
+        addLastSegment();
+        if (currentTypedFormat_ != nullptr) {
+            *currentTypedFormat_ = typedFormat;
+            checkTypedFormat();
+        }
+        return *this;
+    }
+
     IOFormat build() {
         addLastSegment();
         return move(subject_);
     }
 
 private:
+    void checkTypedFormat() {
+        if (*currentTypedFormat_ != nullptr && !currentFormat_->empty()) {
+            throw runtime_error("Typed format cannot be mixed with other segments in the same format");
+        }
+    }
+
     void addLastSegment() {
         if (lastBuilder_ != nullptr) {
             if (currentFormat_ != nullptr) {
                 currentFormat_->push_back(lastBuilder_->build());
+                checkTypedFormat();
             }
             lastBuilder_ = nullptr;
         }
@@ -3,6 +3,7 @@
 namespace tcframe {
 
 enum class IOSegmentType {
+    EDGES,
     GRID,
     LINE,
     LINES
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include "tcframe/spec/variable.hpp"
+
+using std::istream;
+using std::ostream;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * An input or output format declared with TYPED_FORMAT(), whose printing and parsing are specialized at compile
+ * time for its segments. It replaces the segments of the format it is declared in.
+ */
+struct TypedIOFormat {
+public:
+    virtual ~TypedIOFormat() {}
+
+    virtual void print(ostream* out) = 0;
+    virtual void parse(istream* in) = 0;
+
+    /* The variables of the segments, in order. */
+    virtual vector<Variable*> variables() = 0;
+};
+
+}
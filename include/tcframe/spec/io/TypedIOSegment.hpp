@@ -0,0 +1,124 @@
+#pragma once
+
+#include <stdexcept>
+#include <tuple>
+
+#include "tcframe/spec/variable.hpp"
+
+using std::runtime_error;
+using std::tuple;
+
+namespace tcframe {
+
+/*
+ * Segments whose variable types are known at compile time. They mirror LineIOSegment, LinesIOSegment, and
+ * GridIOSegment, but hold the concrete variables by value, so that TypedIOSegmentManipulator can print and parse
+ * them without dispatching on the variable type.
+ */
+
+template<typename T>
+struct TypedLineIOSegmentVector {
+private:
+    VectorImpl<T> variable_;
+    int size_;
+
+public:
+    TypedLineIOSegmentVector(const VectorImpl<T>& variable, int size)
+            : variable_(variable)
+            , size_(size) {}
+
+    VectorImpl<T>& variable() {
+        return variable_;
+    }
+
+    int size() const {
+        return size_;
+    }
+};
+
+template<typename... Variables>
+struct TypedLineIOSegment {
+private:
+    tuple<Variables...> variables_;
+
+public:
+    TypedLineIOSegment(const Variables&... variables)
+            : variables_(variables...) {}
+
+    tuple<Variables...>& variables() {
+        return variables_;
+    }
+
+    void checkState() const {}
+};
+
+template<typename... Variables>
+struct TypedLinesIOSegment {
+private:
+    tuple<Variables...> variables_;
+    int size_;
+
+public:
+    TypedLinesIOSegment(const Variables&... variables)
+            : variables_(variables...)
+            , size_(-1) {}
+
+    tuple<Variables...>& variables() {
+        return variables_;
+    }
+
+    int size() const {
+        return size_;
+    }
+
+    TypedLinesIOSegment& setSize(int size) {
+        size_ = size;
+        return *this;
+    }
+
+    void checkState() const {
+        if (size_ == -1) {
+            throw runtime_error("Lines segment must define vector sizes");
+        }
+    }
+};
+
+template<typename T>
+struct TypedGridIOSegment {
+private:
+    MatrixImpl<T> variable_;
+    int rows_;
+    int columns_;
+
+public:
+    TypedGridIOSegment(const MatrixImpl<T>& variable)
+            : variable_(variable)
+            , rows_(-1)
+            , columns_(-1) {}
+
+    MatrixImpl<T>& variable() {
+        return variable_;
+    }
+
+    int rows() const {
+        return rows_;
+    }
+
+    int columns() const {
+        return columns_;
+    }
+
+    TypedGridIOSegment& setSize(int rows, int columns) {
+        rows_ = rows;
+        columns_ = columns;
+        return *this;
+    }
+
+    void checkState() const {
+        if (rows_ == -1 || columns_ == -1) {
+            throw runtime_error("Grid segment must define matrix sizes");
+        }
+    }
+};
+
+}
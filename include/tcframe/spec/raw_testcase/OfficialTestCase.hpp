@@ -3,8 +3,10 @@
 #include <functional>
 #include <string>
 #include <tuple>
+#include <utility>
 
 using std::function;
+using std::move;
 using std::string;
 using std::tie;
 
@@ -16,9 +18,9 @@ private:
     string description_;
 
 public:
-    OfficialTestCase(const function<void()>& closure, const string& description)
-            : closure_(closure)
-            , description_(description) {}
+    OfficialTestCase(function<void()> closure, string description)
+            : closure_(move(closure))
+            , description_(move(description)) {}
 
     const function<void()>& closure() const {
         return closure_;
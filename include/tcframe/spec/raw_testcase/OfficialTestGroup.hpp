@@ -2,10 +2,12 @@
 
 #include <set>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "OfficialTestCase.hpp"
 
+using std::move;
 using std::set;
 using std::tie;
 using std::vector;
@@ -19,10 +21,10 @@ private:
     vector<OfficialTestCase> officialTestCases_;
 
 public:
-    OfficialTestGroup(int id, const set<int>& subtaskIds, const vector<OfficialTestCase>& testCases)
+    OfficialTestGroup(int id, set<int> subtaskIds, vector<OfficialTestCase> testCases)
             : id_(id)
-            , subtaskIds_(subtaskIds)
-            , officialTestCases_(testCases) {}
+            , subtaskIds_(move(subtaskIds))
+            , officialTestCases_(move(testCases)) {}
 
     int id() const {
         return id_;
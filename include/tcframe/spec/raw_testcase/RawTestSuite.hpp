@@ -28,7 +28,7 @@ private:
     function<void()> inputFinalizer_;
 
 public:
-    const vector<SampleTestCase> sampleTests() const {
+    const vector<SampleTestCase>& sampleTests() const {
         return sampleTests_;
     }
 
@@ -75,7 +75,7 @@ public:
         for (const string& line : lines) {
             content += line + "\n";
         }
-        subject_.sampleTests_.push_back(SampleTestCase(content, subtaskIds));
+        subject_.sampleTests_.push_back(SampleTestCase(move(content), subtaskIds));
 
         return *this;
     }
@@ -86,7 +86,7 @@ public:
 
     RawTestSuiteBuilder& newTestGroup() {
         if (hasCurrentTestGroup_) {
-            subject_.officialTests_.push_back(OfficialTestGroup(currentTestGroupId_, currentSubtaskIds_, currentOfficialTestCases_));
+            subject_.officialTests_.push_back(OfficialTestGroup(currentTestGroupId_, currentSubtaskIds_, move(currentOfficialTestCases_)));
         }
 
         hasCurrentTestGroup_ = true;
@@ -110,14 +110,14 @@ public:
             currentSubtaskIds_ = {-1};
         }
 
-        currentOfficialTestCases_.push_back(officialTestCase);
+        currentOfficialTestCases_.push_back(move(officialTestCase));
 
         return *this;
     }
 
     RawTestSuite build() {
         if (hasCurrentTestGroup_) {
-            subject_.officialTests_.push_back(OfficialTestGroup(currentTestGroupId_, currentSubtaskIds_, currentOfficialTestCases_));
+            subject_.officialTests_.push_back(OfficialTestGroup(currentTestGroupId_, currentSubtaskIds_, move(currentOfficialTestCases_)));
         }
         return move(subject_);
     }
@@ -3,7 +3,9 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <utility>
 
+using std::move;
 using std::set;
 using std::string;
 using std::tie;
@@ -16,9 +18,9 @@ private:
     set<int> subtaskIds_;
 
 public:
-    SampleTestCase(const string& content, const set<int>& subtaskIds)
-              : content_(content)
-              , subtaskIds_(subtaskIds) {}
+    SampleTestCase(string content, set<int> subtaskIds)
+              : content_(move(content))
+              , subtaskIds_(move(subtaskIds)) {}
 
     const string& content() const {
         return content_;
@@ -29,7 +31,7 @@ public:
     }
 
     bool operator==(const SampleTestCase& o) const {
-        return tie(content_, subtaskIds_) == tie(o.content_, subtaskIds_);
+        return tie(content_, subtaskIds_) == tie(o.content_, o.subtaskIds_);
     }
 };
 
@@ -8,6 +8,7 @@
 
 #include "TokenFormatter.hpp"
 #include "Variable.hpp"
+#include "VariableStatistics.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::endl;
@@ -40,7 +41,7 @@ public:
 };
 
 template<typename T, typename = ScalarCompatible<T>>
-class MatrixImpl : public Matrix {
+class MatrixImpl final : public Matrix {
 private:
     reference_wrapper<vector<vector<T>>> var_;
     bool hasSpaces_;
@@ -72,11 +73,16 @@ public:
     }
 
     void printRowTo(int rowIndex, ostream* out) {
-        for (int c = 0; c < var_.get()[rowIndex].size(); c++) {
+        const vector<T>& row = var_.get()[rowIndex];
+        for (int c = 0; c < row.size(); c++) {
             if (c > 0 && hasSpaces_) {
                 *out << ' ';
             }
-            *out << var_.get()[rowIndex][c];
+            *out << row[c];
+        }
+        if (statistics() != nullptr) {
+            // A row without spaces is a single token.
+            statistics()->addAll(row.begin(), row.end(), hasSpaces_ ? -1 : (row.empty() ? 0 : 1));
         }
     }
 
@@ -84,15 +90,20 @@ public:
         for (int r = 0; r < rows; r++) {
             vector<T> row;
             for (int c = 0; c < columns; c++) {
-                if (c > 0 && hasSpaces_) {
+                if (c > 0 && hasSpaces_ && !WhitespaceManipulator::skipSpace(in)) {
                     WhitespaceManipulator::parseSpace(in, TokenFormatter::formatMatrixElement(name(), r, c - 1));
                 }
                 T element;
-                Variable::parseValue(in, element, TokenFormatter::formatMatrixElement(name(), r, c));
+                Variable::parseValueLazily(
+                        in,
+                        element,
+                        [&] {return TokenFormatter::formatMatrixElement(name(), r, c);});
                 row.push_back(element);
             }
             var_.get().push_back(row);
-            WhitespaceManipulator::parseNewline(in, TokenFormatter::formatMatrixElement(name(), r, columns - 1));
+            if (!WhitespaceManipulator::skipNewline(in)) {
+                WhitespaceManipulator::parseNewline(in, TokenFormatter::formatMatrixElement(name(), r, columns - 1));
+            }
         }
     }
 
@@ -103,17 +114,36 @@ public:
             if (WhitespaceManipulator::canParseNewline(in)) {
                 break;
             }
-            if (c > 0 && hasSpaces_) {
+            if (c > 0 && hasSpaces_ && !WhitespaceManipulator::skipSpace(in)) {
                 WhitespaceManipulator::parseSpaceAfterMissingNewline(
                         in,
                         TokenFormatter::formatMatrixElement(name(), rowIndex, c - 1));
             }
             T element;
-            Variable::parseValue(in, element, TokenFormatter::formatMatrixElement(name(), rowIndex, c));
+            Variable::parseValueLazily(
+                    in,
+                    element,
+                    [&] {return TokenFormatter::formatMatrixElement(name(), rowIndex, c);});
             row.push_back(element);
         }
         var_.get().push_back(row);
     }
+
+    void snapshotTo(ostream* out) {
+        writeSnapshotTypeCode(out, "m" + SnapshotCodec::typeCode<T>());
+        SnapshotCodec::writeSize(out, var_.get().size());
+        for (const vector<T>& row : var_.get()) {
+            SnapshotCodec::write(out, row);
+        }
+    }
+
+    void restoreFrom(istream* in) {
+        readSnapshotTypeCode(in, "m" + SnapshotCodec::typeCode<T>());
+        var_.get().resize(SnapshotCodec::readSize(in));
+        for (vector<T>& row : var_.get()) {
+            SnapshotCodec::read(in, row);
+        }
+    }
 };
 
 template<typename T, typename>
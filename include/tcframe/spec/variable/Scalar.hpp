@@ -7,6 +7,7 @@
 
 #include "TokenFormatter.hpp"
 #include "Variable.hpp"
+#include "VariableStatistics.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::istream;
@@ -32,7 +33,7 @@ public:
 };
 
 template<typename T, typename = ScalarCompatible<T>>
-class ScalarImpl : public Scalar {
+class ScalarImpl final : public Scalar {
 private:
     reference_wrapper<T> var_;
 
@@ -43,11 +44,24 @@ public:
     {}
 
     void printTo(ostream* out) {
-        *out << var_;
+        *out << var_.get();
+        if (statistics() != nullptr) {
+            statistics()->add(var_.get());
+        }
     }
 
     void parseFrom(istream* in) {
-        Variable::parseValue(in, var_, TokenFormatter::formatVariable(name()));
+        Variable::parseValueLazily(in, var_.get(), [this] {return TokenFormatter::formatVariable(name());});
+    }
+
+    void snapshotTo(ostream* out) {
+        writeSnapshotTypeCode(out, SnapshotCodec::typeCode<T>());
+        SnapshotCodec::write(out, var_.get());
+    }
+
+    void restoreFrom(istream* in) {
+        readSnapshotTypeCode(in, SnapshotCodec::typeCode<T>());
+        SnapshotCodec::read(in, var_.get());
     }
 };
 
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using std::false_type;
+using std::min;
+using std::integral_constant;
+using std::is_arithmetic;
+using std::is_floating_point;
+using std::is_same;
+using std::is_signed;
+using std::istream;
+using std::ostream;
+using std::runtime_error;
+using std::string;
+using std::true_type;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Writes and reads the values of variables in a compact binary form. Numbers are written as their raw bytes, in the
+ * native byte order, so a snapshot is only meant to be read back on the machine that wrote it. Strings and vectors
+ * are prefixed with their lengths.
+ */
+class SnapshotCodec {
+private:
+    // The lengths in a snapshot are not trusted to allocate up front, in case the snapshot is corrupt.
+    static const size_t READ_CHUNK_SIZE = 1 << 16;
+
+public:
+    SnapshotCodec() = delete;
+
+    /* A short code of the type T, e.g. "i4" for int, so that a snapshot is not restored into a different type. */
+    template<typename T>
+    static string typeCode() {
+        if (is_same<T, string>::value) {
+            return "s";
+        }
+        if (is_same<T, bool>::value) {
+            return "b";
+        }
+        char kind = is_floating_point<T>::value ? 'f' : (is_signed<T>::value ? 'i' : 'u');
+        return string(1, kind) + (char) ('0' + sizeof(T));
+    }
+
+    static void writeSize(ostream* out, size_t size) {
+        uint64_t value = size;
+        out->write((const char*) &value, sizeof(value));
+    }
+
+    static size_t readSize(istream* in) {
+        uint64_t value;
+        readBytes(in, (char*) &value, sizeof(value));
+        return (size_t) value;
+    }
+
+    template<typename T>
+    static void write(ostream* out, const T& value) {
+        out->write((const char*) &value, sizeof(T));
+    }
+
+    static void write(ostream* out, const string& value) {
+        writeSize(out, value.size());
+        out->write(value.data(), value.size());
+    }
+
+    template<typename T>
+    static void read(istream* in, T& value) {
+        readBytes(in, (char*) &value, sizeof(T));
+    }
+
+    static void read(istream* in, string& value) {
+        readContiguous(in, value, readSize(in), 1);
+    }
+
+    template<typename T>
+    static void write(ostream* out, const vector<T>& values) {
+        writeSize(out, values.size());
+        writeElements(out, values, IsContiguous<T>());
+    }
+
+    template<typename T>
+    static void read(istream* in, vector<T>& values) {
+        readElements(in, values, readSize(in), IsContiguous<T>());
+    }
+
+    static void readBytes(istream* in, char* bytes, size_t count) {
+        in->read(bytes, count);
+        if ((size_t) in->gcount() != count) {
+            throw runtime_error("Snapshot is truncated");
+        }
+    }
+
+private:
+    // vector<bool> does not store its elements contiguously.
+    template<typename T>
+    using IsContiguous = integral_constant<bool, is_arithmetic<T>::value && !is_same<T, bool>::value>;
+
+    template<typename T>
+    static void writeElements(ostream* out, const vector<T>& values, true_type) {
+        out->write((const char*) values.data(), values.size() * sizeof(T));
+    }
+
+    template<typename T>
+    static void writeElements(ostream* out, const vector<T>& values, false_type) {
+        for (const T& value : values) {
+            write(out, value);
+        }
+    }
+
+    template<typename T>
+    static void readElements(istream* in, vector<T>& values, size_t size, true_type) {
+        readContiguous(in, values, size, sizeof(T));
+    }
+
+    template<typename T>
+    static void readElements(istream* in, vector<T>& values, size_t size, false_type) {
+        values.clear();
+        for (size_t i = 0; i < size; i++) {
+            T value;
+            read(in, value);
+            values.push_back(value);
+        }
+    }
+
+    template<typename Container>
+    static void readContiguous(istream* in, Container& values, size_t size, size_t elementSize) {
+        values.clear();
+        for (size_t begin = 0; begin < size; ) {
+            size_t count = min(size - begin, READ_CHUNK_SIZE / elementSize);
+            values.resize(begin + count);
+            readBytes(in, (char*) &values[begin], count * elementSize);
+            begin += count;
+        }
+    }
+};
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "tcframe/spec/random/Random.hpp"
+
+using std::function;
+using std::min;
+using std::runtime_error;
+using std::unique_ptr;
+
+namespace tcframe {
+
+/*
+ * A vector whose elements are produced on demand, instead of being held in memory. The elements are produced in
+ * order, one chunk at a time, each time the vector is traversed: once by each constraint helper that checks it, and
+ * once when it is printed. Therefore, the producer must produce the same elements on every traversal.
+ *
+ * When parsed, e.g. as part of the output of the solution, the elements are only validated and counted.
+ */
+template<typename T>
+class StreamedVector {
+public:
+    static const size_t CHUNK_SIZE = 4096;
+
+private:
+    long long size_;
+    function<T(long long)> producer_;
+    function<T(Random&)> randomProducer_;
+    unsigned seed_;
+
+public:
+    StreamedVector()
+            : size_(0)
+            , seed_(0) {}
+
+    /* A vector of the given size, whose i-th element is producer(i). */
+    StreamedVector(long long size, function<T(long long)> producer)
+            : size_(size)
+            , producer_(producer)
+            , seed_(0) {}
+
+    /*
+     * A vector of the given size, whose elements are producer(r) in order, where r is a random number generator
+     * seeded from rnd. The same seed is used on every traversal.
+     */
+    StreamedVector(long long size, Random& rnd, function<T(Random&)> producer)
+            : size_(size)
+            , randomProducer_(producer)
+            , seed_((unsigned) rnd.nextLongLong(0, 4294967295LL)) {}
+
+    long long size() const {
+        return size_;
+    }
+
+    bool hasProducer() const {
+        return producer_ || randomProducer_;
+    }
+
+    /*
+     * Produces the elements in order, calling consume(elements, begin, count) for each chunk of at most CHUNK_SIZE
+     * elements starting at index begin, until consume returns false.
+     */
+    template<typename Consumer>
+    void forEachChunk(Consumer consume) const {
+        if (size_ > 0 && !hasProducer()) {
+            throw runtime_error("The elements of a parsed streamed vector are not kept");
+        }
+
+        Random random;
+        random.setSeed(seed_);
+
+        unique_ptr<T[]> chunk(new T[(size_t) min((long long) CHUNK_SIZE, size_)]);
+        for (long long begin = 0; begin < size_; begin += CHUNK_SIZE) {
+            size_t count = (size_t) min((long long) CHUNK_SIZE, size_ - begin);
+            for (size_t i = 0; i < count; i++) {
+                chunk[i] = producer_ ? producer_(begin + i) : randomProducer_(random);
+            }
+            if (!consume((const T*) chunk.get(), begin, count)) {
+                return;
+            }
+        }
+    }
+
+    /* Records that count elements were parsed; the elements themselves are not kept. */
+    static StreamedVector parsed(long long count) {
+        StreamedVector v;
+        v.size_ = count;
+        return v;
+    }
+};
+
+}
@@ -16,7 +16,7 @@ public:
         return "'" + name + "'";
     }
 
-    static string formatVectorElement(const string& name, int index) {
+    static string formatVectorElement(const string& name, long long index) {
         ostringstream sout;
         sout << "'" << name << "[" << index << "]'";
         return sout.str();
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <cctype>
 #include <iostream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <type_traits>
 
+#include "SnapshotCodec.hpp"
+#include "TokenFormatter.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::char_traits;
@@ -33,10 +36,13 @@ enum class VariableType {
     MATRIX
 };
 
+class VariableStatistics;
+
 class Variable {
 private:
     string name_;
     VariableType type_;
+    VariableStatistics* statistics_;
 
 public:
     virtual ~Variable() {}
@@ -49,6 +55,21 @@ public:
         return type_;
     }
 
+    /* The statistics that the values of this variable are added to whenever they are printed, if any. */
+    VariableStatistics* statistics() const {
+        return statistics_;
+    }
+
+    void setStatistics(VariableStatistics* statistics) {
+        statistics_ = statistics;
+    }
+
+    /* Writes the current value of this variable, in the compact binary form of SnapshotCodec. */
+    virtual void snapshotTo(ostream* out) = 0;
+
+    /* Sets the value of this variable to the one written by snapshotTo(). */
+    virtual void restoreFrom(istream* in) = 0;
+
     bool equals(Variable* o) const {
         return tie(name_, type_) == tie(o->name_, o->type_);
     }
@@ -56,12 +77,37 @@ public:
 protected:
     Variable(const string& name, VariableType type)
             : name_(name)
-            , type_(type) {}
+            , type_(type)
+            , statistics_(nullptr) {}
+
+    /* Each snapshot of a variable starts with its type code, which is checked again when it is restored. */
+    void writeSnapshotTypeCode(ostream* out, const string& typeCode) const {
+        SnapshotCodec::write(out, typeCode);
+    }
+
+    void readSnapshotTypeCode(istream* in, const string& typeCode) const {
+        string snapshotTypeCode;
+        SnapshotCodec::read(in, snapshotTypeCode);
+        if (snapshotTypeCode != typeCode) {
+            throw runtime_error("Snapshot of " + TokenFormatter::formatVariable(name_) + " does not match its type");
+        }
+    }
 
     template<typename T>
     static void parseValue(istream* in, T& val, const string& context) {
-        WhitespaceManipulator::ensureNoEof(in, context);
-        WhitespaceManipulator::ensureNoWhitespace(in, context);
+        parseValueLazily(in, val, [&] {return context;});
+    }
+
+    /* Same as parseValue(), but only calls formatContext() when the value cannot be parsed. */
+    template<typename T, typename ContextFormatter>
+    static void parseValueLazily(istream* in, T& val, ContextFormatter formatContext) {
+        int next = in->peek();
+        if (next == char_traits<char>::eof()) {
+            WhitespaceManipulator::ensureNoEof(in, formatContext());
+        }
+        if (isspace(next)) {
+            WhitespaceManipulator::ensureNoWhitespace(in, formatContext());
+        }
 
         long long currentPos = in->tellg();
         *in >> val;
@@ -73,7 +119,7 @@ protected:
             string found;
             *in >> found;
 
-            throw runtime_error("Cannot parse for " + context + ". Found: '" + found + "'");
+            throw runtime_error("Cannot parse for " + formatContext() + ". Found: '" + found + "'");
         }
     }
 };
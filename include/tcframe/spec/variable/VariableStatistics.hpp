@@ -0,0 +1,137 @@
+#pragma once
+
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include "Variable.hpp"
+
+using std::distance;
+using std::false_type;
+using std::integral_constant;
+using std::is_arithmetic;
+using std::is_integral;
+using std::is_same;
+using std::iterator_traits;
+using std::string;
+using std::true_type;
+
+namespace tcframe {
+
+/*
+ * Statistics of the values of a variable in an input, gathered while the values are printed. The range of the values
+ * is only kept for numbers.
+ */
+class VariableStatistics {
+private:
+    string name_;
+    VariableType type_;
+    long long valuesCount_;
+    long long tokensCount_;
+    bool hasRange_;
+    bool integral_;
+    long double min_;
+    long double max_;
+
+public:
+    VariableStatistics(const string& name, VariableType type)
+            : name_(name)
+            , type_(type) {
+        clear();
+    }
+
+    const string& name() const {
+        return name_;
+    }
+
+    VariableType type() const {
+        return type_;
+    }
+
+    long long valuesCount() const {
+        return valuesCount_;
+    }
+
+    /* The number of whitespace-separated tokens that the values were printed as. */
+    long long tokensCount() const {
+        return tokensCount_;
+    }
+
+    /* Whether some numbers were added, so that min() and max() are known. */
+    bool hasRange() const {
+        return hasRange_;
+    }
+
+    bool isIntegral() const {
+        return integral_;
+    }
+
+    long double min() const {
+        return min_;
+    }
+
+    long double max() const {
+        return max_;
+    }
+
+    void clear() {
+        valuesCount_ = 0;
+        tokensCount_ = 0;
+        hasRange_ = false;
+        integral_ = false;
+        min_ = 0;
+        max_ = 0;
+    }
+
+    template<typename T>
+    void add(const T& value) {
+        addAll(&value, &value + 1);
+    }
+
+    /* Adds values that are printed as one token each. */
+    template<typename It>
+    void addAll(It begin, It end) {
+        addAll(begin, end, -1);
+    }
+
+    /* Adds values that are printed as the given number of tokens, or as one token each if it is -1. */
+    template<typename It>
+    void addAll(It begin, It end, long long tokensCount) {
+        typedef typename iterator_traits<It>::value_type T;
+        long long count = (long long) distance(begin, end);
+        valuesCount_ += count;
+        tokensCount_ += tokensCount == -1 ? count : tokensCount;
+        if (count > 0) {
+            addRange(begin, end, integral_constant<bool, is_arithmetic<T>::value && !is_same<T, char>::value>());
+        }
+    }
+
+private:
+    template<typename It>
+    void addRange(It begin, It end, true_type) {
+        typedef typename iterator_traits<It>::value_type T;
+
+        // Written without branches, so that it is vectorized.
+        T lo = *begin;
+        T hi = *begin;
+        for (It it = begin; it != end; ++it) {
+            T value = *it;
+            lo = value < lo ? value : lo;
+            hi = value > hi ? value : hi;
+        }
+
+        if (!hasRange_ || lo < min_) {
+            min_ = lo;
+        }
+        if (!hasRange_ || hi > max_) {
+            max_ = hi;
+        }
+        hasRange_ = true;
+        integral_ = is_integral<T>::value;
+    }
+
+    template<typename It>
+    void addRange(It, It, false_type) {}
+};
+
+}
@@ -5,14 +5,17 @@
 #include <iostream>
 #include <vector>
 
+#include "StreamedVector.hpp"
 #include "TokenFormatter.hpp"
 #include "Variable.hpp"
+#include "VariableStatistics.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::iostream;
 using std::ostream;
 using std::reference_wrapper;
 using std::ref;
+using std::runtime_error;
 using std::vector;
 
 namespace tcframe {
@@ -34,10 +37,13 @@ public:
 
     template<typename T, typename = ScalarCompatible<T>>
     static Vector* create(vector<T>& var, const string& name);
+
+    template<typename T, typename = ScalarCompatible<T>>
+    static Vector* create(StreamedVector<T>& var, const string& name);
 };
 
 template<typename T, typename = ScalarCompatible<T>>
-class VectorImpl : public Vector {
+class VectorImpl final : public Vector {
 private:
     reference_wrapper<vector<T>> var_;
 
@@ -47,6 +53,10 @@ public:
             , var_(ref(var))
     {}
 
+    const vector<T>& value() const {
+        return var_.get();
+    }
+
     int size() const {
         return (int) var_.get().size();
     }
@@ -64,10 +74,16 @@ public:
             first = false;
             *out << element;
         }
+        if (statistics() != nullptr) {
+            statistics()->addAll(var_.get().begin(), var_.get().end());
+        }
     }
 
     void printElementTo(int index, ostream* out) {
         *out << var_.get()[index];
+        if (statistics() != nullptr) {
+            statistics()->add(var_.get()[index]);
+        }
     }
 
     void parseFrom(istream* in) {
@@ -75,7 +91,7 @@ public:
             if (WhitespaceManipulator::canParseNewline(in)) {
                 break;
             }
-            if (i > 0) {
+            if (i > 0 && !WhitespaceManipulator::skipSpace(in)) {
                 WhitespaceManipulator::parseSpaceAfterMissingNewline(
                         in,
                         TokenFormatter::formatVectorElement(name(), i - 1));
@@ -86,7 +102,7 @@ public:
 
     void parseFrom(istream* in, int size) {
         for (int i = 0; i < size; i++) {
-            if (i > 0) {
+            if (i > 0 && !WhitespaceManipulator::skipSpace(in)) {
                 WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(name(), i - 1));
             }
             parseAndAddElementFrom(in);
@@ -96,9 +112,19 @@ public:
     void parseAndAddElementFrom(istream* in) {
         int index = size();
         T element;
-        Variable::parseValue(in, element, TokenFormatter::formatVectorElement(name(), index));
+        Variable::parseValueLazily(in, element, [&] {return TokenFormatter::formatVectorElement(name(), index);});
         var_.get().push_back(element);
     }
+
+    void snapshotTo(ostream* out) {
+        writeSnapshotTypeCode(out, "v" + SnapshotCodec::typeCode<T>());
+        SnapshotCodec::write(out, var_.get());
+    }
+
+    void restoreFrom(istream* in) {
+        readSnapshotTypeCode(in, "v" + SnapshotCodec::typeCode<T>());
+        SnapshotCodec::read(in, var_.get());
+    }
 };
 
 template<typename T, typename>
@@ -106,4 +132,104 @@ Vector* Vector::create(vector<T>& var, const string& name) {
     return new VectorImpl<T>(var, name);
 }
 
+/*
+ * A streamed vector can only be printed or parsed as a whole, so it is supported in line segments only. Its elements
+ * are never held in memory, so it cannot be snapshotted either.
+ */
+template<typename T, typename = ScalarCompatible<T>>
+class StreamedVectorImpl final : public Vector {
+private:
+    reference_wrapper<StreamedVector<T>> var_;
+
+public:
+    StreamedVectorImpl(StreamedVector<T>& var, const string& name)
+            : Vector(name)
+            , var_(ref(var))
+    {}
+
+    int size() const {
+        return (int) var_.get().size();
+    }
+
+    void clear() {
+        var_.get() = StreamedVector<T>();
+    }
+
+    void printTo(ostream* out) {
+        StreamedVector<T>& var = var_.get();
+        if (var.size() > 0 && !var.hasProducer()) {
+            throw runtime_error("Streamed vector " + TokenFormatter::formatVariable(name()) + " has no producer");
+        }
+
+        VariableStatistics* statistics = this->statistics();
+        var.forEachChunk([=] (const T* elements, long long begin, size_t count) -> bool {
+            for (size_t i = 0; i < count; i++) {
+                if (begin + i > 0) {
+                    *out << ' ';
+                }
+                *out << elements[i];
+            }
+            if (statistics != nullptr) {
+                statistics->addAll(elements, elements + count);
+            }
+            return true;
+        });
+    }
+
+    void printElementTo(int, ostream*) {
+        throw runtime_error(
+                "Streamed vector " + TokenFormatter::formatVariable(name()) + " is only supported in a line segment");
+    }
+
+    void parseFrom(istream* in) {
+        long long count;
+        for (count = 0; ; count++) {
+            if (WhitespaceManipulator::canParseNewline(in)) {
+                break;
+            }
+            if (count > 0 && !WhitespaceManipulator::skipSpace(in)) {
+                WhitespaceManipulator::parseSpaceAfterMissingNewline(
+                        in,
+                        TokenFormatter::formatVectorElement(name(), count - 1));
+            }
+            parseElementFrom(in, count);
+        }
+        var_.get() = StreamedVector<T>::parsed(count);
+    }
+
+    void parseFrom(istream* in, int size) {
+        for (long long i = 0; i < size; i++) {
+            if (i > 0 && !WhitespaceManipulator::skipSpace(in)) {
+                WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(name(), i - 1));
+            }
+            parseElementFrom(in, i);
+        }
+        var_.get() = StreamedVector<T>::parsed(size);
+    }
+
+    void parseAndAddElementFrom(istream*) {
+        throw runtime_error(
+                "Streamed vector " + TokenFormatter::formatVariable(name()) + " is only supported in a line segment");
+    }
+
+    void snapshotTo(ostream*) {
+        throw runtime_error("Streamed vector " + TokenFormatter::formatVariable(name()) + " cannot be snapshotted");
+    }
+
+    void restoreFrom(istream*) {
+        throw runtime_error("Streamed vector " + TokenFormatter::formatVariable(name()) + " cannot be snapshotted");
+    }
+
+private:
+    void parseElementFrom(istream* in, long long index) {
+        T element;
+        Variable::parseValueLazily(in, element, [&] {return TokenFormatter::formatVectorElement(name(), index);});
+    }
+};
+
+template<typename T, typename>
+Vector* Vector::create(StreamedVector<T>& var, const string& name) {
+    return new StreamedVectorImpl<T>(var, name);
+}
+
 }
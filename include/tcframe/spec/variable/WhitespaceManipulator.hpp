@@ -30,6 +30,23 @@ public:
         }
     }
 
+    /* Consumes a space if there is one; callers format their error context only when this fails. */
+    static bool skipSpace(istream* in) {
+        if (in->peek() != ' ') {
+            return false;
+        }
+        in->get();
+        return true;
+    }
+
+    static bool skipNewline(istream* in) {
+        if (in->peek() != '\n') {
+            return false;
+        }
+        in->get();
+        return true;
+    }
+
     static bool canParseNewline(istream* in) {
         return in->peek() == '\n';
     }
@@ -0,0 +1,5 @@
+#pragma once
+
+#include "tcframe/stresser/Stresser.hpp"
+#include "tcframe/stresser/StresserConfig.hpp"
+#include "tcframe/stresser/StresserLogger.hpp"
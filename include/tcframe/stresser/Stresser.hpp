@@ -0,0 +1,388 @@
+#pragma once
+
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <vector>
+
+#include "StresserConfig.hpp"
+#include "StresserLogger.hpp"
+#include "tcframe/io_manipulator.hpp"
+#include "tcframe/os.hpp"
+#include "tcframe/spec/random.hpp"
+#include "tcframe/testcase.hpp"
+#include "tcframe/util.hpp"
+#include "tcframe/verifier.hpp"
+
+using std::exception;
+using std::function;
+using std::istreambuf_iterator;
+using std::istringstream;
+using std::ostringstream;
+using std::runtime_error;
+using std::set;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Runs the closure of a test case over and over with fresh seeds, spread across worker processes, until the solutions
+ * disagree on the input it produces. The closure is expected to draw the input from rnd. The failing input is then
+ * shrunk, and written together with the outputs of the solutions as a reproducer.
+ */
+class Stresser {
+private:
+    static const int MAX_SHRINKING_ATTEMPTS = 10000;
+    static const int MAX_SHRINKING_RUNS = 1000;
+
+    Random* random_;
+    Verifier* verifier_;
+    IOManipulator* ioManipulator_;
+    OperatingSystem* os_;
+    WorkerPool* workerPool_;
+    StresserLogger* logger_;
+
+public:
+    virtual ~Stresser() {}
+
+    Stresser(
+            Random* random,
+            Verifier* verifier,
+            IOManipulator* ioManipulator,
+            OperatingSystem* os,
+            WorkerPool* workerPool,
+            StresserLogger* logger)
+            : random_(random)
+            , verifier_(verifier)
+            , ioManipulator_(ioManipulator)
+            , os_(os)
+            , workerPool_(workerPool)
+            , logger_(logger) {}
+
+    virtual bool stress(const TestSuite& testSuite, const StresserConfig& config) {
+        logger_->logIntroduction(config.testCaseId(), config.iterationsCount(), config.jobsCount());
+
+        const TestCase* testCase = findTestCase(testSuite, config.testCaseId());
+        if (testCase == nullptr) {
+            logger_->logTestCaseNotFound(config.testCaseId());
+            logger_->logFailedResult();
+            return false;
+        }
+
+        // Shared by the worker processes, so that they all stop soon after any of them finds a failure.
+        volatile int* stopped = (volatile int*) mmap(
+                nullptr, sizeof(int), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (stopped == MAP_FAILED) {
+            throw runtime_error("Cannot map memory shared by the workers");
+        }
+        *stopped = 0;
+
+        Stopwatch stopwatch;
+        vector<string> workerResults;
+        try {
+            workerResults = workerPool_->run(
+                    config.jobsCount(),
+                    config.jobsCount(),
+                    [&] (int worker) {
+                        int iterationsCount = 0;
+                        for (int i = worker; i < config.iterationsCount() && !*stopped; i += config.jobsCount()) {
+                            iterationsCount++;
+                            string input;
+                            if (!runIteration(*testCase, config, i, input).empty()) {
+                                *stopped = 1;
+                                return StringUtils::toString(iterationsCount) + " " + StringUtils::toString(i);
+                            }
+                        }
+                        return StringUtils::toString(iterationsCount);
+                    });
+        } catch (exception& e) {
+            munmap((void*) stopped, sizeof(int));
+            logger_->logSimpleFailure(e.what());
+            logger_->logFailedResult();
+            return false;
+        }
+        double seconds = stopwatch.elapsedSeconds();
+        munmap((void*) stopped, sizeof(int));
+
+        int iterationsCount = 0;
+        int failedIteration = -1;
+        for (const string& workerResult : workerResults) {
+            istringstream in(workerResult);
+            int workerIterationsCount;
+            int workerFailedIteration;
+            in >> workerIterationsCount;
+            iterationsCount += workerIterationsCount;
+            if (in >> workerFailedIteration && (failedIteration == -1 || workerFailedIteration < failedIteration)) {
+                failedIteration = workerFailedIteration;
+            }
+        }
+
+        if (failedIteration == -1) {
+            logger_->logSuccessfulResult(iterationsCount, seconds);
+            return true;
+        }
+        reportFailure(*testCase, config, failedIteration);
+        logger_->logFailedResult();
+        return false;
+    }
+
+private:
+    static const TestCase* findTestCase(const TestSuite& testSuite, const string& testCaseId) {
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                if (testCase.id() == testCaseId) {
+                    return &testCase;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    static unsigned seedOf(const StresserConfig& config, int iteration) {
+        return config.seed() + (unsigned) iteration;
+    }
+
+    /* Returns the failures of the iteration, if any; the printed input, if it got that far, is put into input. */
+    vector<string> runIteration(const TestCase& testCase, const StresserConfig& config, int iteration, string& input) {
+        random_->setSeed(seedOf(config, iteration));
+        try {
+            testCase.applier()();
+        } catch (runtime_error& e) {
+            return {e.what()};
+        }
+
+        vector<string> failures = verify(testCase.subtaskIds());
+        input = printInput();
+        if (!failures.empty()) {
+            return failures;
+        }
+        return runSolutions(config, input);
+    }
+
+    /* Only the constraints of the assigned subtasks matter; a small random input may well satisfy other subtasks. */
+    vector<string> verify(const set<int>& subtaskIds) {
+        ConstraintsVerificationResult result = verifier_->verifyConstraints(subtaskIds);
+        return ConstraintsVerificationResult(result.unsatisfiedConstraintDescriptionsBySubtaskId(), {})
+                .describeFailures();
+    }
+
+    string printInput() {
+        ostringstream out;
+        ioManipulator_->printInput(&out);
+        return out.str();
+    }
+
+    static string completeInput(const StresserConfig& config, const string& input) {
+        return config.multipleTestCasesCount() != nullptr ? "1\n" + input : input;
+    }
+
+    static vector<string> solutionCommands(const StresserConfig& config) {
+        vector<string> commands = {config.solutionCommand()};
+        commands.insert(
+                commands.end(),
+                config.alternativeSolutionCommands().begin(),
+                config.alternativeSolutionCommands().end());
+        return commands;
+    }
+
+    static string readOutput(const ExecutionResult& result) {
+        return string(istreambuf_iterator<char>(*result.outputStream()), istreambuf_iterator<char>());
+    }
+
+    vector<string> runSolutions(const StresserConfig& config, const string& input) {
+        vector<string> commands = solutionCommands(config);
+        vector<ExecutionResult> results = os_->executeConcurrentlyOnInput(commands, completeInput(config, input));
+
+        vector<string> failures;
+        for (int i = 0; i < commands.size(); i++) {
+            if (results[i].exitStatus() != 0) {
+                failures.push_back(commands[i] + ": " + results[i].describeExitStatus());
+            }
+        }
+        if (!failures.empty()) {
+            return failures;
+        }
+
+        string output = readOutput(results[0]);
+        for (int i = 1; i < commands.size(); i++) {
+            if (readOutput(results[i]) != output) {
+                failures.push_back(commands[i] + ": output differs from " + commands[0]);
+            }
+        }
+        return failures;
+    }
+
+    void reportFailure(const TestCase& testCase, const StresserConfig& config, int iteration) {
+        string input;
+        vector<string> failures = runIteration(testCase, config, iteration, input);
+        if (failures.empty()) {
+            logger_->logIterationNotReproduced(iteration, seedOf(config, iteration));
+            return;
+        }
+        logger_->logIterationFailure(iteration, seedOf(config, iteration), failures);
+        if (input.empty()) {
+            return;
+        }
+
+        string shrunkInput = shrink(testCase, config, input);
+        string inputFilename = writeReproducer(config, shrunkInput);
+        logger_->logReproducerWritten(
+                inputFilename,
+                completeInput(config, shrunkInput).size(),
+                completeInput(config, input).size());
+    }
+
+    /*
+     * Greedily removes lines, then tokens within each line, from the input. A removal is kept when the result still
+     * parses, satisfies the constraints, and makes the solutions fail; the input is then printed again in canonical
+     * form.
+     */
+    string shrink(const TestCase& testCase, const StresserConfig& config, const string& input) {
+        string shrunkInput = input;
+        int attemptsCount = 0;
+        int runsCount = 0;
+        auto stillFails = [&] (const vector<vector<string>>& lines) {
+            if (attemptsCount++ >= MAX_SHRINKING_ATTEMPTS || runsCount >= MAX_SHRINKING_RUNS) {
+                return false;
+            }
+            istringstream in(joinLines(lines));
+            try {
+                ioManipulator_->parseInput(&in);
+            } catch (runtime_error&) {
+                return false;
+            }
+            if (!verify(testCase.subtaskIds()).empty()) {
+                return false;
+            }
+            string candidateInput = printInput();
+            runsCount++;
+            if (runSolutions(config, candidateInput).empty()) {
+                return false;
+            }
+            shrunkInput = candidateInput;
+            return true;
+        };
+
+        vector<vector<string>> lines;
+        for (const string& line : StringUtils::split(input, '\n')) {
+            lines.push_back(StringUtils::split(line, ' '));
+        }
+
+        removeChunks(lines.size(), [&] (int start, int size) {
+            vector<vector<string>> candidate = lines;
+            candidate.erase(candidate.begin() + start, candidate.begin() + start + size);
+            return tryRemoval(lines, candidate, start, 0, size, stillFails);
+        });
+        for (int i = 0; i < lines.size(); i++) {
+            removeChunks(lines[i].size(), [&] (int start, int size) {
+                vector<vector<string>> candidate = lines;
+                candidate[i].erase(candidate[i].begin() + start, candidate[i].begin() + start + size);
+                return tryRemoval(lines, candidate, i, start, size, stillFails);
+            });
+        }
+        return shrunkInput;
+    }
+
+    /* Removes ever smaller chunks of a sequence of units, for as long as the units are left. */
+    static void removeChunks(int unitsCount, const function<bool(int, int)>& tryRemoval) {
+        for (int chunkSize = (unitsCount + 1) / 2; chunkSize >= 1; chunkSize /= 2) {
+            for (int start = 0; start + chunkSize <= unitsCount;) {
+                if (tryRemoval(start, chunkSize)) {
+                    unitsCount -= chunkSize;
+                } else {
+                    start += chunkSize;
+                }
+            }
+        }
+    }
+
+    /*
+     * Keeps the candidate, from which removedCount units were removed at the given position, if it still fails.
+     * Otherwise, since the input usually states how many elements follow, tries again with each integer token before
+     * that position, nearest first, decreased by removedCount.
+     */
+    static bool tryRemoval(
+            vector<vector<string>>& lines,
+            vector<vector<string>> candidate,
+            int line,
+            int token,
+            int removedCount,
+            const function<bool(const vector<vector<string>>&)>& stillFails) {
+
+        if (stillFails(candidate)) {
+            lines = candidate;
+            return true;
+        }
+        for (int i = line; i >= 0; i--) {
+            for (int j = (i == line ? token : (int) candidate[i].size()) - 1; j >= 0; j--) {
+                long long count;
+                char trailing;
+                if (sscanf(candidate[i][j].c_str(), "%lld%c", &count, &trailing) != 1 || count < removedCount) {
+                    continue;
+                }
+                string original = candidate[i][j];
+                candidate[i][j] = StringUtils::toString(count - removedCount);
+                if (stillFails(candidate)) {
+                    lines = candidate;
+                    return true;
+                }
+                candidate[i][j] = original;
+            }
+        }
+        return false;
+    }
+
+    static string joinLines(const vector<vector<string>>& lines) {
+        string joined;
+        for (const vector<string>& tokens : lines) {
+            for (int i = 0; i < tokens.size(); i++) {
+                joined += (i > 0 ? " " : "") + tokens[i];
+            }
+            joined += "\n";
+        }
+        return joined;
+    }
+
+    /* Writes the input, and the output of each solution on it; returns the name of the input file. */
+    string writeReproducer(const StresserConfig& config, const string& input) {
+        string baseFilename = config.testCaseId() + "_stress";
+        writeFile(baseFilename + ".in", completeInput(config, input));
+
+        vector<string> commands = solutionCommands(config);
+        vector<ExecutionResult> results = os_->executeConcurrentlyOnInput(commands, completeInput(config, input));
+        for (int i = 0; i < commands.size(); i++) {
+            writeFile(baseFilename + "_" + StringUtils::toString(i + 1) + ".out", readOutput(results[i]));
+        }
+        return baseFilename + ".in";
+    }
+
+    void writeFile(const string& filename, const string& contents) {
+        ScopedWritingStream out(os_, os_->openForWriting(filename));
+        *out.get() << contents;
+    }
+};
+
+class StresserFactory {
+public:
+    virtual ~StresserFactory() {}
+
+    virtual Stresser* create(
+            Random* random,
+            Verifier* verifier,
+            IOManipulator* ioManipulator,
+            OperatingSystem* os,
+            WorkerPool* workerPool,
+            StresserLogger* logger) {
+
+        return new Stresser(random, verifier, ioManipulator, os, workerPool, logger);
+    }
+};
+
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "tcframe/spec/core.hpp"
+
+using std::move;
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+struct StresserConfig {
+    friend class StresserConfigBuilder;
+
+private:
+    string testCaseId_;
+    int* multipleTestCasesCount_;
+    unsigned seed_;
+    string solutionCommand_;
+    vector<string> alternativeSolutionCommands_;
+    int iterationsCount_;
+    int jobsCount_;
+
+public:
+    /* The test case whose closure produces the random inputs. */
+    const string& testCaseId() const {
+        return testCaseId_;
+    }
+
+    int* multipleTestCasesCount() const {
+        return multipleTestCasesCount_;
+    }
+
+    /* The seed of the first iteration; iteration i is run with seed() + i. */
+    unsigned seed() const {
+        return seed_;
+    }
+
+    const string& solutionCommand() const {
+        return solutionCommand_;
+    }
+
+    /* The commands of the solutions whose outputs must agree with the output of solutionCommand(). */
+    const vector<string>& alternativeSolutionCommands() const {
+        return alternativeSolutionCommands_;
+    }
+
+    int iterationsCount() const {
+        return iterationsCount_;
+    }
+
+    int jobsCount() const {
+        return jobsCount_;
+    }
+
+    bool operator==(const StresserConfig& o) const {
+        return tie(testCaseId_, multipleTestCasesCount_, seed_, solutionCommand_, alternativeSolutionCommands_,
+                   iterationsCount_, jobsCount_) ==
+                tie(o.testCaseId_, o.multipleTestCasesCount_, o.seed_, o.solutionCommand_,
+                    o.alternativeSolutionCommands_, o.iterationsCount_, o.jobsCount_);
+    }
+};
+
+class StresserConfigBuilder {
+private:
+    StresserConfig subject_;
+
+public:
+    StresserConfigBuilder(const StresserConfig& from)
+            : subject_(from)
+    {}
+
+    StresserConfigBuilder() {
+        subject_.multipleTestCasesCount_ = nullptr;
+        subject_.seed_ = DefaultValues::seed();
+        subject_.solutionCommand_ = DefaultValues::solutionCommand();
+        subject_.iterationsCount_ = DefaultValues::stressIterationsCount();
+        subject_.jobsCount_ = 1;
+    }
+
+    StresserConfigBuilder& setTestCaseId(string testCaseId) {
+        subject_.testCaseId_ = testCaseId;
+        return *this;
+    }
+
+    StresserConfigBuilder& setMultipleTestCasesCount(int* var) {
+        subject_.multipleTestCasesCount_ = var;
+        return *this;
+    }
+
+    StresserConfigBuilder& setSeed(unsigned seed) {
+        subject_.seed_ = seed;
+        return *this;
+    }
+
+    StresserConfigBuilder& setSolutionCommand(string solutionCommand) {
+        subject_.solutionCommand_ = solutionCommand;
+        return *this;
+    }
+
+    StresserConfigBuilder& setAlternativeSolutionCommands(const vector<string>& alternativeSolutionCommands) {
+        subject_.alternativeSolutionCommands_ = alternativeSolutionCommands;
+        return *this;
+    }
+
+    StresserConfigBuilder& setIterationsCount(int iterationsCount) {
+        subject_.iterationsCount_ = iterationsCount;
+        return *this;
+    }
+
+    StresserConfigBuilder& setJobsCount(int jobsCount) {
+        subject_.jobsCount_ = jobsCount;
+        return *this;
+    }
+
+    StresserConfig build() {
+        return move(subject_);
+    }
+};
+
+}
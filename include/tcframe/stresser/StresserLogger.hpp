@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "tcframe/logger.hpp"
+#include "tcframe/util.hpp"
+
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+class StresserLogger : public BaseLogger {
+public:
+    virtual ~StresserLogger() {}
+
+    StresserLogger(LoggerEngine* engine)
+            : BaseLogger(engine) {}
+
+    virtual void logIntroduction(const string& testCaseId, int iterationsCount, int jobsCount) {
+        engine_->logParagraph(0, "Stress testing " + testCaseId + " for " + StringUtils::toString(iterationsCount)
+                + " iterations on " + StringUtils::toString(jobsCount) + " workers...");
+    }
+
+    virtual void logTestCaseNotFound(const string& testCaseId) {
+        engine_->logParagraph(1, "Test case " + testCaseId + " not found.");
+    }
+
+    virtual void logIterationFailure(int iteration, unsigned seed, const vector<string>& failures) {
+        engine_->logParagraph(1, "Iteration " + StringUtils::toString(iteration) + " (seed "
+                + StringUtils::toString(seed) + "): FAILED");
+        engine_->logParagraph(2, "Reasons:");
+        for (const string& failure : failures) {
+            engine_->logListItem1(2, failure);
+        }
+    }
+
+    virtual void logIterationNotReproduced(int iteration, unsigned seed) {
+        engine_->logParagraph(1, "Iteration " + StringUtils::toString(iteration) + " (seed "
+                + StringUtils::toString(seed) + ") failed, but passed when run again.");
+    }
+
+    virtual void logReproducerWritten(const string& inputFilename, long long inputSize, long long originalInputSize) {
+        engine_->logParagraph(1, "Reproducer written to " + inputFilename + " ("
+                + StringUtils::toString(inputSize) + " bytes, shrunk from "
+                + StringUtils::toString(originalInputSize) + " bytes).");
+    }
+
+    virtual void logSimpleFailure(const string& message) {
+        engine_->logListItem1(1, message);
+    }
+
+    virtual void logSuccessfulResult(int iterationsCount, double seconds) {
+        long long throughput = seconds > 0 ? (long long) (iterationsCount / seconds) : iterationsCount;
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Stress testing finished. All " + StringUtils::toString(iterationsCount)
+                + " iterations OK (" + StringUtils::toString(throughput) + " iterations/s).");
+    }
+
+    virtual void logFailedResult() {
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Stress testing finished. Some iteration FAILED.");
+    }
+};
+
+}
@@ -36,15 +36,13 @@ public:
         return subtaskIds_;
     }
 
-    const function<void()> applier() const {
+    const function<void()>& applier() const {
         return applier_;
     }
 
     bool operator==(const TestCase& o) const {
         return tie(id_, description_, subtaskIds_) == tie(o.id_, o.description_, o.subtaskIds_);
     }
-
-
 };
 
 class TestCaseBuilder {
@@ -53,22 +51,22 @@ private:
 
 public:
     TestCaseBuilder& setId(string id) {
-        subject_.id_ = id;
+        subject_.id_ = move(id);
         return *this;
     }
 
     TestCaseBuilder& setDescription(string description) {
-        subject_.description_ = description;
+        subject_.description_ = move(description);
         return *this;
     }
 
     TestCaseBuilder& setSubtaskIds(set<int> subtaskIds) {
-        subject_.subtaskIds_ = subtaskIds;
+        subject_.subtaskIds_ = move(subtaskIds);
         return *this;
     }
 
     TestCaseBuilder& setApplier(function<void()> applier) {
-        subject_.applier_ = applier;
+        subject_.applier_ = move(applier);
         return *this;
     }
 
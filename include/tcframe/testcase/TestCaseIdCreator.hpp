@@ -5,6 +5,7 @@
 #include "tcframe/util.hpp"
 
 using std::string;
+using std::to_string;
 
 namespace tcframe {
 
@@ -13,7 +14,11 @@ public:
     TestCaseIdCreator() = delete;
 
     static string create(const string& slug, int testGroupId, int testCaseNo) {
-        return createBaseId(slug, testGroupId) + "_" + StringUtils::toString(testCaseNo);
+        return createFromBaseId(createBaseId(slug, testGroupId), testCaseNo);
+    }
+
+    static string createFromBaseId(const string& baseId, int testCaseNo) {
+        return baseId + "_" + to_string(testCaseNo);
     }
 
     static string createBaseId(const string& slug, int testGroupId) {
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "TestCaseIdCreator.hpp"
@@ -10,6 +13,10 @@
 #include "tcframe/spec/raw_testcase.hpp"
 #include "tcframe/util.hpp"
 
+using std::function;
+using std::make_shared;
+using std::move;
+using std::shared_ptr;
 using std::tie;
 using std::vector;
 
@@ -20,18 +27,22 @@ private:
     vector<TestGroup> testGroups_;
 
 public:
-    TestSuite(const vector<TestGroup>& testGroups)
-            : testGroups_(testGroups) {}
+    TestSuite(vector<TestGroup> testGroups)
+            : testGroups_(move(testGroups)) {}
 
     const vector<TestGroup>& testGroups() const {
         return testGroups_;
     }
 
     bool operator==(const TestSuite& o) const {
-        return tie(testGroups_) == tie(testGroups_);
+        return tie(testGroups_) == tie(o.testGroups_);
     }
 };
 
+/*
+ * Turns a raw test suite into test cases. A suite may have a very large number of test cases, so nothing is copied
+ * per test case other than its own closure: the input finalizer is shared by all of them.
+ */
 class TestSuiteProvider {
 public:
     static TestSuite provide(
@@ -39,12 +50,16 @@ public:
             const string& slug,
             const optional<IOManipulator*>& ioManipulator) {
 
+        const vector<OfficialTestGroup>& officialTestGroups = rawTestSuite.officialTests();
+        auto inputFinalizer = make_shared<function<void()>>(rawTestSuite.inputFinalizer());
+
         vector<TestGroup> testGroups;
+        testGroups.reserve(officialTestGroups.size() + 1);
         testGroups.push_back(provideSampleTests(rawTestSuite, slug, ioManipulator));
-        for (TestGroup testGroup : provideOfficialTests(rawTestSuite, slug)) {
-            testGroups.push_back(testGroup);
+        for (const OfficialTestGroup& officialTestGroup : officialTestGroups) {
+            testGroups.push_back(provideOfficialTestGroup(officialTestGroup, inputFinalizer, slug));
         }
-        return TestSuite(testGroups);
+        return TestSuite(move(testGroups));
     }
 
 private:
@@ -53,56 +68,50 @@ private:
             const string& slug,
             const optional<IOManipulator*>& ioManipulator) {
 
-        vector<SampleTestCase> sampleTests = rawTestSuite.sampleTests();
+        const vector<SampleTestCase>& sampleTests = rawTestSuite.sampleTests();
+        string baseId = TestCaseIdCreator::createBaseId(slug, 0);
         vector<TestCase> testCases;
+        testCases.reserve(sampleTests.size());
         for (int testCaseNo = 1; testCaseNo <= sampleTests.size(); testCaseNo++) {
-            SampleTestCase sampleTestCase = sampleTests[testCaseNo - 1];
+            const SampleTestCase& sampleTestCase = sampleTests[testCaseNo - 1];
             TestCaseBuilder builder = TestCaseBuilder()
-                    .setId(TestCaseIdCreator::create(slug, 0, testCaseNo))
+                    .setId(TestCaseIdCreator::createFromBaseId(baseId, testCaseNo))
                     .setSubtaskIds(sampleTestCase.subtaskIds());
             if (ioManipulator) {
+                IOManipulator* manipulator = ioManipulator.value();
+                string content = sampleTestCase.content();
                 builder.setApplier([=] {
-                    istream* in = new istringstream(sampleTestCase.content());
-                    ioManipulator.value()->parseInput(in);
+                    istringstream in(content);
+                    manipulator->parseInput(&in);
                 });
             }
             testCases.push_back(builder.build());
         }
 
-        return TestGroup(0, testCases);
-    }
-
-    static vector<TestGroup> provideOfficialTests(const RawTestSuite& rawTestSuite, const string& slug) {
-        vector<TestGroup> testGroups;
-        for (const OfficialTestGroup& officialTestGroup : rawTestSuite.officialTests()) {
-            testGroups.push_back(provideOfficialTestGroup(officialTestGroup, rawTestSuite.inputFinalizer(), slug));
-        }
-        return testGroups;
+        return TestGroup(0, move(testCases));
     }
 
     static TestGroup provideOfficialTestGroup(
             const OfficialTestGroup& officialTestGroup,
-            const function<void()>& inputFinalizer,
+            const shared_ptr<function<void()>>& inputFinalizer,
             const string& slug) {
 
-        vector<OfficialTestCase> officialTestCases = officialTestGroup.officialTestCases();
+        const vector<OfficialTestCase>& officialTestCases = officialTestGroup.officialTestCases();
+        string baseId = TestCaseIdCreator::createBaseId(slug, officialTestGroup.id());
         vector<TestCase> testCases;
+        testCases.reserve(officialTestCases.size());
         for (int testCaseNo = 1; testCaseNo <= officialTestCases.size(); testCaseNo++) {
-            OfficialTestCase officialTestCase = officialTestCases[testCaseNo - 1];
-            string testCaseId = TestCaseIdCreator::create(
-                    slug,
-                    officialTestGroup.id(),
-                    testCaseNo);
-            TestCase testCase = TestCaseBuilder()
-                    .setId(testCaseId)
+            const OfficialTestCase& officialTestCase = officialTestCases[testCaseNo - 1];
+            function<void()> closure = officialTestCase.closure();
+            testCases.push_back(TestCaseBuilder()
+                    .setId(TestCaseIdCreator::createFromBaseId(baseId, testCaseNo))
                     .setDescription(officialTestCase.description())
                     .setSubtaskIds(officialTestGroup.subtaskIds())
-                    .setApplier([=] {officialTestCase.closure()(); inputFinalizer();})
-                    .build();
-            testCases.push_back(testCase);
+                    .setApplier([closure, inputFinalizer] {closure(); (*inputFinalizer)();})
+                    .build());
         }
 
-        return TestGroup(officialTestGroup.id(), testCases);
+        return TestGroup(officialTestGroup.id(), move(testCases));
     }
 };
 
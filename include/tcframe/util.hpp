@@ -1,5 +1,13 @@
 #pragma once
 
+#include "tcframe/util/ForwardingStreamBuf.hpp"
+#include "tcframe/util/HashingInputStreamBuf.hpp"
+#include "tcframe/util/HashingStreamBuf.hpp"
+#include "tcframe/util/IndexSequence.hpp"
+#include "tcframe/util/MinHashStreamBuf.hpp"
 #include "tcframe/util/NotImplementedException.hpp"
+#include "tcframe/util/Stopwatch.hpp"
 #include "tcframe/util/StringUtils.hpp"
+#include "tcframe/util/Tracer.hpp"
+#include "tcframe/util/XxHash64.hpp"
 #include "tcframe/util/optional.hpp"
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <streambuf>
+
+using std::size_t;
+using std::streambuf;
+
+namespace tcframe {
+
+/*
+ * Stream buffer that forwards everything written to it to another stream buffer, letting subclasses observe each chunk
+ * of the written content before it is forwarded. Subclasses should sync() in their destructors, as observe() can no
+ * longer be dispatched to them once this destructor runs.
+ */
+class ForwardingStreamBuf : public streambuf {
+private:
+    static const int BUFFER_SIZE = 1 << 16;
+
+    streambuf* target_;
+    char buffer_[BUFFER_SIZE];
+
+public:
+    virtual ~ForwardingStreamBuf() {}
+
+    ForwardingStreamBuf(streambuf* target)
+            : target_(target) {
+        setp(buffer_, buffer_ + BUFFER_SIZE);
+    }
+
+protected:
+    virtual void observe(const char* data, size_t length) = 0;
+
+    int_type overflow(int_type c) {
+        if (forward() < 0) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    // Only forwards the buffered content; flushing the target is left to its owner.
+    int sync() {
+        return forward();
+    }
+
+private:
+    int forward() {
+        int pending = (int) (pptr() - pbase());
+        if (pending == 0) {
+            return 0;
+        }
+        observe(pbase(), (size_t) pending);
+        bool written = target_->sputn(pbase(), pending) == pending;
+        pbump(-pending);
+        return written ? 0 : -1;
+    }
+};
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <ios>
+#include <streambuf>
+
+#include "XxHash64.hpp"
+
+using std::ios_base;
+using std::streambuf;
+using std::streamoff;
+using std::streampos;
+using std::streamsize;
+
+namespace tcframe {
+
+/*
+ * Stream buffer that reads from another stream buffer, while computing the XXH64 hash and the size of the content read
+ * through it. Seeking is only supported within the content read so far that is still buffered.
+ */
+class HashingInputStreamBuf : public streambuf {
+private:
+    static const int BUFFER_SIZE = 1 << 16;
+
+    streambuf* source_;
+    XxHash64 hash_;
+    long long size_;
+    char buffer_[BUFFER_SIZE];
+
+public:
+    HashingInputStreamBuf(streambuf* source)
+            : source_(source)
+            , size_(0) {
+        setg(buffer_, buffer_, buffer_);
+    }
+
+    /* Reads the rest of the source first, so that the digest covers all of its content. */
+    unsigned long long digest() {
+        drain();
+        return hash_.digest();
+    }
+
+    long long size() {
+        drain();
+        return size_;
+    }
+
+protected:
+    int_type underflow() {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        streamsize readCount = source_->sgetn(buffer_, BUFFER_SIZE);
+        if (readCount <= 0) {
+            return traits_type::eof();
+        }
+        hash_.update(buffer_, (size_t) readCount);
+        size_ += readCount;
+        setg(buffer_, buffer_, buffer_ + readCount);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    streampos seekoff(streamoff offset, ios_base::seekdir direction, ios_base::openmode which) {
+        if (direction != ios_base::cur) {
+            return streampos(streamoff(-1));
+        }
+        return seekpos(streampos(size_ - (egptr() - gptr()) + offset), which);
+    }
+
+    streampos seekpos(streampos position, ios_base::openmode which) {
+        long long target = (long long) streamoff(position);
+        long long bufferStart = size_ - (egptr() - eback());
+        if (!(which & ios_base::in) || target < bufferStart || target > size_) {
+            return streampos(streamoff(-1));
+        }
+        setg(eback(), eback() + (target - bufferStart), egptr());
+        return position;
+    }
+
+private:
+    void drain() {
+        while (!traits_type::eq_int_type(underflow(), traits_type::eof())) {
+            setg(eback(), egptr(), egptr());
+        }
+    }
+};
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "ForwardingStreamBuf.hpp"
+#include "XxHash64.hpp"
+
+namespace tcframe {
+
+/*
+ * Stream buffer that forwards everything written to it to another stream buffer, while computing the XXH64 hash and
+ * the size of the written content.
+ */
+class HashingStreamBuf : public ForwardingStreamBuf {
+private:
+    XxHash64 hash_;
+    long long size_;
+
+public:
+    HashingStreamBuf(streambuf* target)
+            : ForwardingStreamBuf(target)
+            , size_(0) {}
+
+    ~HashingStreamBuf() {
+        sync();
+    }
+
+    unsigned long long digest() {
+        sync();
+        return hash_.digest();
+    }
+
+    long long size() {
+        sync();
+        return size_;
+    }
+
+protected:
+    void observe(const char* data, size_t length) {
+        hash_.update(data, length);
+        size_ += length;
+    }
+};
+
+}
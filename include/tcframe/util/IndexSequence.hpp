@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+using std::size_t;
+
+namespace tcframe {
+
+/*
+ * Partial implementation of std::index_sequence, for expanding tuples in C++11.
+ */
+template<size_t... Is>
+struct IndexSequence {};
+
+template<size_t N, size_t... Is>
+struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Is...> {};
+
+template<size_t... Is>
+struct MakeIndexSequence<0, Is...> {
+    typedef IndexSequence<Is...> type;
+};
+
+}
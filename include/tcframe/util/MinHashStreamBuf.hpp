@@ -0,0 +1,178 @@
+#pragma once
+
+#include <vector>
+
+#include "ForwardingStreamBuf.hpp"
+
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * One permutation MinHash signature of a set of shingle hashes. Each hash falls into one of BINS_COUNT bins by its
+ * highest bits, and each bin keeps the smallest of its hashes.
+ */
+struct MinHashSignature {
+public:
+    static const int BINS_COUNT = 64;
+    static const int BIN_BITS = 6;
+    static const unsigned long long EMPTY_BIN = ~0ULL;
+
+private:
+    vector<unsigned long long> bins_;
+
+public:
+    MinHashSignature()
+            : bins_(BINS_COUNT, (unsigned long long) EMPTY_BIN) {}
+
+    const vector<unsigned long long>& bins() const {
+        return bins_;
+    }
+
+    void add(unsigned long long hash) {
+        unsigned long long& bin = bins_[hash >> (64 - BIN_BITS)];
+        unsigned long long value = hash & (EMPTY_BIN >> BIN_BITS);
+        if (value < bin) {
+            bin = value;
+        }
+    }
+
+    /* Estimates the Jaccard similarity of the two sets, from the bins that are not empty in both signatures. */
+    double similarity(const MinHashSignature& o) const {
+        int usedCount = 0;
+        int matchingCount = 0;
+        for (int i = 0; i < BINS_COUNT; i++) {
+            if (bins_[i] == EMPTY_BIN && o.bins_[i] == EMPTY_BIN) {
+                continue;
+            }
+            usedCount++;
+            if (bins_[i] == o.bins_[i]) {
+                matchingCount++;
+            }
+        }
+        return usedCount == 0 ? 1.0 : (double) matchingCount / usedCount;
+    }
+
+    bool operator==(const MinHashSignature& o) const {
+        return bins_ == o.bins_;
+    }
+
+    bool operator!=(const MinHashSignature& o) const {
+        return !(*this == o);
+    }
+};
+
+/*
+ * Stream buffer that forwards everything written to it to another stream buffer, while computing the MinHash
+ * signature of the shingles of SHINGLE_SIZE consecutive whitespace-separated tokens of the written content.
+ */
+class MinHashStreamBuf : public ForwardingStreamBuf {
+private:
+    static const int SHINGLE_SIZE = 3;
+
+    static const unsigned long long FNV_OFFSET = 14695981039346656037ULL;
+    static const unsigned long long FNV_PRIME = 1099511628211ULL;
+
+    MinHashSignature signature_;
+    unsigned long long tokenHash_;
+    bool inToken_;
+    unsigned long long recentTokenHashes_[SHINGLE_SIZE];
+    long long tokensCount_;
+
+public:
+    MinHashStreamBuf(streambuf* target)
+            : ForwardingStreamBuf(target)
+            , tokenHash_(FNV_OFFSET)
+            , inToken_(false)
+            , tokensCount_(0) {
+        for (int i = 0; i < SHINGLE_SIZE; i++) {
+            recentTokenHashes_[i] = 0;
+        }
+    }
+
+    ~MinHashStreamBuf() {
+        sync();
+    }
+
+    /* The signature of the content written so far, taken as a whole. */
+    MinHashSignature signature() {
+        sync();
+        MinHashSignature signature = signature_;
+        if (inToken_) {
+            // The content may continue the last token; it only ends here for this signature.
+            unsigned long long recentTokenHashes[SHINGLE_SIZE];
+            copyRecentTokenHashes(recentTokenHashes);
+            long long tokensCount = tokensCount_;
+            push(recentTokenHashes, tokensCount, tokenHash_);
+            addShingle(signature, recentTokenHashes, tokensCount, true);
+        } else {
+            addShingle(signature, recentTokenHashes_, tokensCount_, true);
+        }
+        return signature;
+    }
+
+protected:
+    void observe(const char* data, size_t length) {
+        for (const char* p = data; p < data + length; p++) {
+            if (*p == ' ' || *p == '\n' || *p == '\t' || *p == '\r') {
+                if (inToken_) {
+                    push(recentTokenHashes_, tokensCount_, tokenHash_);
+                    addShingle(signature_, recentTokenHashes_, tokensCount_, false);
+                    tokenHash_ = FNV_OFFSET;
+                    inToken_ = false;
+                }
+            } else {
+                tokenHash_ = (tokenHash_ ^ (unsigned char) *p) * FNV_PRIME;
+                inToken_ = true;
+            }
+        }
+    }
+
+private:
+    void copyRecentTokenHashes(unsigned long long* recentTokenHashes) const {
+        for (int i = 0; i < SHINGLE_SIZE; i++) {
+            recentTokenHashes[i] = recentTokenHashes_[i];
+        }
+    }
+
+    static void push(unsigned long long* recentTokenHashes, long long& tokensCount, unsigned long long tokenHash) {
+        for (int i = 0; i + 1 < SHINGLE_SIZE; i++) {
+            recentTokenHashes[i] = recentTokenHashes[i + 1];
+        }
+        recentTokenHashes[SHINGLE_SIZE - 1] = tokenHash;
+        tokensCount++;
+    }
+
+    /*
+     * Adds the shingle of the most recent tokens. Content with fewer tokens than a shingle only gets a shingle of all
+     * of its tokens once it ends.
+     */
+    static void addShingle(
+            MinHashSignature& signature,
+            const unsigned long long* recentTokenHashes,
+            long long tokensCount,
+            bool ended) {
+
+        int size = tokensCount < SHINGLE_SIZE ? (int) tokensCount : SHINGLE_SIZE;
+        if (size == 0 || (size < SHINGLE_SIZE && !ended)) {
+            return;
+        }
+        unsigned long long hash = 0;
+        for (int i = SHINGLE_SIZE - size; i < SHINGLE_SIZE; i++) {
+            hash = (hash ^ recentTokenHashes[i]) * FNV_PRIME;
+        }
+        signature.add(mix(hash));
+    }
+
+    // The SplitMix64 finalizer, so that the highest bits that choose the bin are well distributed.
+    static unsigned long long mix(unsigned long long x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+};
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+namespace tcframe {
+
+class Stopwatch {
+private:
+    steady_clock::time_point start_;
+
+public:
+    Stopwatch()
+            : start_(steady_clock::now()) {}
+
+    double elapsedSeconds() const {
+        return duration<double>(steady_clock::now() - start_).count();
+    }
+
+    double lap() {
+        steady_clock::time_point now = steady_clock::now();
+        double elapsed = duration<double>(now - start_).count();
+        start_ = now;
+        return elapsed;
+    }
+};
+
+}
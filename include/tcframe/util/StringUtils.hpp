@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdio>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -47,6 +48,27 @@ public:
 
         return result;
     }
+
+    static string toJsonString(const string& s) {
+        string result = "\"";
+        for (char c : s) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            } else if (c == '\n') {
+                result += "\\n";
+            } else if (c == '\t') {
+                result += "\\t";
+            } else if ((unsigned char) c < 0x20) {
+                char escaped[7];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                result += escaped;
+            } else {
+                result += c;
+            }
+        }
+        return result + "\"";
+    }
 };
 
 }
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "StringUtils.hpp"
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+using std::lock_guard;
+using std::map;
+using std::mutex;
+using std::ostream;
+using std::string;
+using std::thread;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Records where the time of a run goes, as spans on the threads that ran them, and writes them in the Chrome trace
+ * event format that Perfetto and chrome://tracing open. Spans may be recorded from several threads at once.
+ */
+class Tracer {
+private:
+    struct Span {
+        string name;
+        string category;
+        string id;
+        long long startMicros;
+        long long endMicros;
+        int threadId;
+    };
+
+    steady_clock::time_point origin_;
+    mutex mutex_;
+    vector<Span> spans_;
+    map<thread::id, int> threadIds_;
+
+public:
+    virtual ~Tracer() {}
+
+    Tracer()
+            : origin_(steady_clock::now()) {}
+
+    /* Microseconds since the tracer was created. */
+    long long nowMicros() const {
+        return duration_cast<microseconds>(steady_clock::now() - origin_).count();
+    }
+
+    /* Records a span of the calling thread; the id, if not empty, names the test case that the span belongs to. */
+    void record(
+            const string& name,
+            const string& category,
+            const string& id,
+            long long startMicros,
+            long long endMicros) {
+
+        lock_guard<mutex> lock(mutex_);
+        auto threadId = threadIds_.insert({std::this_thread::get_id(), (int) threadIds_.size() + 1}).first;
+        spans_.push_back({name, category, id, startMicros, endMicros, threadId->second});
+    }
+
+    void write(ostream* out) {
+        lock_guard<mutex> lock(mutex_);
+        *out << "{\"traceEvents\":[";
+        for (int i = 0; i < spans_.size(); i++) {
+            const Span& span = spans_[i];
+            *out << (i == 0 ? "\n" : ",\n")
+                 << "{\"name\":" << StringUtils::toJsonString(span.name)
+                 << ",\"cat\":" << StringUtils::toJsonString(span.category)
+                 << ",\"ph\":\"X\",\"ts\":" << span.startMicros
+                 << ",\"dur\":" << span.endMicros - span.startMicros
+                 << ",\"pid\":1,\"tid\":" << span.threadId;
+            if (!span.id.empty()) {
+                *out << ",\"args\":{\"id\":" << StringUtils::toJsonString(span.id) << "}";
+            }
+            *out << "}";
+        }
+        *out << "\n]}\n";
+    }
+};
+
+/*
+ * Records a span from its construction to its destruction, if there is a tracer. Without one, it does not even read the
+ * clock, so that untraced runs do not pay for it.
+ */
+class TraceSpan {
+private:
+    Tracer* tracer_;
+    const char* name_;
+    const char* category_;
+    string id_;
+    long long startMicros_;
+
+public:
+    TraceSpan(Tracer* tracer, const char* name, const char* category, const string& id = string())
+            : tracer_(tracer)
+            , name_(name)
+            , category_(category)
+            , id_(tracer != nullptr ? id : string())
+            , startMicros_(tracer != nullptr ? tracer->nowMicros() : 0) {}
+
+    ~TraceSpan() {
+        if (tracer_ != nullptr) {
+            tracer_->record(name_, category_, id_, startMicros_, tracer_->nowMicros());
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+using std::size_t;
+using std::string;
+
+namespace tcframe {
+
+/*
+ * Incremental implementation of the 64-bit xxHash (XXH64) non-cryptographic hash function.
+ */
+class XxHash64 {
+private:
+    static const unsigned long long PRIME1 = 11400714785074694791ULL;
+    static const unsigned long long PRIME2 = 14029467366897019727ULL;
+    static const unsigned long long PRIME3 = 1609587929392839161ULL;
+    static const unsigned long long PRIME4 = 9650029242287828579ULL;
+    static const unsigned long long PRIME5 = 2870177450012600261ULL;
+
+    unsigned long long seed_;
+    unsigned long long accumulators_[4];
+    unsigned char buffer_[32];
+    size_t bufferSize_;
+    unsigned long long totalSize_;
+
+public:
+    XxHash64(unsigned long long seed = 0)
+            : seed_(seed)
+            , bufferSize_(0)
+            , totalSize_(0) {
+        accumulators_[0] = seed + PRIME1 + PRIME2;
+        accumulators_[1] = seed + PRIME2;
+        accumulators_[2] = seed;
+        accumulators_[3] = seed - PRIME1;
+    }
+
+    void update(const char* data, size_t size) {
+        const unsigned char* p = (const unsigned char*) data;
+        const unsigned char* end = p + size;
+        totalSize_ += size;
+
+        if (bufferSize_ + size < 32) {
+            for (; p < end; p++) {
+                buffer_[bufferSize_++] = *p;
+            }
+            return;
+        }
+        if (bufferSize_ > 0) {
+            while (bufferSize_ < 32) {
+                buffer_[bufferSize_++] = *p++;
+            }
+            consumeStripe(buffer_);
+            bufferSize_ = 0;
+        }
+        for (; p + 32 <= end; p += 32) {
+            consumeStripe(p);
+        }
+        for (; p < end; p++) {
+            buffer_[bufferSize_++] = *p;
+        }
+    }
+
+    void update(const string& data) {
+        update(data.data(), data.size());
+    }
+
+    unsigned long long digest() const {
+        unsigned long long h;
+        if (totalSize_ >= 32) {
+            h = rotateLeft(accumulators_[0], 1) + rotateLeft(accumulators_[1], 7)
+                + rotateLeft(accumulators_[2], 12) + rotateLeft(accumulators_[3], 18);
+            for (int i = 0; i < 4; i++) {
+                h ^= round(0, accumulators_[i]);
+                h = h * PRIME1 + PRIME4;
+            }
+        } else {
+            h = seed_ + PRIME5;
+        }
+        h += totalSize_;
+
+        size_t i = 0;
+        for (; i + 8 <= bufferSize_; i += 8) {
+            h ^= round(0, read64(buffer_ + i));
+            h = rotateLeft(h, 27) * PRIME1 + PRIME4;
+        }
+        if (i + 4 <= bufferSize_) {
+            h ^= read32(buffer_ + i) * PRIME1;
+            h = rotateLeft(h, 23) * PRIME2 + PRIME3;
+            i += 4;
+        }
+        for (; i < bufferSize_; i++) {
+            h ^= buffer_[i] * PRIME5;
+            h = rotateLeft(h, 11) * PRIME1;
+        }
+
+        h ^= h >> 33;
+        h *= PRIME2;
+        h ^= h >> 29;
+        h *= PRIME3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    static string toHex(unsigned long long hash) {
+        char formatted[17];
+        snprintf(formatted, sizeof(formatted), "%016llx", hash);
+        return formatted;
+    }
+
+private:
+    void consumeStripe(const unsigned char* stripe) {
+        for (int i = 0; i < 4; i++) {
+            accumulators_[i] = round(accumulators_[i], read64(stripe + 8 * i));
+        }
+    }
+
+    static unsigned long long round(unsigned long long accumulator, unsigned long long input) {
+        accumulator += input * PRIME2;
+        accumulator = rotateLeft(accumulator, 31);
+        return accumulator * PRIME1;
+    }
+
+    static unsigned long long rotateLeft(unsigned long long x, int bits) {
+        return (x << bits) | (x >> (64 - bits));
+    }
+
+    static unsigned long long read64(const unsigned char* p) {
+        return read32(p) | (read32(p + 4) << 32);
+    }
+
+    static unsigned long long read32(const unsigned char* p) {
+        return (unsigned long long) p[0]
+               | ((unsigned long long) p[1] << 8)
+               | ((unsigned long long) p[2] << 16)
+               | ((unsigned long long) p[3] << 24);
+    }
+};
+
+}
@@ -1,21 +1,27 @@
 #pragma once
 
+#include <memory>
+#include <utility>
+
+using std::make_shared;
+using std::move;
+using std::shared_ptr;
+
 namespace tcframe {
 
 /*
- * Partial implementation of std::optional.
+ * Partial implementation of std::optional. The value is immutable, so copies share it.
  */
 template<typename T>
 struct optional {
 private:
-    T* val;
+    shared_ptr<T> val;
 
 public:
-    optional()
-            : val(nullptr) {}
+    optional() {}
 
     optional(T value)
-            : val(new T(value)) {}
+            : val(make_shared<T>(move(value))) {}
 
     const T& value() const {
         return *val;
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "tcframe/validator/TestCaseValidator.hpp"
+#include "tcframe/validator/ValidationResult.hpp"
+#include "tcframe/validator/Validator.hpp"
+#include "tcframe/validator/ValidatorConfig.hpp"
+#include "tcframe/validator/ValidatorLogger.hpp"
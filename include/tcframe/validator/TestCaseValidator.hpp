@@ -0,0 +1,111 @@
+#pragma once
+
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ValidationResult.hpp"
+#include "ValidatorConfig.hpp"
+#include "tcframe/io_manipulator.hpp"
+#include "tcframe/os.hpp"
+#include "tcframe/spec/variable.hpp"
+#include "tcframe/util.hpp"
+#include "tcframe/verifier.hpp"
+
+using std::exception;
+using std::istream;
+using std::runtime_error;
+using std::set;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace tcframe {
+
+class TestCaseValidator {
+private:
+    IOManipulator* ioManipulator_;
+    Verifier* verifier_;
+    OperatingSystem* os_;
+
+public:
+    virtual ~TestCaseValidator() {}
+
+    TestCaseValidator(IOManipulator* ioManipulator, Verifier* verifier, OperatingSystem* os)
+            : ioManipulator_(ioManipulator)
+            , verifier_(verifier)
+            , os_(os) {}
+
+    /*
+     * Validates the given test case input file against the input format and the constraints. If the subtasks of the
+     * test case are unknown, the test case is valid as long as it satisfies any subtask.
+     */
+    virtual ValidationResult validate(
+            const string& testCaseFilename,
+            const optional<set<int>>& subtaskIds,
+            const ValidatorConfig& config) {
+
+        vector<string> failures;
+        unique_ptr<istream> in(os_->openForReading(config.testCasesDir() + "/" + testCaseFilename));
+        try {
+            if (config.multipleTestCasesCount() == nullptr) {
+                ioManipulator_->parseInput(in.get());
+                verify(subtaskIds, "", failures);
+            } else {
+                validateMultipleTestCases(in.get(), subtaskIds, config.multipleTestCasesCount(), failures);
+            }
+        } catch (exception& e) {
+            // Including exceptions thrown by the constraints themselves, such as out_of_range.
+            failures.push_back(e.what());
+        }
+        return ValidationResult(testCaseFilename, failures);
+    }
+
+private:
+    void validateMultipleTestCases(
+            istream* in,
+            const optional<set<int>>& subtaskIds,
+            int* multipleTestCasesCount,
+            vector<string>& failures) {
+
+        Scalar* count = Scalar::create(*multipleTestCasesCount, "T");
+        count->parseFrom(in);
+        delete count;
+        WhitespaceManipulator::parseNewline(in, "'T'");
+
+        int testCasesCount = *multipleTestCasesCount;
+        for (int testCaseNo = 1; testCaseNo <= testCasesCount; testCaseNo++) {
+            string context = "Test case " + StringUtils::toString(testCaseNo) + ": ";
+            try {
+                ioManipulator_->parseInputWithoutEof(in);
+            } catch (runtime_error& e) {
+                throw runtime_error(context + e.what());
+            }
+            verify(subtaskIds, context, failures);
+        }
+        WhitespaceManipulator::ensureEof(in);
+
+        *multipleTestCasesCount = testCasesCount;
+        for (const string& failure : verifier_->verifyMultipleTestCasesConstraints().describeFailures()) {
+            failures.push_back(failure);
+        }
+    }
+
+    void verify(const optional<set<int>>& subtaskIds, const string& context, vector<string>& failures) {
+        ConstraintsVerificationResult result = ConstraintsVerificationResult::validResult();
+        if (subtaskIds) {
+            result = verifier_->verifyConstraints(subtaskIds.value());
+        } else if (verifier_->verifyConstraints({}).satisfiedButNotAssignedSubtaskIds().empty()) {
+            result = verifier_->verifyConstraints(verifier_->subtaskIds());
+        }
+        for (const string& failure : result.describeFailures()) {
+            failures.push_back(context + failure);
+        }
+    }
+};
+
+}
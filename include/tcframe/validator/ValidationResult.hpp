@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+struct ValidationResult {
+private:
+    string testCaseFilename_;
+    vector<string> failures_;
+
+public:
+    ValidationResult(const string& testCaseFilename, const vector<string>& failures)
+            : testCaseFilename_(testCaseFilename)
+            , failures_(failures) {}
+
+    const string& testCaseFilename() const {
+        return testCaseFilename_;
+    }
+
+    const vector<string>& failures() const {
+        return failures_;
+    }
+
+    bool isValid() const {
+        return failures_.empty();
+    }
+
+    bool operator==(const ValidationResult& o) const {
+        return tie(testCaseFilename_, failures_) == tie(o.testCaseFilename_, o.failures_);
+    }
+};
+
+}
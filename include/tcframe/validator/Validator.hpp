@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "TestCaseValidator.hpp"
+#include "ValidationResult.hpp"
+#include "ValidatorConfig.hpp"
+#include "ValidatorLogger.hpp"
+#include "tcframe/os.hpp"
+#include "tcframe/testcase.hpp"
+#include "tcframe/util.hpp"
+
+using std::exception;
+using std::istringstream;
+using std::map;
+using std::replace;
+using std::set;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+/*
+ * Validates all test case input files in a directory, spreading them across worker processes. The subtasks of each
+ * test case are inferred from its file name, the same way the generator names the files.
+ */
+class Validator {
+private:
+    TestCaseValidator* testCaseValidator_;
+    OperatingSystem* os_;
+    WorkerPool* workerPool_;
+    ValidatorLogger* logger_;
+
+public:
+    virtual ~Validator() {}
+
+    Validator(
+            TestCaseValidator* testCaseValidator,
+            OperatingSystem* os,
+            WorkerPool* workerPool,
+            ValidatorLogger* logger)
+            : testCaseValidator_(testCaseValidator)
+            , os_(os)
+            , workerPool_(workerPool)
+            , logger_(logger) {}
+
+    virtual bool validate(const TestSuite& testSuite, const ValidatorConfig& config) {
+        logger_->logIntroduction(config.testCasesDir());
+
+        vector<string> testCaseFilenames;
+        for (const string& filename : os_->listFiles(config.testCasesDir())) {
+            if (filename.size() > 3 && filename.compare(filename.size() - 3, 3, ".in") == 0) {
+                testCaseFilenames.push_back(filename);
+            }
+        }
+        if (testCaseFilenames.empty()) {
+            logger_->logNoTestCasesFound();
+            logger_->logFailedResult();
+            return false;
+        }
+
+        map<string, set<int>> subtaskIdsById;
+        map<string, set<int>> subtaskIdsByBaseId;
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            for (const TestCase& testCase : testGroup.testCases()) {
+                subtaskIdsById.insert({testCase.id(), testCase.subtaskIds()});
+            }
+            if (!testGroup.testCases().empty()) {
+                subtaskIdsByBaseId.insert({
+                        TestCaseIdCreator::createBaseId(config.slug(), testGroup.id()),
+                        testGroup.testCases()[0].subtaskIds()});
+            }
+        }
+
+        vector<string> serializedResults;
+        try {
+            serializedResults = workerPool_->run(
+                    config.jobsCount(),
+                    (int) testCaseFilenames.size(),
+                    [&] (int index) {
+                        const string& filename = testCaseFilenames[index];
+                        string testCaseId = filename.substr(0, filename.size() - 3);
+                        return serialize(testCaseValidator_->validate(
+                                filename,
+                                resolveSubtaskIds(testCaseId, subtaskIdsById, subtaskIdsByBaseId),
+                                config));
+                    });
+        } catch (exception& e) {
+            logger_->logSimpleFailure(e.what());
+            logger_->logFailedResult();
+            return false;
+        }
+
+        bool successful = true;
+        for (const string& serializedResult : serializedResults) {
+            ValidationResult result = deserialize(serializedResult);
+            logger_->logTestCaseResult(result);
+            successful &= result.isValid();
+        }
+
+        if (successful) {
+            logger_->logSuccessfulResult();
+        } else {
+            logger_->logFailedResult();
+        }
+        return successful;
+    }
+
+private:
+    /* The subtasks of the test case, or of the test group whose base id the file is named after, if any. */
+    static optional<set<int>> resolveSubtaskIds(
+            const string& testCaseId,
+            const map<string, set<int>>& subtaskIdsById,
+            const map<string, set<int>>& subtaskIdsByBaseId) {
+
+        auto subtaskIds = subtaskIdsById.find(testCaseId);
+        if (subtaskIds != subtaskIdsById.end()) {
+            return optional<set<int>>(subtaskIds->second);
+        }
+
+        // Combined multiple test cases files, and test cases the test spec does not (or no longer) define.
+        for (const string& baseId : {testCaseId, baseIdOf(testCaseId)}) {
+            subtaskIds = subtaskIdsByBaseId.find(baseId);
+            if (subtaskIds != subtaskIdsByBaseId.end()) {
+                return optional<set<int>>(subtaskIds->second);
+            }
+        }
+        return optional<set<int>>();
+    }
+
+    /* Strips the number after the last underscore, if the id ends with one. */
+    static string baseIdOf(const string& testCaseId) {
+        size_t underscore = testCaseId.rfind('_');
+        if (underscore == string::npos || underscore + 1 == testCaseId.size()) {
+            return testCaseId;
+        }
+        for (size_t i = underscore + 1; i < testCaseId.size(); i++) {
+            if (!isdigit(testCaseId[i])) {
+                return testCaseId;
+            }
+        }
+        return testCaseId.substr(0, underscore);
+    }
+
+    /* One line for the file name, then one line per failure. */
+    static string serialize(const ValidationResult& result) {
+        string serialized = result.testCaseFilename();
+        for (string failure : result.failures()) {
+            replace(failure.begin(), failure.end(), '\n', ' ');
+            serialized += "\n" + failure;
+        }
+        return serialized;
+    }
+
+    static ValidationResult deserialize(const string& serialized) {
+        istringstream in(serialized);
+        string testCaseFilename;
+        getline(in, testCaseFilename);
+
+        vector<string> failures;
+        string failure;
+        while (getline(in, failure)) {
+            failures.push_back(failure);
+        }
+        return ValidationResult(testCaseFilename, failures);
+    }
+};
+
+class ValidatorFactory {
+public:
+    virtual ~ValidatorFactory() {}
+
+    virtual Validator* create(
+            TestCaseValidator* testCaseValidator,
+            OperatingSystem* os,
+            WorkerPool* workerPool,
+            ValidatorLogger* logger) {
+
+        return new Validator(testCaseValidator, os, workerPool, logger);
+    }
+};
+
+}
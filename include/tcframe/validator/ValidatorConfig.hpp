@@ -0,0 +1,84 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "tcframe/spec/core.hpp"
+
+using std::move;
+using std::string;
+using std::tie;
+
+namespace tcframe {
+
+struct ValidatorConfig {
+    friend class ValidatorConfigBuilder;
+
+private:
+    int* multipleTestCasesCount_;
+    string slug_;
+    string testCasesDir_;
+    int jobsCount_;
+
+public:
+    int* multipleTestCasesCount() const {
+        return multipleTestCasesCount_;
+    }
+
+    const string& slug() const {
+        return slug_;
+    }
+
+    const string& testCasesDir() const {
+        return testCasesDir_;
+    }
+
+    int jobsCount() const {
+        return jobsCount_;
+    }
+
+    bool operator==(const ValidatorConfig& o) const {
+        return tie(multipleTestCasesCount_, slug_, testCasesDir_, jobsCount_) ==
+                tie(o.multipleTestCasesCount_, o.slug_, o.testCasesDir_, o.jobsCount_);
+    }
+};
+
+class ValidatorConfigBuilder {
+private:
+    ValidatorConfig subject_;
+
+public:
+    ValidatorConfigBuilder() {
+        subject_.multipleTestCasesCount_ = nullptr;
+        subject_.slug_ = DefaultValues::slug();
+        subject_.testCasesDir_ = DefaultValues::testCasesDir();
+        subject_.jobsCount_ = 1;
+    }
+
+    ValidatorConfigBuilder& setMultipleTestCasesCount(int* var) {
+        subject_.multipleTestCasesCount_ = var;
+        return *this;
+    }
+
+    ValidatorConfigBuilder& setSlug(string slug) {
+        subject_.slug_ = slug;
+        return *this;
+    }
+
+    ValidatorConfigBuilder& setTestCasesDir(string testCasesDir) {
+        subject_.testCasesDir_ = testCasesDir;
+        return *this;
+    }
+
+    ValidatorConfigBuilder& setJobsCount(int jobsCount) {
+        subject_.jobsCount_ = jobsCount;
+        return *this;
+    }
+
+    ValidatorConfig build() {
+        return move(subject_);
+    }
+};
+
+}
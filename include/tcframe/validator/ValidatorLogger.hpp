@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string>
+
+#include "ValidationResult.hpp"
+#include "tcframe/logger.hpp"
+
+using std::string;
+
+namespace tcframe {
+
+class ValidatorLogger : public BaseLogger {
+public:
+    virtual ~ValidatorLogger() {}
+
+    ValidatorLogger(LoggerEngine* engine)
+            : BaseLogger(engine) {}
+
+    virtual void logIntroduction(const string& testCasesDir) {
+        engine_->logParagraph(0, "Validating test cases in " + testCasesDir + "...");
+    }
+
+    virtual void logNoTestCasesFound() {
+        engine_->logParagraph(1, "No test cases (*.in files) found.");
+    }
+
+    virtual void logSuccessfulResult() {
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Validation finished. All test cases OK.");
+    }
+
+    virtual void logFailedResult() {
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Validation finished. Some test cases FAILED.");
+    }
+
+    virtual void logSimpleFailure(const string& message) {
+        engine_->logListItem1(1, message);
+    }
+
+    virtual void logTestCaseResult(const ValidationResult& result) {
+        engine_->logHangingParagraph(1, result.testCaseFilename() + ": ");
+        if (result.isValid()) {
+            engine_->logParagraph(0, "OK");
+            return;
+        }
+        engine_->logParagraph(0, "FAILED");
+        engine_->logParagraph(2, "Reasons:");
+        for (const string& failure : result.failures()) {
+            engine_->logListItem1(2, failure);
+        }
+    }
+};
+
+}
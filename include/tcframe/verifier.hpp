@@ -1,5 +1,6 @@
 #pragma once
 
+#include "tcframe/verifier/ConstraintProfile.hpp"
 #include "tcframe/verifier/ConstraintsVerificationResult.hpp"
 #include "tcframe/verifier/MultipleTestCasesConstraintsVerificationResult.hpp"
 #include "tcframe/verifier/Verifier.hpp"
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using std::map;
+using std::stable_sort;
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+struct ConstraintProfileEntry {
+private:
+    string description_;
+    int callsCount_;
+    double totalSeconds_;
+
+public:
+    ConstraintProfileEntry(const string& description, int callsCount, double totalSeconds)
+            : description_(description)
+            , callsCount_(callsCount)
+            , totalSeconds_(totalSeconds) {}
+
+    const string& description() const {
+        return description_;
+    }
+
+    int callsCount() const {
+        return callsCount_;
+    }
+
+    double totalSeconds() const {
+        return totalSeconds_;
+    }
+
+    double meanSeconds() const {
+        return callsCount_ == 0 ? 0 : totalSeconds_ / callsCount_;
+    }
+
+    bool operator==(const ConstraintProfileEntry& o) const {
+        return tie(description_, callsCount_, totalSeconds_) == tie(o.description_, o.callsCount_, o.totalSeconds_);
+    }
+};
+
+/*
+ * Accumulates the time spent evaluating each constraint predicate, keyed by the constraint description, across all
+ * test cases of a test suite.
+ */
+class ConstraintProfile {
+private:
+    map<string, ConstraintProfileEntry> entriesByDescription_;
+
+public:
+    virtual ~ConstraintProfile() {}
+
+    virtual void record(const string& description, double seconds) {
+        auto it = entriesByDescription_.find(description);
+        if (it == entriesByDescription_.end()) {
+            entriesByDescription_.insert({description, ConstraintProfileEntry(description, 1, seconds)});
+        } else {
+            const ConstraintProfileEntry& entry = it->second;
+            it->second = ConstraintProfileEntry(description, entry.callsCount() + 1, entry.totalSeconds() + seconds);
+        }
+    }
+
+    /* Returns at most count entries, the most expensive (by total time) first. */
+    vector<ConstraintProfileEntry> topEntries(size_t count) const {
+        vector<ConstraintProfileEntry> entries;
+        for (const auto& entry : entriesByDescription_) {
+            entries.push_back(entry.second);
+        }
+        stable_sort(entries.begin(), entries.end(), [] (const ConstraintProfileEntry& a, const ConstraintProfileEntry& b) {
+            return a.totalSeconds() > b.totalSeconds();
+        });
+        if (entries.size() > count) {
+            entries.erase(entries.begin() + count, entries.end());
+        }
+        return entries;
+    }
+
+    bool empty() const {
+        return entriesByDescription_.empty();
+    }
+};
+
+}
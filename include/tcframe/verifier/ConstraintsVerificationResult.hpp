@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "tcframe/spec/constraint.hpp"
+#include "tcframe/util.hpp"
 
 using std::map;
 using std::set;
@@ -45,6 +46,25 @@ public:
         return satisfiedButNotAssignedSubtaskIds_;
     }
 
+    /* Returns one line per failure, for reporting outside the structured log. */
+    vector<string> describeFailures() const {
+        vector<string> failures;
+        for (const auto& entry : unsatisfiedConstraintDescriptionsBySubtaskId_) {
+            for (const string& unsatisfiedConstraintDescription : entry.second) {
+                if (entry.first == -1) {
+                    failures.push_back("Does not satisfy constraint: " + unsatisfiedConstraintDescription);
+                } else {
+                    failures.push_back("Does not satisfy subtask " + StringUtils::toString(entry.first)
+                            + ", on constraint: " + unsatisfiedConstraintDescription);
+                }
+            }
+        }
+        for (int subtaskId : satisfiedButNotAssignedSubtaskIds_) {
+            failures.push_back("Satisfies subtask " + StringUtils::toString(subtaskId) + " but is not assigned to it");
+        }
+        return failures;
+    }
+
     bool operator==(const ConstraintsVerificationResult& o) const {
         return tie(unsatisfiedConstraintDescriptionsBySubtaskId_, satisfiedButNotAssignedSubtaskIds_)
                 == tie(o.unsatisfiedConstraintDescriptionsBySubtaskId_, o.satisfiedButNotAssignedSubtaskIds_);
@@ -3,10 +3,12 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <vector>
 
 using std::set;
 using std::string;
 using std::tie;
+using std::vector;
 
 namespace tcframe {
 
@@ -26,6 +28,15 @@ public:
         return unsatisfiedConstraintDescriptions_.empty();
     }
 
+    /* Returns one line per failure, for reporting outside the structured log. */
+    vector<string> describeFailures() const {
+        vector<string> failures;
+        for (const string& unsatisfiedConstraintDescription : unsatisfiedConstraintDescriptions_) {
+            failures.push_back("Does not satisfy constraint: " + unsatisfiedConstraintDescription);
+        }
+        return failures;
+    }
+
     bool operator==(const MultipleTestCasesConstraintsVerificationResult& o) const {
         return tie(unsatisfiedConstraintDescriptions_) == tie(o.unsatisfiedConstraintDescriptions_);
     }
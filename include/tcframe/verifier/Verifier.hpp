@@ -5,9 +5,11 @@
 #include <string>
 #include <utility>
 
+#include "ConstraintProfile.hpp"
 #include "ConstraintsVerificationResult.hpp"
 #include "MultipleTestCasesConstraintsVerificationResult.hpp"
 #include "tcframe/spec/constraint.hpp"
+#include "tcframe/util.hpp"
 
 using std::map;
 using std::move;
@@ -16,50 +18,179 @@ using std::vector;
 
 namespace tcframe {
 
+/*
+ * Constraints with the same description (i.e. the same CONS() source text) are evaluated at most once per test case,
+ * even if they are repeated across subtasks.
+ */
 class Verifier {
 private:
     ConstraintSuite constraintSuite_;
+    ConstraintProfile* profile_;
+
+    vector<Constraint> distinctConstraints_;
+    vector<vector<int>> distinctConstraintIndicesBySubtask_;
 
 public:
     virtual ~Verifier() {}
 
-    Verifier(ConstraintSuite constraintSuite)
-            : constraintSuite_(move(constraintSuite)) {}
+    Verifier(ConstraintSuite constraintSuite, ConstraintProfile* profile = nullptr)
+            : constraintSuite_(move(constraintSuite))
+            , profile_(profile) {
+
+        map<string, int> distinctConstraintIndicesByDescription;
+        for (const Subtask& subtask : constraintSuite_.constraints()) {
+            vector<int> distinctConstraintIndices;
+            for (const Constraint& constraint : subtask.constraints()) {
+                auto it = distinctConstraintIndicesByDescription.find(constraint.description());
+                if (it == distinctConstraintIndicesByDescription.end()) {
+                    it = distinctConstraintIndicesByDescription.insert(
+                            {constraint.description(), (int) distinctConstraints_.size()}).first;
+                    distinctConstraints_.push_back(constraint);
+                }
+                distinctConstraintIndices.push_back(it->second);
+            }
+            distinctConstraintIndicesBySubtask_.push_back(distinctConstraintIndices);
+        }
+    }
+
+    virtual set<int> subtaskIds() const {
+        set<int> subtaskIds;
+        for (const Subtask& subtask : constraintSuite_.constraints()) {
+            subtaskIds.insert(subtask.id());
+        }
+        return subtaskIds;
+    }
+
+    /* Returns the profile that constraint evaluations are recorded to, or nullptr if profiling is disabled. */
+    virtual const ConstraintProfile* profile() const {
+        return profile_;
+    }
 
     virtual ConstraintsVerificationResult verifyConstraints(const set<int>& subtaskIds) {
         map<int, vector<string>> unsatisfiedConstraintDescriptionsBySubtaskId;
         set<int> satisfiedButNotAssignedSubtaskIds;
 
-        for (const Subtask& subtask : constraintSuite_.constraints()) {
+        Evaluations evaluations(distinctConstraints_.size());
+        const vector<Subtask>& subtasks = constraintSuite_.constraints();
+
+        // Assigned subtasks need every unsatisfied constraint, so they are evaluated first; their verdicts can then
+        // settle most of the non-assigned subtasks without evaluating anything.
+        for (int i = 0; i < subtasks.size(); i++) {
+            if (!subtaskIds.count(subtasks[i].id())) {
+                continue;
+            }
             vector<string> unsatisfiedConstraintDescriptions;
-            for (const Constraint& constraint : subtask.constraints()) {
-                if (!constraint.predicate()()) {
-                    unsatisfiedConstraintDescriptions.push_back(constraint.description());
+            for (int index : distinctConstraintIndicesBySubtask_[i]) {
+                if (!isSatisfied(index, evaluations)) {
+                    unsatisfiedConstraintDescriptions.push_back(evaluations.unsatisfiedDescriptions[index]);
                 }
             }
+            if (!unsatisfiedConstraintDescriptions.empty()) {
+                unsatisfiedConstraintDescriptionsBySubtaskId[subtasks[i].id()] = unsatisfiedConstraintDescriptions;
+            }
+        }
 
-            if (subtaskIds.count(subtask.id())) {
-                if (!unsatisfiedConstraintDescriptions.empty()) {
-                    unsatisfiedConstraintDescriptionsBySubtaskId[subtask.id()] = unsatisfiedConstraintDescriptions;
-                }
-            } else {
-                if (unsatisfiedConstraintDescriptions.empty()) {
-                    satisfiedButNotAssignedSubtaskIds.insert(subtask.id());
-                }
+        for (int i = 0; i < subtasks.size(); i++) {
+            if (subtaskIds.count(subtasks[i].id())) {
+                continue;
+            }
+            if (isSatisfied(distinctConstraintIndicesBySubtask_[i], evaluations)) {
+                satisfiedButNotAssignedSubtaskIds.insert(subtasks[i].id());
             }
         }
         return ConstraintsVerificationResult(unsatisfiedConstraintDescriptionsBySubtaskId, satisfiedButNotAssignedSubtaskIds);
     }
 
+    /* Returns the subtasks whose constraints are all satisfied, evaluating each distinct constraint at most once. */
+    virtual set<int> satisfiedSubtaskIds() {
+        set<int> satisfiedSubtaskIds;
+        Evaluations evaluations(distinctConstraints_.size());
+        const vector<Subtask>& subtasks = constraintSuite_.constraints();
+        for (int i = 0; i < subtasks.size(); i++) {
+            if (isSatisfied(distinctConstraintIndicesBySubtask_[i], evaluations)) {
+                satisfiedSubtaskIds.insert(subtasks[i].id());
+            }
+        }
+        return satisfiedSubtaskIds;
+    }
+
     virtual MultipleTestCasesConstraintsVerificationResult verifyMultipleTestCasesConstraints() {
         set<string> unsatisfiedConstraintDescriptions;
         for (const Constraint& constraint : constraintSuite_.multipleTestCasesConstraints()) {
-            if (!constraint.predicate()()) {
-                unsatisfiedConstraintDescriptions.insert(constraint.description());
+            string unsatisfiedDescription;
+            if (!isSatisfied(constraint, unsatisfiedDescription)) {
+                unsatisfiedConstraintDescriptions.insert(unsatisfiedDescription);
             }
         }
         return MultipleTestCasesConstraintsVerificationResult(unsatisfiedConstraintDescriptions);
     }
+
+private:
+    enum class Verdict {
+        UNKNOWN,
+        SATISFIED,
+        UNSATISFIED
+    };
+
+    /* Verdicts of the distinct constraints for the current test case. */
+    struct Evaluations {
+        vector<Verdict> verdicts;
+        vector<string> unsatisfiedDescriptions;
+
+        Evaluations(size_t size)
+                : verdicts(size, Verdict::UNKNOWN)
+                , unsatisfiedDescriptions(size) {}
+    };
+
+    bool isSatisfied(int index, Evaluations& evaluations) {
+        Verdict& verdict = evaluations.verdicts[index];
+        if (verdict == Verdict::UNKNOWN) {
+            bool satisfied = isSatisfied(distinctConstraints_[index], evaluations.unsatisfiedDescriptions[index]);
+            verdict = satisfied ? Verdict::SATISFIED : Verdict::UNSATISFIED;
+        }
+        return verdict == Verdict::SATISFIED;
+    }
+
+    /* Stops at the first unsatisfied constraint, looking at the already known verdicts before evaluating any. */
+    bool isSatisfied(const vector<int>& indices, Evaluations& evaluations) {
+        for (int index : indices) {
+            if (evaluations.verdicts[index] == Verdict::UNSATISFIED) {
+                return false;
+            }
+        }
+        for (int index : indices) {
+            if (!isSatisfied(index, evaluations)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*
+     * If the constraint is not satisfied, sets unsatisfiedDescription to its description, followed by the violation
+     * details reported by a constraint helper, if any.
+     */
+    bool isSatisfied(const Constraint& constraint, string& unsatisfiedDescription) {
+        ConstraintViolation::take();
+
+        bool satisfied;
+        if (profile_ == nullptr) {
+            satisfied = constraint.predicate()();
+        } else {
+            Stopwatch stopwatch;
+            satisfied = constraint.predicate()();
+            profile_->record(constraint.description(), stopwatch.elapsedSeconds());
+        }
+
+        if (!satisfied) {
+            string violationDetails = ConstraintViolation::take();
+            unsatisfiedDescription = constraint.description();
+            if (!violationDetails.empty()) {
+                unsatisfiedDescription += " (" + violationDetails + ")";
+            }
+        }
+        return satisfied;
+    }
 };
 
 }
@@ -0,0 +1,63 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/generator/DuplicateDetector.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Test;
+
+namespace tcframe {
+
+class DuplicateDetectorTests : public Test {
+protected:
+    DuplicateDetector detector;
+
+    /* A signature with one hash in each bin, where the first differentCount bins get other hashes. */
+    static MinHashSignature signature(int differentCount) {
+        MinHashSignature signature;
+        for (int bin = 0; bin < MinHashSignature::BINS_COUNT; bin++) {
+            signature.add(((unsigned long long) bin << 58) | (bin < differentCount ? 1000 + bin : bin));
+        }
+        return signature;
+    }
+};
+
+TEST_F(DuplicateDetectorTests, Duplicates) {
+    detector.record("foo_1", FileDigest(1, 10));
+    detector.record("foo_2", FileDigest(2, 10));
+    detector.record("foo_3", FileDigest(1, 10));
+    detector.record("foo_4", FileDigest(1, 11));
+    detector.record("foo_5", FileDigest(2, 10));
+    detector.record("foo_6", FileDigest(1, 10));
+
+    EXPECT_THAT(detector.duplicates(), ElementsAre(
+            ElementsAre("foo_1", "foo_3", "foo_6"),
+            ElementsAre("foo_2", "foo_5")));
+}
+
+TEST_F(DuplicateDetectorTests, Duplicates_Clear) {
+    detector.record("foo_1", FileDigest(1, 10));
+    detector.clear();
+    detector.record("foo_2", FileDigest(1, 10));
+
+    EXPECT_THAT(detector.duplicates(), IsEmpty());
+}
+
+TEST_F(DuplicateDetectorTests, NearDuplicates) {
+    detector.record("foo_1", FileDigest(1, 10), optional<MinHashSignature>(signature(0)));
+    detector.record("foo_2", FileDigest(2, 10), optional<MinHashSignature>(signature(64)));
+    detector.record("foo_3", FileDigest(3, 10), optional<MinHashSignature>(signature(4)));
+    detector.record("foo_4", FileDigest(1, 10), optional<MinHashSignature>(signature(0)));
+    detector.record("foo_5", FileDigest(5, 10), optional<MinHashSignature>(signature(32)));
+    detector.record("foo_6", FileDigest(6, 10));
+
+    EXPECT_THAT(detector.nearDuplicates(0.9), ElementsAre(
+            NearDuplicateTestCases("foo_1", "foo_3", 0.9375)));
+    EXPECT_THAT(detector.nearDuplicates(0.5), ElementsAre(
+            NearDuplicateTestCases("foo_1", "foo_3", 0.9375),
+            NearDuplicateTestCases("foo_1", "foo_5", 0.5),
+            NearDuplicateTestCases("foo_2", "foo_5", 0.5),
+            NearDuplicateTestCases("foo_3", "foo_5", 0.5625)));
+}
+
+}
@@ -0,0 +1,52 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/generator/DurationProfile.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Pair;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class DurationProfileTests : public Test {};
+
+TEST_F(DurationProfileTests, WriteAndRead) {
+    DurationProfile profile;
+    profile.record("foo_1_2", 0.25);
+    profile.record("foo_1_1", 12.5);
+    profile.record("foo_2_1", 3);
+    profile.remove("foo_2_1");
+
+    ostringstream out;
+    profile.write(&out);
+    EXPECT_THAT(out.str(), Eq(
+            "foo_1_1 12.500\n"
+            "foo_1_2 0.250\n"));
+
+    DurationProfile readProfile;
+    istringstream in(out.str());
+    readProfile.read(&in);
+    EXPECT_THAT(readProfile.durations(), ElementsAre(
+            Pair("foo_1_1", 12.5),
+            Pair("foo_1_2", 0.25)));
+}
+
+TEST_F(DurationProfileTests, Read_Malformed) {
+    DurationProfile profile;
+    istringstream in("foo_1_1 -1\n");
+    try {
+        profile.read(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Malformed duration profile entry for foo_1_1"));
+    }
+}
+
+}
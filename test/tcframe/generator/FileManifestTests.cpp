@@ -0,0 +1,78 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/generator/FileManifest.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Pair;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class FileManifestTests : public Test {};
+
+TEST_F(FileManifestTests, WriteAndRead) {
+    FileManifest manifest;
+    manifest.record("foo_1_2.in", FileDigest(0x2a, 3));
+    manifest.record("foo_1_1.in", FileDigest(0x44bc2cf5ad770999ULL, 100));
+    manifest.record("foo_1_1.out", FileDigest(7, 1));
+    manifest.remove("foo_1_1.out");
+
+    ostringstream out;
+    manifest.write(&out);
+    EXPECT_THAT(out.str(), Eq(
+            "44bc2cf5ad770999 100 foo_1_1.in\n"
+            "000000000000002a 3 foo_1_2.in\n"));
+
+    FileManifest readManifest;
+    istringstream in(out.str());
+    readManifest.read(&in);
+    EXPECT_THAT(readManifest.digests(), ElementsAre(
+            Pair("foo_1_1.in", FileDigest(0x44bc2cf5ad770999ULL, 100)),
+            Pair("foo_1_2.in", FileDigest(0x2a, 3))));
+}
+
+TEST_F(FileManifestTests, Read_Malformed) {
+    FileManifest manifest;
+    istringstream in("xyz 3 foo_1_1.in\n");
+    try {
+        manifest.read(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Malformed file manifest entry for foo_1_1.in"));
+    }
+}
+
+TEST_F(FileManifestTests, Digest) {
+    istringstream in("abc");
+    EXPECT_THAT(FileDigest::of(&in), Eq(FileDigest(0x44bc2cf5ad770999ULL, 3)));
+
+    string content;
+    in >> content;
+    EXPECT_THAT(content, Eq("abc"));
+}
+
+TEST_F(FileManifestTests, Diff) {
+    FileManifest oldManifest;
+    oldManifest.record("foo_1_1.in", FileDigest(1, 10));
+    oldManifest.record("foo_1_2.in", FileDigest(2, 10));
+    oldManifest.record("foo_1_3.in", FileDigest(3, 10));
+    FileManifest newManifest;
+    newManifest.record("foo_1_1.in", FileDigest(1, 10));
+    newManifest.record("foo_1_2.in", FileDigest(4, 10));
+    newManifest.record("foo_1_4.in", FileDigest(5, 10));
+
+    FileManifestDiff diff(oldManifest, newManifest);
+    EXPECT_THAT(diff.addedFilenames(), ElementsAre("foo_1_4.in"));
+    EXPECT_THAT(diff.removedFilenames(), ElementsAre("foo_1_3.in"));
+    EXPECT_THAT(diff.changedFilenames(), ElementsAre("foo_1_2.in"));
+    EXPECT_THAT(diff.unchangedCount(), Eq(1));
+}
+
+}
@@ -0,0 +1,169 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include <sstream>
+
+#include "../os/MockOperatingSystem.hpp"
+#include "tcframe/generator/GenerationJournal.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Ne;
+using ::testing::Pair;
+using ::testing::Return;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class GenerationJournalTests : public Test {
+protected:
+    Mock(OperatingSystem) os;
+
+    TestCase testCase = TestCaseBuilder()
+            .setId("foo_1_1")
+            .setDescription("N = 1")
+            .setSubtaskIds({1})
+            .build();
+    GeneratorConfig config = GeneratorConfigBuilder()
+            .setSlug("foo")
+            .setSolutionCommand("./solution")
+            .setTestCasesDir("dir")
+            .build();
+};
+
+TEST_F(GenerationJournalTests, WriteAndRead) {
+    GenerationJournal journal;
+    journal.record("foo_1_2", "000000000000002a");
+    journal.record("foo_1_1", "44bc2cf5ad770999");
+    journal.record("foo_1_3", "0000000000000001");
+    journal.remove("foo_1_3");
+
+    ostringstream out;
+    journal.write(&out);
+    EXPECT_THAT(out.str(), Eq(
+            "record 44bc2cf5ad770999 foo_1_1\n"
+            "record 000000000000002a foo_1_2\n"));
+
+    GenerationJournal readJournal;
+    istringstream in(out.str());
+    readJournal.read(&in);
+    EXPECT_THAT(readJournal.fingerprints(), ElementsAre(
+            Pair("foo_1_1", "44bc2cf5ad770999"),
+            Pair("foo_1_2", "000000000000002a")));
+    EXPECT_TRUE(readJournal.contains("foo_1_1", "44bc2cf5ad770999"));
+    EXPECT_FALSE(readJournal.contains("foo_1_1", "000000000000002a"));
+    EXPECT_FALSE(readJournal.contains("foo_1_3", "0000000000000001"));
+}
+
+TEST_F(GenerationJournalTests, Read_Log) {
+    GenerationJournal journal;
+    istringstream in(
+            "record 0000000000000001 foo_1_1\n"
+            "record 0000000000000002 foo_1_2\n"
+            "remove foo_1_1\n"
+            "record 0000000000000003 foo_1_2\n"
+            "record 0000000000000004 foo_1");
+    journal.read(&in);
+
+    // The last line was cut short by an interruption.
+    EXPECT_THAT(journal.fingerprints(), ElementsAre(Pair("foo_1_2", "0000000000000003")));
+}
+
+TEST_F(GenerationJournalTests, Read_Malformed) {
+    GenerationJournal journal;
+    istringstream in("record 2a foo_1_1\n");
+    try {
+        journal.read(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Malformed generation journal line: record 2a foo_1_1"));
+    }
+}
+
+TEST_F(GenerationJournalTests, OpenAndAppend) {
+    GenerationJournal journal;
+    journal.record("foo_1_1", "44bc2cf5ad770999");
+    ostringstream out;
+    ostringstream log;
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, openForWriting("dir/generation.journal.tmp"))
+                .WillOnce(Return(&out));
+        EXPECT_CALL(os, closeOpenedWritingStream(&out));
+        EXPECT_CALL(os, syncFile("dir/generation.journal.tmp"));
+        EXPECT_CALL(os, renameFile("dir/generation.journal.tmp", "dir/generation.journal"));
+        EXPECT_CALL(os, openForAppending("dir/generation.journal"))
+                .WillOnce(Return(&log));
+        EXPECT_CALL(os, syncFile("dir/generation.journal"));
+        EXPECT_CALL(os, syncFile("dir/generation.journal"));
+        EXPECT_CALL(os, closeOpenedWritingStream(&log));
+    }
+
+    journal.open(&os, config);
+    journal.record("foo_1_2", "000000000000002a");
+    journal.remove("foo_1_1");
+    journal.remove("foo_1_3");
+    journal.close();
+    EXPECT_THAT(out.str(), Eq("record 44bc2cf5ad770999 foo_1_1\n"));
+    EXPECT_THAT(log.str(), Eq(
+            "record 000000000000002a foo_1_2\n"
+            "remove foo_1_1\n"));
+}
+
+TEST_F(GenerationJournalTests, Compact) {
+    GenerationJournal journal;
+    ostringstream out1;
+    ostringstream out2;
+    ostringstream log;
+    ON_CALL(os, openForAppending("dir/generation.journal"))
+            .WillByDefault(Return(&log));
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, openForWriting("dir/generation.journal.tmp"))
+                .WillOnce(Return(&out1));
+        EXPECT_CALL(os, renameFile("dir/generation.journal.tmp", "dir/generation.journal"));
+        EXPECT_CALL(os, openForWriting("dir/generation.journal.tmp"))
+                .WillOnce(Return(&out2));
+        EXPECT_CALL(os, renameFile("dir/generation.journal.tmp", "dir/generation.journal"));
+    }
+
+    journal.open(&os, config);
+    journal.record("foo_1_1", "44bc2cf5ad770999");
+    journal.compact(&os, config);
+    // The journal is closed by the compaction, so later changes are not appended.
+    journal.record("foo_1_2", "000000000000002a");
+    EXPECT_THAT(out2.str(), Eq("record 44bc2cf5ad770999 foo_1_1\n"));
+    EXPECT_THAT(log.str(), Eq("record 44bc2cf5ad770999 foo_1_1\n"));
+}
+
+TEST_F(GenerationJournalTests, Fingerprint) {
+    string fingerprint = GenerationJournal::fingerprint(testCase, config);
+    EXPECT_THAT(fingerprint.size(), Eq(16u));
+    EXPECT_THAT(GenerationJournal::fingerprint(testCase, config), Eq(fingerprint));
+
+    TestCase changedTestCase = TestCaseBuilder()
+            .setId("foo_1_1")
+            .setDescription("N = 2")
+            .setSubtaskIds({1})
+            .build();
+    GeneratorConfig changedConfig = GeneratorConfigBuilder(config)
+            .setSeed(42)
+            .build();
+    EXPECT_THAT(GenerationJournal::fingerprint(changedTestCase, config), Ne(fingerprint));
+    EXPECT_THAT(GenerationJournal::fingerprint(testCase, changedConfig), Ne(fingerprint));
+}
+
+TEST_F(GenerationJournalTests, Filename) {
+    EXPECT_THAT(GenerationJournal::filename(config), Eq("dir/generation.journal"));
+    EXPECT_THAT(GenerationJournal::filename(GeneratorConfigBuilder(config).setShard(2, 4).build()),
+                Eq("dir/shard-2-of-4.journal"));
+    EXPECT_TRUE(GenerationJournal::isShardFilename("shard-2-of-4.journal"));
+    EXPECT_FALSE(GenerationJournal::isShardFilename("generation.journal"));
+}
+
+}
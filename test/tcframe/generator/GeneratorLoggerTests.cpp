@@ -4,6 +4,7 @@
 #include "../logger/MockLoggerEngine.hpp"
 #include "tcframe/generator/GeneratorLogger.hpp"
 
+using ::testing::_;
 using ::testing::InSequence;
 using ::testing::Test;
 
@@ -46,6 +47,12 @@ TEST_F(GeneratorLoggerTests, TestCaseResult_Successful) {
     logger.logTestCaseSuccessfulResult();
 }
 
+TEST_F(GeneratorLoggerTests, ResumedResult) {
+    EXPECT_CALL(engine, logParagraph(0, "RESUMED"));
+
+    logger.logResumedResult();
+}
+
 TEST_F(GeneratorLoggerTests, TestCaseResult_Failed) {
     {
         InSequence sequence;
@@ -56,6 +63,23 @@ TEST_F(GeneratorLoggerTests, TestCaseResult_Failed) {
     logger.logTestCaseFailedResult("N = 1");
 }
 
+TEST_F(GeneratorLoggerTests, ConstraintProfile) {
+    ConstraintProfile profile;
+    profile.record("1 <= N && N <= 10", 0.002);
+    profile.record("1 <= N && N <= 10", 0.004);
+    profile.record("distinct(A)", 0.5);
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Most expensive constraints:"));
+        EXPECT_CALL(engine, logListItem1(1, "distinct(A)"));
+        EXPECT_CALL(engine, logListItem2(2, "1 calls, 500.000 ms total, 500000.000 us mean"));
+        EXPECT_CALL(engine, logListItem1(1, "1 <= N && N <= 10"));
+        EXPECT_CALL(engine, logListItem2(2, "2 calls, 6.000 ms total, 3000.000 us mean"));
+    }
+    logger.logConstraintProfile(profile);
+}
+
 TEST_F(GeneratorLoggerTests, ConstraintsVerificationFailure) {
     {
         InSequence sequence;
@@ -82,6 +106,33 @@ TEST_F(GeneratorLoggerTests, ConstraintsVerificationFailure_WithGroups) {
     logger.logConstraintsVerificationFailure(result);
 }
 
+TEST_F(GeneratorLoggerTests, SolutionsDisagreement) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logListItem1(2, "Alternative solutions disagree with the solution:"));
+        EXPECT_CALL(engine, logListItem2(3, "./alt1: different output"));
+        EXPECT_CALL(engine, logListItem2(3, "./alt2: exit code 1"));
+    }
+    logger.logSolutionsDisagreement({"./alt1: different output", "./alt2: exit code 1"});
+}
+
+TEST_F(GeneratorLoggerTests, TestCaseMetrics_CrossChecked) {
+    EXPECT_CALL(engine, logListItem1(2, "Slowest solution: ./alt (750.000 ms)"));
+
+    logger.logTestCaseMetrics(TestCase(), TestCaseMetricsBuilder()
+            .addSolutionDuration("./sol", 0.5)
+            .addSolutionDuration("./alt", 0.75)
+            .build());
+}
+
+TEST_F(GeneratorLoggerTests, TestCaseMetrics_NotCrossChecked) {
+    EXPECT_CALL(engine, logListItem1(_, _)).Times(0);
+
+    logger.logTestCaseMetrics(TestCase(), TestCaseMetricsBuilder()
+            .addSolutionDuration("./sol", 0.5)
+            .build());
+}
+
 TEST_F(GeneratorLoggerTests, MultipleTestCasesCombinationIntroduction) {
     EXPECT_CALL(engine, logHangingParagraph(1, "Combining test cases into a single file (foo_3): "));
 
@@ -103,4 +154,19 @@ TEST_F(GeneratorLoggerTests, MultipleTestCasesCombinationResult_Failed) {
     logger.logMultipleTestCasesCombinationFailedResult();
 }
 
+TEST_F(GeneratorLoggerTests, DuplicateTestCases) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Test cases with identical inputs:"));
+        EXPECT_CALL(engine, logListItem1(1, "foo_1_1, foo_2_3, foo_2_4"));
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Test cases with near-duplicate inputs:"));
+        EXPECT_CALL(engine, logListItem1(1, "foo_1_2, foo_3_1 (94% similar)"));
+    }
+    logger.logDuplicateTestCases(
+            {{"foo_1_1", "foo_2_3", "foo_2_4"}},
+            {NearDuplicateTestCases("foo_1_2", "foo_3_1", 0.9375)});
+}
+
 }
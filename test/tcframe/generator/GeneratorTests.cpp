@@ -1,6 +1,8 @@
 #include "gmock/gmock.h"
 #include "../mock.hpp"
 
+#include <sstream>
+
 #include "../io_manipulator/MockIOManipulator.hpp"
 #include "../os/MockOperatingSystem.hpp"
 #include "../verifier/MockVerifier.hpp"
@@ -9,14 +11,23 @@
 #include "tcframe/generator/Generator.hpp"
 
 using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::ContainsRegex;
+using ::testing::ElementsAre;
 using ::testing::Eq;
 using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Pair;
 using ::testing::Return;
 using ::testing::Test;
 
+using std::istringstream;
+using std::ostringstream;
+
 namespace tcframe {
 
 int T;
+int appliedCount;
 
 class GeneratorTests : public Test {
 protected:
@@ -25,11 +36,11 @@ protected:
     Mock(OperatingSystem) os;
     Mock(GeneratorLogger) logger;
 
-    TestCase stc1 = TestCaseBuilder().setId("foo_sample_1").build();
-    TestCase stc2 = TestCaseBuilder().setId("foo_sample_2").build();
-    TestCase tc1 = TestCaseBuilder().setId("foo_1_1").build();
-    TestCase tc2 = TestCaseBuilder().setId("foo_1_2").build();
-    TestCase tc3 = TestCaseBuilder().setId("foo_2_1").build();
+    TestCase stc1 = TestCaseBuilder().setId("foo_sample_1").setApplier([]{appliedCount++;}).build();
+    TestCase stc2 = TestCaseBuilder().setId("foo_sample_2").setApplier([]{appliedCount++;}).build();
+    TestCase tc1 = TestCaseBuilder().setId("foo_1_1").setApplier([]{appliedCount++;}).build();
+    TestCase tc2 = TestCaseBuilder().setId("foo_1_2").setApplier([]{appliedCount++;}).build();
+    TestCase tc3 = TestCaseBuilder().setId("foo_2_1").setApplier([]{appliedCount++;}).build();
 
     TestSuite simpleTestSuite = TestSuite({
             TestGroup(0, {stc1, stc2})});
@@ -52,6 +63,8 @@ protected:
     Generator generator = Generator(&testCaseGenerator, &verifier, &os, &logger);
 
     void SetUp() {
+        appliedCount = 0;
+
         ON_CALL(testCaseGenerator, generate(_, _))
                 .WillByDefault(Return(true));
         ON_CALL(verifier, verifyMultipleTestCasesConstraints())
@@ -84,6 +97,337 @@ TEST_F(GeneratorTests, Generation_Successful_MultipleTestGroups) {
     EXPECT_TRUE(generator.generate(testSuite, config));
 }
 
+TEST_F(GeneratorTests, Generation_Selective) {
+    GeneratorConfig selectiveConfig = GeneratorConfigBuilder(config)
+            .setTestGroupIds({2})
+            .setTestCaseIds({"foo_1_2"})
+            .build();
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction());
+        EXPECT_CALL(os, makeDir("dir"));
+
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(testCaseGenerator, generate(tc2, selectiveConfig));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(testCaseGenerator, generate(tc3, selectiveConfig));
+
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_CALL(os, forceMakeDir(_)).Times(0);
+    EXPECT_CALL(logger, logTestGroupIntroduction(0)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testSuite, selectiveConfig));
+    EXPECT_THAT(appliedCount, Eq(3));
+}
+
+TEST_F(GeneratorTests, Generation_Snapshot) {
+    GeneratorConfig snapshotConfig = GeneratorConfigBuilder(config)
+            .setSnapshotDir("snapshots")
+            .build();
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, forceMakeDir("dir"));
+        EXPECT_CALL(os, makeDir("snapshots"));
+    }
+    EXPECT_TRUE(generator.generate(simpleTestSuite, snapshotConfig));
+}
+
+TEST_F(GeneratorTests, Generation_Selective_FromSnapshots) {
+    GeneratorConfig selectiveConfig = GeneratorConfigBuilder(config)
+            .setTestCaseIds({"foo_1_2"})
+            .setSnapshotDir("snapshots")
+            .setFromSnapshots(true)
+            .build();
+    EXPECT_CALL(testCaseGenerator, generate(tc2, selectiveConfig));
+    EXPECT_CALL(os, makeDir("dir"));
+    EXPECT_CALL(os, makeDir("snapshots")).Times(0);
+
+    EXPECT_TRUE(generator.generate(testSuite, selectiveConfig));
+    EXPECT_THAT(appliedCount, Eq(0));
+}
+
+TEST_F(GeneratorTests, Generation_FileManifest) {
+    FileManifest fileManifest;
+    fileManifest.record("stale.in", FileDigest(1, 1));
+    ON_CALL(testCaseGenerator, fileManifest())
+            .WillByDefault(Return(&fileManifest));
+    ON_CALL(testCaseGenerator, generate(stc1, _))
+            .WillByDefault(Invoke([&] (const TestCase&, const GeneratorConfig&) {
+                fileManifest.record("foo_sample_1.in", FileDigest(2, 2));
+                return true;
+            }));
+    ostringstream manifestOut;
+    EXPECT_CALL(os, openForWriting("dir/files.manifest"))
+            .WillOnce(Return(&manifestOut));
+    EXPECT_CALL(os, closeOpenedWritingStream(&manifestOut));
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, config));
+    EXPECT_THAT(manifestOut.str(), Eq("0000000000000002 2 foo_sample_1.in\n"));
+}
+
+TEST_F(GeneratorTests, Generation_Selective_FileManifest) {
+    GeneratorConfig selectiveConfig = GeneratorConfigBuilder(config)
+            .setTestCaseIds({"foo_sample_1"})
+            .build();
+    FileManifest fileManifest;
+    ON_CALL(testCaseGenerator, fileManifest())
+            .WillByDefault(Return(&fileManifest));
+    ON_CALL(testCaseGenerator, generate(stc1, _))
+            .WillByDefault(Invoke([&] (const TestCase&, const GeneratorConfig&) {
+                fileManifest.record("foo_sample_1.in", FileDigest(3, 3));
+                return true;
+            }));
+    ON_CALL(os, openForReading("dir/files.manifest"))
+            .WillByDefault(Return(new istringstream(
+                    "0000000000000002 2 foo_sample_1.in\n"
+                    "0000000000000001 1 foo_sample_2.in\n")));
+    ostringstream manifestOut;
+    ON_CALL(os, openForWriting("dir/files.manifest"))
+            .WillByDefault(Return(&manifestOut));
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, selectiveConfig));
+    EXPECT_THAT(manifestOut.str(), Eq(
+            "0000000000000003 3 foo_sample_1.in\n"
+            "0000000000000001 1 foo_sample_2.in\n"));
+}
+
+TEST_F(GeneratorTests, Generation_InputStatisticsTable) {
+    InputStatisticsTable inputStatisticsTable;
+    inputStatisticsTable.record("stale", 1, {});
+    ON_CALL(testCaseGenerator, inputStatisticsTable())
+            .WillByDefault(Return(&inputStatisticsTable));
+    ON_CALL(testCaseGenerator, generate(_, _))
+            .WillByDefault(Invoke([&] (const TestCase& testCase, const GeneratorConfig&) {
+                inputStatisticsTable.record(testCase.id(), testCase.id().size(), {});
+                return true;
+            }));
+    ostringstream tableOut;
+    EXPECT_CALL(os, openForWriting("dir/statistics.csv"))
+            .WillOnce(Return(&tableOut));
+    EXPECT_CALL(os, closeOpenedWritingStream(&tableOut));
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, config));
+    EXPECT_THAT(tableOut.str(), Eq(
+            "testCase,bytes,tokens\n"
+            "foo_sample_1,12,0\n"
+            "foo_sample_2,12,0\n"
+            "extremes,12,0\n"));
+}
+
+TEST_F(GeneratorTests, Generation_Selective_InputStatisticsTable) {
+    GeneratorConfig selectiveConfig = GeneratorConfigBuilder(config)
+            .setTestCaseIds({"foo_sample_2"})
+            .build();
+    InputStatisticsTable inputStatisticsTable;
+    ON_CALL(testCaseGenerator, inputStatisticsTable())
+            .WillByDefault(Return(&inputStatisticsTable));
+    ON_CALL(testCaseGenerator, generate(stc2, _))
+            .WillByDefault(Invoke([&] (const TestCase&, const GeneratorConfig&) {
+                inputStatisticsTable.record("foo_sample_2", 5, {});
+                return true;
+            }));
+    ON_CALL(os, openForReading("dir/statistics.csv"))
+            .WillByDefault(Return(new istringstream(
+                    "testCase,bytes,tokens\n"
+                    "foo_sample_1,3,1\n"
+                    "foo_sample_2,7,2\n"
+                    "extremes,7,2\n")));
+    ostringstream tableOut;
+    ON_CALL(os, openForWriting("dir/statistics.csv"))
+            .WillByDefault(Return(&tableOut));
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, selectiveConfig));
+    EXPECT_THAT(tableOut.str(), Eq(
+            "testCase,bytes,tokens\n"
+            "foo_sample_1,3,1\n"
+            "foo_sample_2,5,0\n"
+            "extremes,5,1\n"));
+}
+
+TEST_F(GeneratorTests, Generation_Resume) {
+    GeneratorConfig resumeConfig = GeneratorConfigBuilder(config)
+            .setResume(true)
+            .build();
+    GenerationJournal journal;
+    ON_CALL(testCaseGenerator, journal())
+            .WillByDefault(Return(&journal));
+    ON_CALL(os, openForReading("dir/generation.journal"))
+            .WillByDefault(Return(new istringstream(
+                    "record " + GenerationJournal::fingerprint(stc1, resumeConfig) + " foo_sample_1\n"
+                    + "record " + GenerationJournal::fingerprint(tc1, resumeConfig) + " foo_1_1\n"
+                    + "record 0000000000000001 foo_1_2\n")));
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1_1.in", "foo_sample_1.in", "foo_sample_1.out"}));
+    ostringstream journalOut;
+    ON_CALL(os, openForWriting("dir/generation.journal.tmp"))
+            .WillByDefault(Return(&journalOut));
+    EXPECT_CALL(os, forceMakeDir(_)).Times(0);
+    EXPECT_CALL(os, makeDir("dir"));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_1"));
+        EXPECT_CALL(logger, logResumedResult());
+        EXPECT_CALL(testCaseGenerator, generate(stc2, resumeConfig));
+        EXPECT_CALL(testCaseGenerator, generate(tc1, resumeConfig));
+        EXPECT_CALL(testCaseGenerator, generate(tc2, resumeConfig));
+        EXPECT_CALL(testCaseGenerator, generate(tc3, resumeConfig));
+    }
+    EXPECT_CALL(testCaseGenerator, generate(stc1, _)).Times(0);
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, renameFile("dir/generation.journal.tmp", "dir/generation.journal"));
+        EXPECT_CALL(os, openForAppending("dir/generation.journal"));
+        // Every test case is generated, so there is nothing left to resume.
+        EXPECT_CALL(os, removeFile("dir/generation.journal"));
+    }
+
+    EXPECT_TRUE(generator.generate(testSuite, resumeConfig));
+    EXPECT_THAT(appliedCount, Eq(1));
+    EXPECT_THAT(journalOut.str(), Eq(
+            "record " + GenerationJournal::fingerprint(tc1, resumeConfig) + " foo_1_1\n"
+            + "record 0000000000000001 foo_1_2\n"
+            + "record " + GenerationJournal::fingerprint(stc1, resumeConfig) + " foo_sample_1\n"));
+}
+
+TEST_F(GeneratorTests, Generation_Selective_CompactsJournal) {
+    GeneratorConfig selectiveConfig = GeneratorConfigBuilder(config)
+            .setTestCaseIds({"foo_1_1"})
+            .build();
+    GenerationJournal journal;
+    ON_CALL(testCaseGenerator, journal())
+            .WillByDefault(Return(&journal));
+    ON_CALL(os, openForReading("dir/generation.journal"))
+            .WillByDefault(Return(new istringstream(
+                    "record 0000000000000001 foo_1_1\n"
+                    "record 0000000000000002 foo_1_2\n"
+                    "remove foo_1_1\n")));
+    ON_CALL(testCaseGenerator, generate(tc1, _))
+            .WillByDefault(Invoke([&] (const TestCase&, const GeneratorConfig&) {
+                journal.record("foo_1_1", "0000000000000003");
+                return true;
+            }));
+    ostringstream journalOut1;
+    ostringstream journalOut2;
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, openForWriting("dir/generation.journal.tmp"))
+                .WillOnce(Return(&journalOut1));
+        EXPECT_CALL(os, renameFile("dir/generation.journal.tmp", "dir/generation.journal"));
+        EXPECT_CALL(os, openForAppending("dir/generation.journal"));
+        EXPECT_CALL(os, openForWriting("dir/generation.journal.tmp"))
+                .WillOnce(Return(&journalOut2));
+        EXPECT_CALL(os, renameFile("dir/generation.journal.tmp", "dir/generation.journal"));
+    }
+    EXPECT_CALL(os, removeFile("dir/generation.journal")).Times(0);
+
+    EXPECT_TRUE(generator.generate(testSuite, selectiveConfig));
+    EXPECT_THAT(journalOut1.str(), Eq("record 0000000000000002 foo_1_2\n"));
+    EXPECT_THAT(journalOut2.str(), Eq(
+            "record 0000000000000003 foo_1_1\n"
+            "record 0000000000000002 foo_1_2\n"));
+}
+
+TEST_F(GeneratorTests, Generation_MultipleTestCases_Resume) {
+    GeneratorConfig resumeConfig = GeneratorConfigBuilder(multipleTestCasesConfig)
+            .setResume(true)
+            .build();
+    GenerationJournal journal;
+    ON_CALL(testCaseGenerator, journal())
+            .WillByDefault(Return(&journal));
+    ON_CALL(os, openForReading("dir/generation.journal"))
+            .WillByDefault(Return(new istringstream(
+                    "record " + GenerationJournal::fingerprint(testSuite.testGroups()[1], resumeConfig) + " foo_1\n")));
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1.in", "foo_1.out"}));
+    ostringstream journalOut;
+    ON_CALL(os, openForWriting(_))
+            .WillByDefault(Return(&journalOut));
+    EXPECT_CALL(os, syncFile(_)).Times(AnyNumber());
+    {
+        InSequence sequence;
+        EXPECT_CALL(testCaseGenerator, generate(stc1, resumeConfig));
+        EXPECT_CALL(testCaseGenerator, generate(stc2, resumeConfig));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_sample"));
+        EXPECT_CALL(os, combineMultipleTestCases("dir/foo_sample", 2));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_1"));
+        EXPECT_CALL(logger, logResumedResult());
+        EXPECT_CALL(testCaseGenerator, generate(tc3, resumeConfig));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_2"));
+        EXPECT_CALL(os, combineMultipleTestCases("dir/foo_2", 1));
+        EXPECT_CALL(os, syncFile("dir/foo_2.in"));
+        EXPECT_CALL(os, syncFile("dir/foo_2.out"));
+    }
+    EXPECT_CALL(testCaseGenerator, generate(tc1, _)).Times(0);
+    EXPECT_CALL(testCaseGenerator, generate(tc2, _)).Times(0);
+    EXPECT_CALL(os, combineMultipleTestCases("dir/foo_1", _)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testSuite, resumeConfig));
+    EXPECT_TRUE(journal.contains("foo_1", GenerationJournal::fingerprint(testSuite.testGroups()[1], resumeConfig)));
+    EXPECT_TRUE(journal.contains("foo_2", GenerationJournal::fingerprint(testSuite.testGroups()[2], resumeConfig)));
+}
+
+TEST_F(GeneratorTests, Generation_Duplicates) {
+    DuplicateDetector duplicateDetector;
+    duplicateDetector.record("stale", FileDigest(1, 1));
+    ON_CALL(testCaseGenerator, duplicateDetector())
+            .WillByDefault(Return(&duplicateDetector));
+    ON_CALL(testCaseGenerator, generate(_, _))
+            .WillByDefault(Invoke([&] (const TestCase& testCase, const GeneratorConfig&) {
+                duplicateDetector.record(testCase.id(), FileDigest(testCase.id() == "foo_1_1" ? 2 : 1, 1));
+                return true;
+            }));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logDuplicateTestCases(
+                vector<vector<string>>{{"foo_sample_1", "foo_sample_2", "foo_1_2", "foo_2_1"}},
+                vector<NearDuplicateTestCases>{}));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+
+    EXPECT_TRUE(generator.generate(testSuite, config));
+}
+
+TEST_F(GeneratorTests, Generation_Duplicates_FailOnDuplicates) {
+    GeneratorConfig failingConfig = GeneratorConfigBuilder(config)
+            .setFailOnDuplicates(true)
+            .build();
+    DuplicateDetector duplicateDetector;
+    ON_CALL(testCaseGenerator, duplicateDetector())
+            .WillByDefault(Return(&duplicateDetector));
+    ON_CALL(testCaseGenerator, generate(_, _))
+            .WillByDefault(Invoke([&] (const TestCase& testCase, const GeneratorConfig&) {
+                duplicateDetector.record(testCase.id(), FileDigest(1, 1));
+                return true;
+            }));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logDuplicateTestCases(_, _));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+
+    EXPECT_FALSE(generator.generate(simpleTestSuite, failingConfig));
+}
+
+TEST_F(GeneratorTests, Generation_NoDuplicates_FailOnDuplicates) {
+    GeneratorConfig failingConfig = GeneratorConfigBuilder(config)
+            .setFailOnDuplicates(true)
+            .setNearDuplicateSimilarity(90)
+            .build();
+    DuplicateDetector duplicateDetector;
+    ON_CALL(testCaseGenerator, duplicateDetector())
+            .WillByDefault(Return(&duplicateDetector));
+    ON_CALL(testCaseGenerator, generate(_, _))
+            .WillByDefault(Invoke([&] (const TestCase& testCase, const GeneratorConfig&) {
+                duplicateDetector.record(testCase.id(), FileDigest(testCase.id() == "foo_sample_1" ? 1 : 2, 1));
+                return true;
+            }));
+    EXPECT_CALL(logger, logDuplicateTestCases(_, _)).Times(0);
+    EXPECT_CALL(logger, logSuccessfulResult());
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, failingConfig));
+}
+
 TEST_F(GeneratorTests, Generation_Failed) {
     ON_CALL(testCaseGenerator, generate(stc1, _))
             .WillByDefault(Return(false));
@@ -93,6 +437,19 @@ TEST_F(GeneratorTests, Generation_Failed) {
     EXPECT_FALSE(generator.generate(simpleTestSuite, config));
 }
 
+TEST_F(GeneratorTests, Generation_ConstraintProfile) {
+    ConstraintProfile profile;
+    ON_CALL(verifier, profile())
+            .WillByDefault(Return(&profile));
+    {
+        InSequence sequence;
+        EXPECT_CALL(testCaseGenerator, generate(_, _)).Times(2);
+        EXPECT_CALL(logger, logConstraintProfile(_));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_TRUE(generator.generate(simpleTestSuite, config));
+}
+
 TEST_F(GeneratorTests, Generation_MultipleTestCases_Successful) {
     {
         InSequence sequence;
@@ -113,6 +470,18 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases_Successful) {
     EXPECT_THAT(T, Eq(2));
 }
 
+TEST_F(GeneratorTests, Generation_MultipleTestCases_Traced) {
+    Tracer tracer;
+    ON_CALL(testCaseGenerator, tracer())
+            .WillByDefault(Return(&tracer));
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, multipleTestCasesConfig));
+    ostringstream trace;
+    tracer.write(&trace);
+    EXPECT_THAT(trace.str(), ContainsRegex(
+            "\"combine\",\"cat\":\"testGroup\".*\"foo_sample\".*\"generate\",\"cat\":\"generator\""));
+}
+
 TEST_F(GeneratorTests, Generation_MultipleTestCases_Successful_MultipleTestGroups) {
     {
         InSequence sequence;
@@ -126,6 +495,328 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases_Successful_MultipleTestGroup
     EXPECT_TRUE(generator.generate(testSuite, multipleTestCasesConfig));
 }
 
+TEST_F(GeneratorTests, Generation_MultipleTestCases_Selective) {
+    GeneratorConfig selectiveConfig = GeneratorConfigBuilder(multipleTestCasesConfig)
+            .setTestCaseIds({"foo_1_2"})
+            .build();
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(testCaseGenerator, generate(tc1, selectiveConfig));
+        EXPECT_CALL(testCaseGenerator, generate(tc2, selectiveConfig));
+        EXPECT_CALL(os, combineMultipleTestCases("dir/foo_1", 2));
+    }
+    EXPECT_CALL(os, combineMultipleTestCases("dir/foo_sample", _)).Times(0);
+    EXPECT_CALL(os, combineMultipleTestCases("dir/foo_2", _)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testSuite, selectiveConfig));
+}
+
+TEST_F(GeneratorTests, Generation_MultipleTestCases_DryRun) {
+    GeneratorConfig dryRunConfig = GeneratorConfigBuilder(multipleTestCasesConfig)
+            .setDryRun(true)
+            .build();
+    EXPECT_CALL(os, forceMakeDir(_)).Times(0);
+    EXPECT_CALL(verifier, verifyMultipleTestCasesConstraints());
+    EXPECT_CALL(os, combineMultipleTestCases(_, _)).Times(0);
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationSuccessfulResult());
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, dryRunConfig));
+}
+
+TEST_F(GeneratorTests, Generation_Sharded) {
+    set<string> generatedTestCaseIds;
+    for (int shardIndex = 1; shardIndex <= 2; shardIndex++) {
+        GeneratorConfig shardConfig = GeneratorConfigBuilder(multipleTestCasesConfig)
+                .setShard(shardIndex, 2)
+                .build();
+        vector<string> shardTestCaseIds;
+        ON_CALL(testCaseGenerator, generate(_, shardConfig))
+                .WillByDefault(Invoke([&] (const TestCase& testCase, const GeneratorConfig&) {
+                    shardTestCaseIds.push_back(testCase.id());
+                    return true;
+                }));
+        ostringstream manifestOut;
+        string manifestFilename = "dir/shard-" + StringUtils::toString(shardIndex) + "-of-2.manifest";
+        EXPECT_CALL(os, makeDir("dir"));
+        EXPECT_CALL(os, openForWriting(manifestFilename)).WillOnce(Return(&manifestOut));
+        EXPECT_CALL(os, closeOpenedWritingStream(&manifestOut));
+        EXPECT_CALL(os, combineMultipleTestCases(_, _)).Times(0);
+
+        EXPECT_TRUE(generator.generate(testSuite, shardConfig));
+
+        istringstream manifestIn(manifestOut.str());
+        ShardManifest manifest = ShardManifest::read(&manifestIn);
+        EXPECT_THAT(manifest, Eq(ShardManifest(
+                shardIndex, 2, 0, Sharding::fingerprint(testSuite, shardConfig), shardTestCaseIds, {})));
+        for (const string& testCaseId : shardTestCaseIds) {
+            EXPECT_TRUE(generatedTestCaseIds.insert(testCaseId).second);
+        }
+    }
+    EXPECT_THAT(generatedTestCaseIds.size(), Eq(5u));
+    EXPECT_THAT(appliedCount, Eq(5));
+}
+
+TEST_F(GeneratorTests, Generation_Sharded_DurationProfile) {
+    GeneratorConfig shardConfig = GeneratorConfigBuilder(config)
+            .setShard(2, 2)
+            .setDurationsFilename("profiles/durations.profile")
+            .build();
+    DurationProfile durationProfile;
+    ON_CALL(testCaseGenerator, durationProfile())
+            .WillByDefault(Return(&durationProfile));
+    vector<string> shardTestCaseIds;
+    ON_CALL(testCaseGenerator, generate(_, _))
+            .WillByDefault(Invoke([&] (const TestCase& testCase, const GeneratorConfig&) {
+                shardTestCaseIds.push_back(testCase.id());
+                durationProfile.record(testCase.id(), 2);
+                return true;
+            }));
+    EXPECT_CALL(os, openForReading("profiles/durations.profile"))
+            .WillOnce(Return(new istringstream(
+                    "foo_1_1 8.000\n"
+                    "foo_1_2 4.000\n"
+                    "foo_2_1 5.000\n"
+                    "foo_sample_1 0.500\n"
+                    "foo_sample_2 0.500\n")));
+    EXPECT_CALL(os, openForReading("dir/durations.profile")).Times(0);
+    ostringstream manifestOut;
+    EXPECT_CALL(os, openForWriting("dir/shard-2-of-2.manifest"))
+            .WillOnce(Return(&manifestOut));
+    EXPECT_CALL(os, openForWriting("dir/durations.profile")).Times(0);
+
+    EXPECT_TRUE(generator.generate(testSuite, shardConfig));
+
+    // The first shard takes foo_1_1 and the samples, 9 seconds; this one takes foo_2_1 and foo_1_2, also 9 seconds.
+    EXPECT_THAT(shardTestCaseIds, ElementsAre("foo_1_2", "foo_2_1"));
+    istringstream manifestIn(manifestOut.str());
+    ShardManifest manifest = ShardManifest::read(&manifestIn);
+    EXPECT_THAT(manifest.durations(), ElementsAre(
+            Pair("foo_1_2", 2),
+            Pair("foo_2_1", 2)));
+    EXPECT_THAT(manifest.durationsDigest(), Eq(Sharding::durationsDigest({
+            {"foo_1_1", 8}, {"foo_1_2", 4}, {"foo_2_1", 5}, {"foo_sample_1", 0.5}, {"foo_sample_2", 0.5}})));
+    EXPECT_THAT(manifest.fingerprint(), Eq(Sharding::fingerprint(testSuite, shardConfig, manifest.durationsDigest())));
+}
+
+TEST_F(GeneratorTests, Generation_Sharded_DurationProfile_Failed_Unreadable) {
+    GeneratorConfig shardConfig = GeneratorConfigBuilder(config)
+            .setShard(2, 2)
+            .setDurationsFilename("profiles/durations.profile")
+            .build();
+    ON_CALL(os, openForReading("profiles/durations.profile"))
+            .WillByDefault(Return(new istringstream("foo_1_1 eight\n")));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logSimpleFailure("profiles/durations.profile: Malformed duration profile"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(testCaseGenerator, generate(_, _)).Times(0);
+    EXPECT_CALL(os, openForWriting(_)).Times(0);
+
+    EXPECT_FALSE(generator.generate(testSuite, shardConfig));
+}
+
+TEST_F(GeneratorTests, Generation_DurationProfile) {
+    DurationProfile durationProfile;
+    durationProfile.record("stale", 1);
+    ON_CALL(testCaseGenerator, durationProfile())
+            .WillByDefault(Return(&durationProfile));
+    ON_CALL(testCaseGenerator, generate(stc1, _))
+            .WillByDefault(Invoke([&] (const TestCase&, const GeneratorConfig&) {
+                durationProfile.record("foo_sample_1", 1.5);
+                return true;
+            }));
+    ostringstream profileOut;
+    EXPECT_CALL(os, openForWriting("dir/durations.profile"))
+            .WillOnce(Return(&profileOut));
+    EXPECT_CALL(os, closeOpenedWritingStream(&profileOut));
+
+    EXPECT_TRUE(generator.generate(simpleTestSuite, config));
+    EXPECT_THAT(profileOut.str(), Eq("foo_sample_1 1.500\n"));
+}
+
+TEST_F(GeneratorTests, Merge_Successful) {
+    string fingerprint = Sharding::fingerprint(testSuite, multipleTestCasesConfig);
+    ostringstream manifest1;
+    ostringstream manifest2;
+    ShardManifest(1, 2, 0, fingerprint, {"foo_sample_1", "foo_sample_2", "foo_1_1"}, {}).write(&manifest1);
+    ShardManifest(2, 2, 0, fingerprint, {"foo_1_2", "foo_2_1"}, {}).write(&manifest2);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1_1.in", "shard-1-of-2.manifest", "shard-2-of-2.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest1.str())));
+    ON_CALL(os, openForReading("dir/shard-2-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest2.str())));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logMergeIntroduction("dir"));
+        EXPECT_CALL(os, combineMultipleTestCases("dir/foo_sample", 2));
+        EXPECT_CALL(os, combineMultipleTestCases("dir/foo_1", 2));
+        EXPECT_CALL(os, combineMultipleTestCases("dir/foo_2", 1));
+        EXPECT_CALL(os, removeFile("dir/shard-1-of-2.manifest"));
+        EXPECT_CALL(os, removeFile("dir/shard-2-of-2.manifest"));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_TRUE(generator.merge(testSuite, multipleTestCasesConfig));
+}
+
+TEST_F(GeneratorTests, Merge_FileManifest) {
+    FileManifest fileManifest;
+    ON_CALL(testCaseGenerator, fileManifest())
+            .WillByDefault(Return(&fileManifest));
+    string fingerprint = Sharding::fingerprint(testSuite, config);
+    ostringstream manifest;
+    ShardManifest(1, 1, 0, fingerprint, {"foo_sample_1", "foo_sample_2", "foo_1_1", "foo_1_2", "foo_2_1"}, {})
+            .write(&manifest);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"_foo_1_1_error.out", "foo_1_1.in", "shard-1-of-1.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-1.manifest"))
+            .WillByDefault(Return(new istringstream(manifest.str())));
+    ON_CALL(os, openForReading("dir/foo_1_1.in"))
+            .WillByDefault(Return(new istringstream("1\n")));
+    ostringstream manifestOut;
+    ON_CALL(os, openForWriting("dir/files.manifest"))
+            .WillByDefault(Return(&manifestOut));
+
+    EXPECT_TRUE(generator.merge(testSuite, config));
+    EXPECT_THAT(fileManifest.digests().count("foo_1_1.in"), Eq(1u));
+    EXPECT_THAT(fileManifest.digests().count("_foo_1_1_error.out"), Eq(0u));
+}
+
+TEST_F(GeneratorTests, Merge_DurationProfile) {
+    DurationProfile durationProfile;
+    ON_CALL(testCaseGenerator, durationProfile())
+            .WillByDefault(Return(&durationProfile));
+    string fingerprint = Sharding::fingerprint(testSuite, config);
+    ostringstream manifest1;
+    ostringstream manifest2;
+    ShardManifest(1, 2, 0, fingerprint, {"foo_sample_1", "foo_sample_2", "foo_1_1"}, {}, {{"foo_1_1", 3}})
+            .write(&manifest1);
+    ShardManifest(2, 2, 0, fingerprint, {"foo_1_2", "foo_2_1"}, {}, {{"foo_2_1", 0.5}})
+            .write(&manifest2);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"shard-1-of-2.manifest", "shard-2-of-2.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest1.str())));
+    ON_CALL(os, openForReading("dir/shard-2-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest2.str())));
+    ostringstream profileOut;
+    EXPECT_CALL(os, openForWriting("dir/durations.profile"))
+            .WillOnce(Return(&profileOut));
+
+    EXPECT_TRUE(generator.merge(testSuite, config));
+    EXPECT_THAT(profileOut.str(), Eq(
+            "foo_1_1 3.000\n"
+            "foo_2_1 0.500\n"));
+}
+
+TEST_F(GeneratorTests, Merge_RemovesShardJournals) {
+    string fingerprint = Sharding::fingerprint(testSuite, config);
+    ostringstream manifest;
+    ShardManifest(1, 1, 0, fingerprint, {"foo_sample_1", "foo_sample_2", "foo_1_1", "foo_1_2", "foo_2_1"}, {})
+            .write(&manifest);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"shard-1-of-1.journal", "shard-1-of-1.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-1.manifest"))
+            .WillByDefault(Return(new istringstream(manifest.str())));
+    EXPECT_CALL(os, removeFile("dir/shard-1-of-1.manifest"));
+    EXPECT_CALL(os, removeFile("dir/shard-1-of-1.journal"));
+
+    EXPECT_TRUE(generator.merge(testSuite, config));
+}
+
+TEST_F(GeneratorTests, Merge_Failed_InconsistentShards) {
+    string fingerprint = Sharding::fingerprint(testSuite, config);
+    ostringstream manifest1;
+    ostringstream manifest3;
+    ShardManifest(1, 3, 0, fingerprint, {"foo_sample_1"}, {"foo_sample_2"}).write(&manifest1);
+    ShardManifest(3, 3, 42, "0123456789abcdef", {"foo_1_1"}, {}).write(&manifest3);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"shard-1-of-3.manifest", "shard-3-of-3.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-3.manifest"))
+            .WillByDefault(Return(new istringstream(manifest1.str())));
+    ON_CALL(os, openForReading("dir/shard-3-of-3.manifest"))
+            .WillByDefault(Return(new istringstream(manifest3.str())));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logMergeFailure("Shard 1/3 failed to generate foo_sample_2"));
+        EXPECT_CALL(logger, logMergeFailure("Shard 3/3 was generated with a different seed"));
+        EXPECT_CALL(logger, logMergeFailure("Shard 3/3 was generated from a different spec"));
+        EXPECT_CALL(logger, logMergeFailure("Shard 2/3 is missing"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(os, removeFile(_)).Times(0);
+
+    EXPECT_FALSE(generator.merge(testSuite, config));
+}
+
+TEST_F(GeneratorTests, Merge_Failed_DifferentDurationProfiles) {
+    string digest1 = Sharding::durationsDigest({{"foo_1_1", 8}});
+    string digest2 = Sharding::durationsDigest({{"foo_1_1", 2}});
+    ostringstream manifest1;
+    ostringstream manifest2;
+    ShardManifest(1, 2, 0, Sharding::fingerprint(testSuite, config, digest1), {"foo_1_1"}, {}, {}, digest1)
+            .write(&manifest1);
+    ShardManifest(2, 2, 0, Sharding::fingerprint(testSuite, config, digest2),
+                  {"foo_sample_1", "foo_sample_2", "foo_1_2", "foo_2_1"}, {}, {}, digest2)
+            .write(&manifest2);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"shard-1-of-2.manifest", "shard-2-of-2.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest1.str())));
+    ON_CALL(os, openForReading("dir/shard-2-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest2.str())));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logMergeFailure("Shard 2/2 was partitioned with a different duration profile"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(os, removeFile(_)).Times(0);
+
+    EXPECT_FALSE(generator.merge(testSuite, config));
+}
+
+TEST_F(GeneratorTests, Merge_Failed_OverlappingShards) {
+    string fingerprint = Sharding::fingerprint(testSuite, config);
+    ostringstream manifest1;
+    ostringstream manifest2;
+    ShardManifest(1, 2, 0, fingerprint, {"foo_sample_1", "foo_sample_2", "foo_1_1"}, {}).write(&manifest1);
+    ShardManifest(2, 2, 0, fingerprint, {"foo_1_1", "foo_1_2", "foo_2_1"}, {}).write(&manifest2);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"shard-1-of-2.manifest", "shard-2-of-2.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest1.str())));
+    ON_CALL(os, openForReading("dir/shard-2-of-2.manifest"))
+            .WillByDefault(Return(new istringstream(manifest2.str())));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logMergeFailure("foo_1_1 was generated by more than one shard"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(os, removeFile(_)).Times(0);
+
+    EXPECT_FALSE(generator.merge(testSuite, config));
+}
+
+TEST_F(GeneratorTests, Merge_Failed_IncompleteShards) {
+    ostringstream manifest1;
+    ShardManifest(1, 1, 0, Sharding::fingerprint(testSuite, config), {"foo_sample_1", "foo_1_1"}, {})
+            .write(&manifest1);
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"shard-1-of-1.manifest"}));
+    ON_CALL(os, openForReading("dir/shard-1-of-1.manifest"))
+            .WillByDefault(Return(new istringstream(manifest1.str())));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logMergeFailure("foo_sample_2 was not generated by any shard"));
+        EXPECT_CALL(logger, logMergeFailure("foo_1_2 was not generated by any shard"));
+        EXPECT_CALL(logger, logMergeFailure("foo_2_1 was not generated by any shard"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_FALSE(generator.merge(testSuite, config));
+}
+
 TEST_F(GeneratorTests, Generation_MultipleTestCases_Failed_Verification) {
     MultipleTestCasesConstraintsVerificationResult verificationResult({"T <= 20"});
     ON_CALL(verifier, verifyMultipleTestCasesConstraints())
@@ -0,0 +1,82 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/generator/InputStatisticsTable.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class InputStatisticsTableTests : public Test {
+protected:
+    InputStatisticsTable table;
+
+    static vector<VariableStatistics> statisticsOf(int n, const vector<int>& a, const vector<string>& s) {
+        VariableStatistics nStatistics("N", VariableType::SCALAR);
+        VariableStatistics aStatistics("A", VariableType::VECTOR);
+        VariableStatistics sStatistics("S", VariableType::VECTOR);
+        nStatistics.add(n);
+        aStatistics.addAll(a.begin(), a.end());
+        sStatistics.addAll(s.begin(), s.end());
+        return {nStatistics, aStatistics, sStatistics};
+    }
+};
+
+TEST_F(InputStatisticsTableTests, WriteAndRead) {
+    table.record("foo_2", 8, statisticsOf(2, {-5, 3}, {"x"}));
+    table.record("foo_1", 11, statisticsOf(3, {1, 2, 10}, {}));
+    table.record("foo_3", 2, statisticsOf(0, {}, {}));
+    table.remove("foo_3");
+
+    ostringstream out;
+    table.write({"foo_1", "foo_2", "foo_3"}, &out);
+    EXPECT_THAT(out.str(), Eq(
+            "testCase,bytes,tokens,N,A.count,A.min,A.max,S.count,S.min,S.max\n"
+            "foo_1,11,4,3,3,1,10,0,,\n"
+            "foo_2,8,4,2,2,-5,3,1,,\n"
+            "extremes,11,4,3,3,-5,10,1,,\n"));
+
+    InputStatisticsTable readTable;
+    istringstream in(out.str());
+    readTable.read(&in);
+    EXPECT_THAT(readTable.columns(), Eq(table.columns()));
+    EXPECT_THAT(readTable.rows(), ElementsAre(
+            Pair("foo_1", ElementsAre("11", "4", "3", "3", "1", "10", "0", "", "")),
+            Pair("foo_2", ElementsAre("8", "4", "2", "2", "-5", "3", "1", "", ""))));
+}
+
+TEST_F(InputStatisticsTableTests, Record_OutdatedColumns) {
+    istringstream in("testCase,bytes,tokens,M\nfoo_1,2,1,5\n");
+    table.read(&in);
+    table.record("foo_2", 8, statisticsOf(2, {-5, 3}, {"x"}));
+
+    EXPECT_THAT(table.rows(), ElementsAre(Pair("foo_2", ElementsAre("8", "4", "2", "2", "-5", "3", "1", "", ""))));
+}
+
+TEST_F(InputStatisticsTableTests, Write_Empty) {
+    ostringstream out;
+    table.write({"foo_1"}, &out);
+    EXPECT_THAT(out.str(), Eq("testCase\n"));
+}
+
+TEST_F(InputStatisticsTableTests, Read_Malformed) {
+    istringstream in("testCase,bytes,tokens\nfoo_1,2\n");
+    try {
+        table.read(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Malformed input statistics table"));
+    }
+    EXPECT_THAT(table.rows(), IsEmpty());
+}
+
+}
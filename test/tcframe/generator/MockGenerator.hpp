@@ -12,6 +12,7 @@ public:
             : Generator(nullptr, nullptr, nullptr, nullptr) {}
 
     MOCK_METHOD2(generate, bool(const TestSuite&, const GeneratorConfig&));
+    MOCK_METHOD2(merge, bool(const TestSuite&, const GeneratorConfig&));
 };
 
 class MockGeneratorFactory : public GeneratorFactory {
@@ -18,6 +18,7 @@ public:
     MOCK_METHOD0(logSuccessfulResult, void());
     MOCK_METHOD0(logFailedResult, void());
     MOCK_METHOD0(logTestCaseSuccessfulResult, void());
+    MOCK_METHOD0(logResumedResult, void());
     MOCK_METHOD1(logTestCaseFailedResult, void(const string&));
     MOCK_METHOD1(logMultipleTestCasesCombinationIntroduction, void(const string&));
     MOCK_METHOD0(logMultipleTestCasesCombinationSuccessfulResult, void());
@@ -26,7 +27,14 @@ public:
     MOCK_METHOD1(logMultipleTestCasesConstraintsVerificationFailure, void(
             const MultipleTestCasesConstraintsVerificationResult&));
     MOCK_METHOD1(logSolutionExecutionFailure, void(const ExecutionResult&));
+    MOCK_METHOD1(logSolutionsDisagreement, void(const vector<string>&));
+    MOCK_METHOD1(logMergeIntroduction, void(const string&));
+    MOCK_METHOD1(logMergeFailure, void(const string&));
     MOCK_METHOD1(logSimpleFailure, void(const string&));
+    MOCK_METHOD2(logTestCaseMetrics, void(const TestCase&, const TestCaseMetrics&));
+    MOCK_METHOD1(logConstraintProfile, void(const ConstraintProfile&));
+    MOCK_METHOD2(logDuplicateTestCases,
+            void(const vector<vector<string>>&, const vector<NearDuplicateTestCases>&));
 };
 
 }
@@ -12,6 +12,12 @@ public:
             : TestCaseGenerator(nullptr, nullptr, nullptr, nullptr) {}
 
     MOCK_METHOD2(generate, bool(const TestCase&, const GeneratorConfig&));
+    MOCK_CONST_METHOD0(fileManifest, FileManifest*());
+    MOCK_CONST_METHOD0(duplicateDetector, DuplicateDetector*());
+    MOCK_CONST_METHOD0(inputStatisticsTable, InputStatisticsTable*());
+    MOCK_CONST_METHOD0(durationProfile, DurationProfile*());
+    MOCK_CONST_METHOD0(journal, GenerationJournal*());
+    MOCK_CONST_METHOD0(tracer, Tracer*());
 };
 
 }
@@ -0,0 +1,123 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include <sstream>
+
+#include "../logger/MockLoggerEngine.hpp"
+#include "tcframe/generator/NdjsonGeneratorLogger.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::ostringstream;
+
+namespace tcframe {
+
+class NdjsonGeneratorLoggerTests : public Test {
+protected:
+    Mock(LoggerEngine) engine;
+    ostringstream out;
+
+    NdjsonGeneratorLogger logger = NdjsonGeneratorLogger(&engine, &out);
+
+    TestCase testCase = TestCaseBuilder()
+            .setId("foo_1_1")
+            .setDescription("N = \"42\"")
+            .setSubtaskIds({1, 2})
+            .build();
+    TestCaseMetrics metrics = TestCaseMetricsBuilder()
+            .addStageDuration("apply", 0.5)
+            .addStageDuration("verify", 0.25)
+            .setInputSize(3)
+            .setOutputSize(2)
+            .build();
+};
+
+TEST_F(NdjsonGeneratorLoggerTests, TestCase_Successful) {
+    logger.logTestGroupIntroduction(1);
+    logger.logTestCaseIntroduction("foo_1_1");
+    logger.logTestCaseSuccessfulResult();
+    logger.logTestCaseMetrics(testCase, metrics);
+    logger.logSuccessfulResult();
+
+    EXPECT_THAT(out.str(), Eq(
+            "{\"type\":\"testCase\",\"id\":\"foo_1_1\",\"group\":1,\"description\":\"N = \\\"42\\\"\","
+            "\"subtasks\":[1,2],\"inputBytes\":3,\"outputBytes\":2,\"durations\":{\"apply\":0.5,\"verify\":0.25},"
+            "\"verdict\":\"OK\",\"reasons\":[]}\n"));
+}
+
+TEST_F(NdjsonGeneratorLoggerTests, TestCase_Resumed) {
+    logger.logTestGroupIntroduction(1);
+    logger.logTestCaseIntroduction("foo_1_1");
+    logger.logResumedResult();
+    logger.logSuccessfulResult();
+
+    EXPECT_THAT(out.str(), Eq(
+            "{\"type\":\"testCase\",\"id\":\"foo_1_1\",\"group\":1,\"resumed\":true,\"verdict\":\"OK\",\"reasons\":[]}\n"));
+}
+
+TEST_F(NdjsonGeneratorLoggerTests, TestCase_Failed) {
+    logger.logTestGroupIntroduction(1);
+    logger.logTestCaseIntroduction("foo_1_1");
+    logger.logTestCaseFailedResult("N = \"42\"");
+    logger.logConstraintsVerificationFailure(ConstraintsVerificationResult({{1, {"N <= 10"}}}, {3}));
+    logger.logSimpleFailure("input error");
+    logger.logTestCaseMetrics(testCase, TestCaseMetrics());
+    logger.logTestCaseIntroduction("foo_1_2");
+    logger.logTestCaseSuccessfulResult();
+    logger.logFailedResult();
+
+    EXPECT_THAT(out.str(), Eq(
+            "{\"type\":\"testCase\",\"id\":\"foo_1_1\",\"group\":1,\"description\":\"N = \\\"42\\\"\","
+            "\"subtasks\":[1,2],\"durations\":{},\"verdict\":\"FAILED\",\"reasons\":["
+            "\"Does not satisfy subtask 1, on constraint: N <= 10\","
+            "\"Satisfies subtask 3 but is not assigned to it\","
+            "\"input error\"]}\n"
+            "{\"type\":\"testCase\",\"id\":\"foo_1_2\",\"group\":1,\"verdict\":\"OK\",\"reasons\":[]}\n"));
+}
+
+TEST_F(NdjsonGeneratorLoggerTests, TestCase_CrossChecked_Failed) {
+    logger.logTestGroupIntroduction(1);
+    logger.logTestCaseIntroduction("foo_1_1");
+    logger.logTestCaseFailedResult("N = \"42\"");
+    logger.logSolutionsDisagreement({"./alt: different output"});
+    logger.logTestCaseMetrics(testCase, TestCaseMetricsBuilder()
+            .addSolutionDuration("./sol", 0.5)
+            .addSolutionDuration("./alt", 0.75)
+            .build());
+    logger.logFailedResult();
+
+    EXPECT_THAT(out.str(), Eq(
+            "{\"type\":\"testCase\",\"id\":\"foo_1_1\",\"group\":1,\"description\":\"N = \\\"42\\\"\","
+            "\"subtasks\":[1,2],\"durations\":{},\"solutions\":{\"./sol\":0.5,\"./alt\":0.75},"
+            "\"slowestSolution\":\"./alt\",\"verdict\":\"FAILED\","
+            "\"reasons\":[\"Alternative solution disagrees: ./alt: different output\"]}\n"));
+}
+
+TEST_F(NdjsonGeneratorLoggerTests, MultipleTestCasesCombination_Failed) {
+    logger.logTestGroupIntroduction(2);
+    logger.logMultipleTestCasesCombinationIntroduction("foo_2");
+    logger.logMultipleTestCasesCombinationFailedResult();
+    logger.logMultipleTestCasesConstraintsVerificationFailure(
+            MultipleTestCasesConstraintsVerificationResult({"T <= 20"}));
+    logger.logFailedResult();
+
+    EXPECT_THAT(out.str(), Eq(
+            "{\"type\":\"combination\",\"id\":\"foo_2\",\"group\":2,\"verdict\":\"FAILED\","
+            "\"reasons\":[\"Does not satisfy constraint: T <= 20\"]}\n"));
+}
+
+TEST_F(NdjsonGeneratorLoggerTests, DuplicateTestCases) {
+    logger.logTestGroupIntroduction(1);
+    logger.logTestCaseIntroduction("foo_1_1");
+    logger.logTestCaseSuccessfulResult();
+    logger.logDuplicateTestCases({{"foo_1_1", "foo_2_1"}}, {NearDuplicateTestCases("foo_1_2", "foo_3_1", 0.9375)});
+    logger.logFailedResult();
+
+    EXPECT_THAT(out.str(), Eq(
+            "{\"type\":\"testCase\",\"id\":\"foo_1_1\",\"group\":1,\"verdict\":\"OK\",\"reasons\":[]}\n"
+            "{\"type\":\"duplicates\",\"ids\":[\"foo_1_1\",\"foo_2_1\"]}\n"
+            "{\"type\":\"nearDuplicates\",\"ids\":[\"foo_1_2\",\"foo_3_1\"],\"similarity\":0.9375}\n"));
+}
+
+}
@@ -0,0 +1,80 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/generator/ShardManifest.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class ShardManifestTests : public Test {};
+
+TEST_F(ShardManifestTests, WriteAndRead) {
+    ShardManifest manifest(2, 4, 42, "0123456789abcdef", {"foo_1_1", "foo_2_3"}, {"foo_2_4"});
+
+    ostringstream out;
+    manifest.write(&out);
+    EXPECT_THAT(out.str(), Eq(
+            "shard 2 4\n"
+            "seed 42\n"
+            "fingerprint 0123456789abcdef\n"
+            "generated foo_1_1\n"
+            "generated foo_2_3\n"
+            "failed foo_2_4\n"));
+
+    istringstream in(out.str());
+    EXPECT_THAT(ShardManifest::read(&in), Eq(manifest));
+}
+
+TEST_F(ShardManifestTests, WriteAndRead_Durations) {
+    ShardManifest manifest(1, 2, 42, "0123456789abcdef", {"foo_1_1", "foo_2_3"}, {}, {{"foo_2_3", 1.5}, {"foo_1_1", 0}});
+
+    ostringstream out;
+    manifest.write(&out);
+    EXPECT_THAT(out.str(), Eq(
+            "shard 1 2\n"
+            "seed 42\n"
+            "fingerprint 0123456789abcdef\n"
+            "generated foo_1_1\n"
+            "generated foo_2_3\n"
+            "duration foo_1_1 0.000\n"
+            "duration foo_2_3 1.500\n"));
+
+    istringstream in(out.str());
+    EXPECT_THAT(ShardManifest::read(&in), Eq(manifest));
+}
+
+TEST_F(ShardManifestTests, WriteAndRead_DurationsDigest) {
+    ShardManifest manifest(2, 2, 42, "0123456789abcdef", {"foo_1_1"}, {}, {{"foo_1_1", 2}}, "fedcba9876543210");
+
+    ostringstream out;
+    manifest.write(&out);
+    EXPECT_THAT(out.str(), Eq(
+            "shard 2 2\n"
+            "seed 42\n"
+            "fingerprint 0123456789abcdef\n"
+            "partitioned fedcba9876543210\n"
+            "generated foo_1_1\n"
+            "duration foo_1_1 2.000\n"));
+
+    istringstream in(out.str());
+    EXPECT_THAT(ShardManifest::read(&in), Eq(manifest));
+}
+
+TEST_F(ShardManifestTests, Read_Malformed) {
+    istringstream in("shard 2 4\nfingerprint 0123456789abcdef\n");
+    try {
+        ShardManifest::read(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Malformed shard manifest header"));
+    }
+}
+
+}
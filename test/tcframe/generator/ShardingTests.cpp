@@ -0,0 +1,96 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/generator/Sharding.hpp"
+
+using ::testing::AllOf;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Le;
+using ::testing::Ne;
+using ::testing::Pair;
+using ::testing::Test;
+
+namespace tcframe {
+
+class ShardingTests : public Test {
+protected:
+    TestSuite testSuite = TestSuite({
+            TestGroup(1, {
+                    TestCaseBuilder().setId("foo_1_1").setDescription("N = 1").setSubtaskIds({1}).build(),
+                    TestCaseBuilder().setId("foo_1_2").setDescription("N = 2").setSubtaskIds({1}).build()})});
+
+    GeneratorConfig config = GeneratorConfigBuilder()
+            .setSlug("foo")
+            .build();
+};
+
+TEST_F(ShardingTests, Assign_WithoutDurations) {
+    vector<TestCase> testCases;
+    for (int i = 1; i <= 100; i++) {
+        testCases.push_back(TestCaseBuilder().setId("foo_1_" + StringUtils::toString(i)).build());
+    }
+    map<string, int> shardIndices = Sharding::assign(TestSuite({TestGroup(1, testCases)}), 3);
+    EXPECT_THAT(shardIndices.size(), Eq(100u));
+    for (const auto& entry : shardIndices) {
+        EXPECT_THAT(entry.second, AllOf(Ge(1), Le(3)));
+    }
+
+    // Adding a test case does not move the others to different shards.
+    testCases.push_back(TestCaseBuilder().setId("foo_1_101").build());
+    map<string, int> newShardIndices = Sharding::assign(TestSuite({TestGroup(1, testCases)}), 3);
+    for (const auto& entry : shardIndices) {
+        EXPECT_THAT(newShardIndices[entry.first], Eq(entry.second));
+    }
+}
+
+TEST_F(ShardingTests, Assign_LongestProcessingTimeFirst) {
+    TestSuite testSuite = TestSuite({
+            TestGroup(1, {
+                    TestCaseBuilder().setId("foo_1_1").build(),
+                    TestCaseBuilder().setId("foo_1_2").build(),
+                    TestCaseBuilder().setId("foo_1_3").build()}),
+            TestGroup(2, {
+                    TestCaseBuilder().setId("foo_2_1").build(),
+                    TestCaseBuilder().setId("foo_2_2").build()})});
+
+    // foo_2_2 is assumed to take the average, 5 seconds.
+    map<string, double> durations = {{"foo_1_1", 10}, {"foo_1_2", 1}, {"foo_1_3", 1}, {"foo_2_1", 8}, {"stale", 100}};
+    EXPECT_THAT(Sharding::assign(testSuite, 2, durations), ElementsAre(
+            Pair("foo_1_1", 1),
+            Pair("foo_1_2", 1),
+            Pair("foo_1_3", 1),
+            Pair("foo_2_1", 2),
+            Pair("foo_2_2", 2)));
+}
+
+TEST_F(ShardingTests, Fingerprint) {
+    string fingerprint = Sharding::fingerprint(testSuite, config);
+    EXPECT_THAT(fingerprint.size(), Eq(16u));
+    EXPECT_THAT(Sharding::fingerprint(testSuite, config), Eq(fingerprint));
+
+    TestSuite changedTestSuite = TestSuite({
+            TestGroup(1, {
+                    TestCaseBuilder().setId("foo_1_1").setDescription("N = 1").setSubtaskIds({1}).build(),
+                    TestCaseBuilder().setId("foo_1_2").setDescription("N = 3").setSubtaskIds({1}).build()})});
+    EXPECT_THAT(Sharding::fingerprint(changedTestSuite, config), Ne(fingerprint));
+
+    string digest = Sharding::durationsDigest({{"foo_1_1", 8}});
+    EXPECT_THAT(Sharding::fingerprint(testSuite, config, digest), Ne(fingerprint));
+}
+
+TEST_F(ShardingTests, DurationsDigest) {
+    EXPECT_THAT(Sharding::durationsDigest({}), Eq(""));
+    string digest = Sharding::durationsDigest({{"foo_1_1", 8}, {"foo_1_2", 4}});
+    EXPECT_THAT(digest.size(), Eq(16u));
+    EXPECT_THAT(Sharding::durationsDigest({{"foo_1_1", 8}, {"foo_1_2", 4}}), Eq(digest));
+    EXPECT_THAT(Sharding::durationsDigest({{"foo_1_1", 8}, {"foo_1_2", 4.5}}), Ne(digest));
+}
+
+TEST_F(ShardingTests, ManifestFilename) {
+    EXPECT_THAT(Sharding::manifestFilename("tc", 2, 4), Eq("tc/shard-2-of-4.manifest"));
+    EXPECT_TRUE(Sharding::isManifestFilename("shard-2-of-4.manifest"));
+    EXPECT_FALSE(Sharding::isManifestFilename("foo_1_1.in"));
+}
+
+}
@@ -12,9 +12,14 @@
 using std::ostringstream;
 
 using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::ContainsRegex;
 using ::testing::Eq;
 using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Pair;
 using ::testing::Return;
+using ::testing::SaveArg;
 using ::testing::Test;
 using ::testing::Throw;
 
@@ -65,14 +70,396 @@ TEST_F(TestCaseGeneratorTests, Generation_Successful) {
         EXPECT_CALL(os, openForWriting("dir/foo_1.in"));
         EXPECT_CALL(ioManipulator, printInput(out));
         EXPECT_CALL(os, closeOpenedWritingStream(out));
-        EXPECT_CALL(os, execute("python Sol.py", "dir/foo_1.in", "dir/foo_1.out", _));
+        EXPECT_CALL(os, execute("python Sol.py", "dir/foo_1.in", "dir/foo_1.out", "dir/_foo_1_error.tmp"));
         EXPECT_CALL(ioManipulator, parseOutput(executionResult.outputStream()));
         EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+        EXPECT_CALL(logger, logTestCaseMetrics(testCase, _));
     }
     EXPECT_TRUE(generator.generate(testCase, config));
     EXPECT_TRUE(applied);
 }
 
+TEST_F(TestCaseGeneratorTests, Generation_Successful_Metrics) {
+    ON_CALL(ioManipulator, printInput(out))
+            .WillByDefault(Invoke([] (ostream* out) {*out << "42" << endl;}));
+    TestCaseMetrics metrics;
+    EXPECT_CALL(logger, logTestCaseMetrics(testCase, _))
+            .WillOnce(SaveArg<1>(&metrics));
+
+    EXPECT_TRUE(generator.generate(testCase, config));
+    EXPECT_THAT(metrics.inputSize(), Eq(optional<long long>(3)));
+    EXPECT_THAT(metrics.outputSize(), Eq(optional<long long>(0)));
+    EXPECT_THAT(metrics.stageDurations(), ElementsAre(
+            Pair("apply", _),
+            Pair("verify", _),
+            Pair("print", _),
+            Pair("execute", _),
+            Pair("parse", _)));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_CrossChecked) {
+    GeneratorConfig crossCheckedConfig = GeneratorConfigBuilder(config)
+            .setAlternativeSolutionCommands({"./alt1", "./alt2"})
+            .build();
+    ON_CALL(os, executeConcurrently(_, _, _, _))
+            .WillByDefault(Return(vector<ExecutionResult>{
+                    ExecutionResult(0, new istringstream("42\n"), new istringstream(), 0.5),
+                    ExecutionResult(0, new istringstream("42\n"), new istringstream(), 2.0),
+                    ExecutionResult(0, new istringstream("42\n"), new istringstream(), 1.0)}));
+    string parsedOutput;
+    ON_CALL(ioManipulator, parseOutput(_))
+            .WillByDefault(Invoke([&] (istream* in) {getline(*in, parsedOutput);}));
+    TestCaseMetrics metrics;
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, executeConcurrently(
+                ElementsAre("python Sol.py", "./alt1", "./alt2"),
+                "dir/foo_1.in",
+                ElementsAre("dir/foo_1.out", "dir/_foo_1_alternative_1.tmp", "dir/_foo_1_alternative_2.tmp"),
+                ElementsAre("dir/_foo_1_error.tmp", "", "")));
+        EXPECT_CALL(os, removeFile("dir/_foo_1_alternative_1.tmp"));
+        EXPECT_CALL(os, removeFile("dir/_foo_1_alternative_2.tmp"));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+        EXPECT_CALL(logger, logTestCaseMetrics(testCase, _))
+                .WillOnce(SaveArg<1>(&metrics));
+    }
+    EXPECT_CALL(os, execute(_, _, _, _)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testCase, crossCheckedConfig));
+    EXPECT_THAT(parsedOutput, Eq("42"));
+    EXPECT_THAT(metrics.solutionDurations(), ElementsAre(
+            Pair("python Sol.py", 0.5),
+            Pair("./alt1", 2.0),
+            Pair("./alt2", 1.0)));
+    EXPECT_THAT(metrics.slowestSolution(), Eq(optional<string>("./alt1")));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_CrossChecked_Failed_Disagreement) {
+    GeneratorConfig crossCheckedConfig = GeneratorConfigBuilder(config)
+            .setAlternativeSolutionCommands({"./alt1", "./alt2", "./alt3"})
+            .build();
+    ON_CALL(os, executeConcurrently(_, _, _, _))
+            .WillByDefault(Return(vector<ExecutionResult>{
+                    ExecutionResult(0, new istringstream("42\n"), new istringstream()),
+                    ExecutionResult(0, new istringstream("42\n"), new istringstream()),
+                    ExecutionResult(0, new istringstream("43\n"), new istringstream()),
+                    ExecutionResult(1, new istringstream(), new istringstream())}));
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, removeFile("dir/_foo_1_alternative_1.tmp"));
+        EXPECT_CALL(os, removeFile("dir/_foo_1_alternative_2.tmp"));
+        EXPECT_CALL(os, removeFile("dir/_foo_1_alternative_3.tmp"));
+        EXPECT_CALL(logger, logTestCaseFailedResult("N = 42"));
+        EXPECT_CALL(logger, logSolutionsDisagreement(ElementsAre(
+                "./alt2: different output",
+                "./alt3: exit code 1")));
+    }
+    EXPECT_CALL(ioManipulator, parseOutput(_)).Times(0);
+
+    EXPECT_FALSE(generator.generate(testCase, crossCheckedConfig));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Successful_FileManifest) {
+    FileManifest fileManifest;
+    fileManifest.record("foo_1.out", FileDigest(1, 1));
+    TestCaseGenerator hashingGenerator(&verifier, &ioManipulator, &os, &logger, &fileManifest);
+    ON_CALL(ioManipulator, printInput(_))
+            .WillByDefault(Invoke([] (ostream* out) {*out << "42" << endl;}));
+    ON_CALL(os, execute(_, _, _, _))
+            .WillByDefault(Return(ExecutionResult(0, new istringstream("abc"), new istringstream())));
+
+    EXPECT_TRUE(hashingGenerator.generate(testCase, config));
+
+    XxHash64 inputHash;
+    inputHash.update("42\n");
+    EXPECT_THAT(((ostringstream*) out)->str(), Eq("42\n"));
+    EXPECT_THAT(fileManifest.digests(), ElementsAre(
+            Pair("foo_1.in", FileDigest(inputHash.digest(), 3)),
+            Pair("foo_1.out", FileDigest(0x44bc2cf5ad770999ULL, 3))));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Failed_FileManifest) {
+    FileManifest fileManifest;
+    fileManifest.record("foo_1.in", FileDigest(1, 1));
+    TestCaseGenerator hashingGenerator(&verifier, &ioManipulator, &os, &logger, &fileManifest);
+    ON_CALL(verifier, verifyConstraints(_))
+            .WillByDefault(Return(ConstraintsVerificationResult({{1, {"1 <= N <= 10"}}}, {})));
+
+    EXPECT_FALSE(hashingGenerator.generate(testCase, config));
+    EXPECT_TRUE(fileManifest.digests().empty());
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Successful_DuplicateDetector) {
+    GeneratorConfig nearDuplicatesConfig = GeneratorConfigBuilder(config)
+            .setNearDuplicateSimilarity(90)
+            .build();
+    DuplicateDetector duplicateDetector;
+    TestCaseGenerator detectingGenerator(&verifier, &ioManipulator, &os, &logger, nullptr, &duplicateDetector);
+    ON_CALL(ioManipulator, printInput(_))
+            .WillByDefault(Invoke([] (ostream* out) {*out << "42" << endl;}));
+
+    ostringstream sketched;
+    MinHashStreamBuf minHashBuf(sketched.rdbuf());
+    ostream(&minHashBuf) << "42" << endl;
+    duplicateDetector.record("foo_0", FileDigest(7, 3), optional<MinHashSignature>(minHashBuf.signature()));
+
+    EXPECT_TRUE(detectingGenerator.generate(testCase, nearDuplicatesConfig));
+
+    XxHash64 inputHash;
+    inputHash.update("42\n");
+    duplicateDetector.record("foo_2", FileDigest(inputHash.digest(), 3));
+    EXPECT_THAT(((ostringstream*) out)->str(), Eq("42\n"));
+    EXPECT_THAT(duplicateDetector.duplicates(), ElementsAre(ElementsAre("foo_1", "foo_2")));
+    EXPECT_THAT(duplicateDetector.nearDuplicates(1.0), ElementsAre(NearDuplicateTestCases("foo_0", "foo_1", 1.0)));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Successful_InputStatisticsTable) {
+    InputStatisticsTable inputStatisticsTable;
+    TestCaseGenerator collectingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, &inputStatisticsTable);
+    VariableStatistics statistics("N", VariableType::SCALAR);
+    statistics.add(42);
+    ON_CALL(ioManipulator, printInput(_))
+            .WillByDefault(Invoke([] (ostream* out) {*out << "42" << endl;}));
+    ON_CALL(ioManipulator, inputStatistics())
+            .WillByDefault(Return(vector<VariableStatistics>{statistics}));
+    {
+        InSequence sequence;
+        EXPECT_CALL(ioManipulator, collectInputStatistics());
+        EXPECT_CALL(ioManipulator, printInput(_));
+    }
+
+    EXPECT_TRUE(collectingGenerator.generate(testCase, config));
+    EXPECT_THAT(inputStatisticsTable.columns(), ElementsAre("bytes", "tokens", "N"));
+    EXPECT_THAT(inputStatisticsTable.rows(), ElementsAre(Pair("foo_1", ElementsAre("3", "1", "42"))));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Failed_InputStatisticsTable) {
+    InputStatisticsTable inputStatisticsTable;
+    inputStatisticsTable.record("foo_1", 3, {});
+    TestCaseGenerator collectingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, &inputStatisticsTable);
+    ON_CALL(verifier, verifyConstraints(_))
+            .WillByDefault(Return(ConstraintsVerificationResult({{1, {"1 <= N <= 10"}}}, {})));
+
+    EXPECT_FALSE(collectingGenerator.generate(testCase, config));
+    EXPECT_TRUE(inputStatisticsTable.rows().empty());
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Successful_DurationProfile) {
+    DurationProfile durationProfile;
+    TestCaseGenerator profilingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, nullptr, &durationProfile);
+    TestCaseMetrics metrics = TestCaseMetricsBuilder().build();
+    EXPECT_CALL(logger, logTestCaseMetrics(testCase, _))
+            .WillOnce(SaveArg<1>(&metrics));
+
+    EXPECT_TRUE(profilingGenerator.generate(testCase, config));
+    EXPECT_THAT(durationProfile.durations(), ElementsAre(Pair("foo_1", metrics.totalDuration())));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Failed_DurationProfile) {
+    DurationProfile durationProfile;
+    durationProfile.record("foo_1", 10);
+    TestCaseGenerator profilingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, nullptr, &durationProfile);
+    ON_CALL(verifier, verifyConstraints(_))
+            .WillByDefault(Return(ConstraintsVerificationResult({{1, {"1 <= N <= 10"}}}, {})));
+
+    EXPECT_FALSE(profilingGenerator.generate(testCase, config));
+    EXPECT_TRUE(durationProfile.durations().empty());
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Successful_Traced) {
+    Tracer tracer;
+    TestCaseGenerator tracingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, nullptr, nullptr, nullptr, &tracer);
+
+    EXPECT_TRUE(tracingGenerator.generate(testCase, config));
+    ostringstream trace;
+    tracer.write(&trace);
+    EXPECT_THAT(trace.str(), ContainsRegex(
+            "\"apply\".*\"foo_1\".*\"verify\".*\"print\".*\"execute\".*\"parse\".*"
+            "\"generate\",\"cat\":\"testCase\""));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Successful_Journal) {
+    GenerationJournal journal;
+    TestCaseGenerator journalingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, nullptr, nullptr, &journal);
+    ostringstream journalOut;
+    ostringstream journalLog;
+    ON_CALL(os, openForWriting("dir/generation.journal.tmp"))
+            .WillByDefault(Return(&journalOut));
+    ON_CALL(os, openForAppending("dir/generation.journal"))
+            .WillByDefault(Return(&journalLog));
+    journal.open(&os, config);
+    {
+        InSequence sequence;
+        EXPECT_CALL(ioManipulator, printInput(_));
+        EXPECT_CALL(os, syncFile("dir/foo_1.in"));
+        EXPECT_CALL(os, syncFile("dir/foo_1.out"));
+        EXPECT_CALL(os, syncFile("dir/generation.journal"));
+    }
+    EXPECT_CALL(os, renameFile(_, _)).Times(0);
+
+    EXPECT_TRUE(journalingGenerator.generate(testCase, config));
+    string fingerprint = GenerationJournal::fingerprint(testCase, config);
+    EXPECT_TRUE(journal.contains("foo_1", fingerprint));
+    EXPECT_THAT(journalLog.str(), Eq("record " + fingerprint + " foo_1\n"));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Failed_Journal_Sync) {
+    GenerationJournal journal;
+    TestCaseGenerator journalingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, nullptr, nullptr, &journal);
+    ON_CALL(os, syncFile("dir/foo_1.out"))
+            .WillByDefault(Throw(runtime_error("Cannot sync dir/foo_1.out: No space left on device")));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseFailedResult(testCase.description()));
+        EXPECT_CALL(logger, logSimpleFailure("Cannot sync dir/foo_1.out: No space left on device"));
+    }
+
+    EXPECT_FALSE(journalingGenerator.generate(testCase, config));
+    EXPECT_TRUE(journal.fingerprints().empty());
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Failed_Journal) {
+    GenerationJournal journal;
+    journal.record("foo_1", GenerationJournal::fingerprint(testCase, config));
+    TestCaseGenerator journalingGenerator(
+            &verifier, &ioManipulator, &os, &logger, nullptr, nullptr, nullptr, nullptr, &journal);
+    ostringstream journalOut;
+    ostringstream journalLog;
+    ON_CALL(os, openForWriting("dir/generation.journal.tmp"))
+            .WillByDefault(Return(&journalOut));
+    ON_CALL(os, openForAppending("dir/generation.journal"))
+            .WillByDefault(Return(&journalLog));
+    ON_CALL(verifier, verifyConstraints(_))
+            .WillByDefault(Return(ConstraintsVerificationResult({{1, {"1 <= N <= 10"}}}, {})));
+    journal.open(&os, config);
+    {
+        // The entry is removed from the journal file before the files are overwritten.
+        InSequence sequence;
+        EXPECT_CALL(os, syncFile("dir/generation.journal"));
+        EXPECT_CALL(verifier, verifyConstraints(_));
+    }
+
+    EXPECT_FALSE(journalingGenerator.generate(testCase, config));
+    EXPECT_TRUE(journal.fingerprints().empty());
+    EXPECT_THAT(journalLog.str(), Eq("remove foo_1\n"));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_NoOutput) {
+    GeneratorConfig noOutputConfig = GeneratorConfigBuilder(config)
+            .setNoOutput(true)
+            .build();
+    TestCaseMetrics metrics;
+    {
+        InSequence sequence;
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1, 2}));
+        EXPECT_CALL(os, openForWriting("dir/foo_1.in"));
+        EXPECT_CALL(ioManipulator, printInput(out));
+        EXPECT_CALL(os, closeOpenedWritingStream(out));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+        EXPECT_CALL(logger, logTestCaseMetrics(testCase, _))
+                .WillOnce(SaveArg<1>(&metrics));
+    }
+    EXPECT_CALL(os, execute(_, _, _, _)).Times(0);
+    EXPECT_CALL(ioManipulator, parseOutput(_)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testCase, noOutputConfig));
+    EXPECT_FALSE(metrics.outputSize());
+    EXPECT_THAT(metrics.stageDurations(), ElementsAre(
+            Pair("apply", _),
+            Pair("verify", _),
+            Pair("print", _)));
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_DryRun) {
+    GeneratorConfig dryRunConfig = GeneratorConfigBuilder(config)
+            .setDryRun(true)
+            .build();
+    {
+        InSequence sequence;
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1, 2}));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+    }
+    EXPECT_CALL(os, openForWriting(_)).Times(0);
+    EXPECT_CALL(ioManipulator, printInput(_)).Times(0);
+    EXPECT_CALL(os, execute(_, _, _, _)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testCase, dryRunConfig));
+    EXPECT_TRUE(applied);
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_Snapshot) {
+    GeneratorConfig snapshotConfig = GeneratorConfigBuilder(config)
+            .setSnapshotDir("snapshots")
+            .build();
+    ostream* snapshotOut = new ostringstream();
+    ON_CALL(os, openForWriting("snapshots/foo_1.snap"))
+            .WillByDefault(Return(snapshotOut));
+    {
+        InSequence sequence;
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1, 2}));
+        EXPECT_CALL(os, openForWriting("snapshots/foo_1.snap"));
+        EXPECT_CALL(ioManipulator, snapshotInput(snapshotOut));
+        EXPECT_CALL(os, closeOpenedWritingStream(snapshotOut));
+        EXPECT_CALL(os, openForWriting("dir/foo_1.in"));
+        EXPECT_CALL(ioManipulator, printInput(out));
+        EXPECT_CALL(os, closeOpenedWritingStream(out));
+    }
+    EXPECT_CALL(ioManipulator, restoreInput(_)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testCase, snapshotConfig));
+    EXPECT_TRUE(applied);
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_FromSnapshots) {
+    GeneratorConfig snapshotConfig = GeneratorConfigBuilder(config)
+            .setSnapshotDir("snapshots")
+            .setFromSnapshots(true)
+            .build();
+    ON_CALL(os, openForReading("snapshots/foo_1.snap"))
+            .WillByDefault(Invoke([] (const string&) {return new istringstream("snapshot");}));
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, openForReading("snapshots/foo_1.snap"));
+        EXPECT_CALL(ioManipulator, restoreInput(_));
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1, 2}));
+        EXPECT_CALL(os, openForWriting("dir/foo_1.in"));
+        EXPECT_CALL(ioManipulator, printInput(out));
+    }
+    EXPECT_CALL(ioManipulator, snapshotInput(_)).Times(0);
+
+    EXPECT_TRUE(generator.generate(testCase, snapshotConfig));
+    EXPECT_FALSE(applied);
+}
+
+TEST_F(TestCaseGeneratorTests, Generation_FromSnapshots_Failed_MissingSnapshot) {
+    GeneratorConfig snapshotConfig = GeneratorConfigBuilder(config)
+            .setSnapshotDir("snapshots")
+            .setFromSnapshots(true)
+            .build();
+    ON_CALL(os, openForReading("snapshots/foo_1.snap"))
+            .WillByDefault(Invoke([] (const string&) {
+                istringstream* in = new istringstream();
+                in->setstate(ios::failbit);
+                return in;
+            }));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseFailedResult("N = 42"));
+        EXPECT_CALL(logger, logSimpleFailure("Cannot read snapshot snapshots/foo_1.snap"));
+    }
+    EXPECT_CALL(ioManipulator, restoreInput(_)).Times(0);
+
+    EXPECT_FALSE(generator.generate(testCase, snapshotConfig));
+    EXPECT_FALSE(applied);
+}
+
 TEST_F(TestCaseGeneratorTests, Generation_Failed_Verification) {
     ConstraintsVerificationResult verificationResult({{1, {"1 <= N <= 10"}}}, {});
     ON_CALL(verifier, verifyConstraints(set<int>{1, 2}))
@@ -85,12 +472,26 @@ TEST_F(TestCaseGeneratorTests, Generation_Failed_Verification) {
     EXPECT_FALSE(generator.generate(testCase, config));
 }
 
+TEST_F(TestCaseGeneratorTests, Generation_Failed_Verification_Metrics) {
+    ConstraintsVerificationResult verificationResult({{1, {"1 <= N <= 10"}}}, {});
+    ON_CALL(verifier, verifyConstraints(set<int>{1, 2}))
+            .WillByDefault(Return(verificationResult));
+    TestCaseMetrics metrics;
+    EXPECT_CALL(logger, logTestCaseMetrics(testCase, _))
+            .WillOnce(SaveArg<1>(&metrics));
+
+    EXPECT_FALSE(generator.generate(testCase, config));
+    EXPECT_FALSE(metrics.inputSize());
+    EXPECT_THAT(metrics.stageDurations(), ElementsAre(Pair("apply", _)));
+}
+
 TEST_F(TestCaseGeneratorTests, Generation_Failed_InputGeneration) {
     string message = "input error";
     ON_CALL(ioManipulator, printInput(out))
             .WillByDefault(Throw(runtime_error(message)));
     {
         InSequence sequence;
+        EXPECT_CALL(os, closeOpenedWritingStream(out));
         EXPECT_CALL(logger, logTestCaseFailedResult("N = 42"));
         EXPECT_CALL(logger, logSimpleFailure(message));
     }
@@ -0,0 +1,149 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/io_manipulator/EdgesIOSegmentManipulator.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class EdgesIOSegmentManipulatorTests : public Test {
+protected:
+    vector<int> U, V;
+    vector<long long> W;
+    EdgesIOSegment* segment = EdgesIOSegmentBuilder()
+            .addVertexVariable(new VectorImpl<int>(U, "U"))
+            .addVertexVariable(new VectorImpl<int>(V, "V"))
+            .setSize(3)
+            .build();
+    EdgesIOSegment* weightedSegment = EdgesIOSegmentBuilder()
+            .addVertexVariable(new VectorImpl<int>(U, "U"))
+            .addVertexVariable(new VectorImpl<int>(V, "V"))
+            .setWeightVariable(Vector::create(W, "W"))
+            .setSize(3)
+            .build();
+    EdgesIOSegment* checkedSegment = EdgesIOSegmentBuilder()
+            .addVertexVariable(new VectorImpl<int>(U, "U"))
+            .addVertexVariable(new VectorImpl<int>(V, "V"))
+            .setSize(3)
+            .setVertexRange(1, 4)
+            .setNoSelfLoops()
+            .setNoMultiEdges()
+            .build();
+};
+
+TEST_F(EdgesIOSegmentManipulatorTests, Parsing_Successful) {
+    istringstream in("1 2\n2 3\n3 1\n");
+
+    EdgesIOSegmentManipulator::parse(segment, &in);
+    EXPECT_THAT(U, Eq(vector<int>{1, 2, 3}));
+    EXPECT_THAT(V, Eq(vector<int>{2, 3, 1}));
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Parsing_Weighted_Successful) {
+    istringstream in("1 2 10\n2 3 1000000000000\n3 1 30\n");
+
+    EdgesIOSegmentManipulator::parse(weightedSegment, &in);
+    EXPECT_THAT(U, Eq(vector<int>{1, 2, 3}));
+    EXPECT_THAT(V, Eq(vector<int>{2, 3, 1}));
+    EXPECT_THAT(W, Eq(vector<long long>{10, 1000000000000LL, 30}));
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Parsing_Failed_MissingWhitespace) {
+    istringstream in("1 2\n2");
+
+    try {
+        EdgesIOSegmentManipulator::parse(segment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'U[1]'"));
+    }
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Parsing_Failed_MissingNewline) {
+    istringstream in("1 2 10\n2 3 20 ");
+
+    try {
+        EdgesIOSegmentManipulator::parse(weightedSegment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <newline> after 'W[1]'"));
+    }
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Parsing_Failed_VertexOutOfRange) {
+    istringstream in("1 2\n2 5\n3 1\n");
+
+    try {
+        EdgesIOSegmentManipulator::parse(checkedSegment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Vertex 'V[1]' = 5 is out of range [1, 4]"));
+    }
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Parsing_Failed_SelfLoop) {
+    istringstream in("1 2\n3 3\n3 1\n");
+
+    try {
+        EdgesIOSegmentManipulator::parse(checkedSegment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Edge ('U[1]', 'V[1]') is a self-loop on vertex 3"));
+    }
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Parsing_Failed_MultiEdge) {
+    istringstream in("1 2\n2 3\n2 1\n");
+
+    try {
+        EdgesIOSegmentManipulator::parse(checkedSegment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Edge ('U[2]', 'V[2]') duplicates edge ('U[0]', 'V[0]')"));
+    }
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Printing_Successful) {
+    ostringstream out;
+
+    U = {1, 2, 3};
+    V = {2, 3, 1};
+    W = {10, 20, 30};
+    EdgesIOSegmentManipulator::print(weightedSegment, &out);
+    EXPECT_THAT(out.str(), Eq("1 2 10\n2 3 20\n3 1 30\n"));
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Printing_Failed_SizeMismatch) {
+    ostringstream out;
+
+    U = {1, 2, 3};
+    V = {2, 3};
+    try {
+        EdgesIOSegmentManipulator::print(segment, &out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Number of elements of vector 'V' unsatisfied. Expected: 3, actual: 2"));
+    }
+}
+
+TEST_F(EdgesIOSegmentManipulatorTests, Printing_Failed_MultiEdge) {
+    ostringstream out;
+
+    U = {1, 2, 3};
+    V = {2, 3, 2};
+    try {
+        EdgesIOSegmentManipulator::print(checkedSegment, &out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Edge ('U[2]', 'V[2]') duplicates edge ('U[1]', 'V[1]')"));
+    }
+}
+
+}
@@ -56,6 +56,14 @@ TEST_F(IOManipulatorTests, Parsing_Failed_MissingEof) {
     }
 }
 
+TEST_F(IOManipulatorTests, Parsing_WithoutEof_Successful) {
+    istringstream in("123\n42\n7\n5 6\n7 8\n456\n");
+    manipulator->parseInputWithoutEof(&in);
+    EXPECT_THAT(A, Eq(123));
+    EXPECT_THAT(M, Eq((vector<vector<int>>{{5, 6}, {7, 8}})));
+    EXPECT_THAT(in.peek(), Eq('4'));
+}
+
 TEST_F(IOManipulatorTests, Printing_Successful) {
     A = 123;
     V = {42, 7};
@@ -65,4 +73,126 @@ TEST_F(IOManipulatorTests, Printing_Successful) {
     EXPECT_THAT(out.str(), Eq("123\n42\n7\n5 6\n7 8\n"));
 }
 
+TEST_F(IOManipulatorTests, Printing_InputStatistics) {
+    manipulator->collectInputStatistics();
+    for (int value : {1, 100}) {
+        A = value;
+        V = {42, 7};
+        M = {{5, 6}, {value, 8}};
+        ostringstream out;
+        manipulator->printInput(&out);
+    }
+
+    vector<VariableStatistics> statistics = manipulator->inputStatistics();
+    ASSERT_THAT(statistics.size(), Eq(3));
+    EXPECT_THAT(statistics[0].name(), Eq("A"));
+    EXPECT_THAT(statistics[0].min(), Eq(100));
+    EXPECT_THAT(statistics[1].name(), Eq("V"));
+    EXPECT_THAT(statistics[1].valuesCount(), Eq(2));
+    EXPECT_THAT(statistics[1].min(), Eq(7));
+    EXPECT_THAT(statistics[1].max(), Eq(42));
+    EXPECT_THAT(statistics[2].name(), Eq("M"));
+    EXPECT_THAT(statistics[2].valuesCount(), Eq(4));
+    EXPECT_THAT(statistics[2].max(), Eq(100));
+}
+
+TEST_F(IOManipulatorTests, TypedFormat_Printing_Successful) {
+    IOFormatBuilder ioFormatBuilder;
+    ioFormatBuilder.prepareForInputFormat();
+    ioFormatBuilder.setTypedFormat(new TypedIOFormatImpl<
+            TypedLineIOSegment<ScalarImpl<int>>,
+            TypedLinesIOSegment<VectorImpl<int>>,
+            TypedGridIOSegment<int>>(
+                    TypedLineIOSegment<ScalarImpl<int>>(ScalarImpl<int>(A, "A")),
+                    TypedLinesIOSegment<VectorImpl<int>>(VectorImpl<int>(V, "V")).setSize(2),
+                    TypedGridIOSegment<int>(MatrixImpl<int>(M, "M")).setSize(2, 2)));
+    IOManipulator typedManipulator(ioFormatBuilder.build());
+
+    A = 123;
+    V = {42, 7};
+    M = {{5, 6}, {7, 8}};
+    ostringstream out;
+    typedManipulator.printInput(&out);
+    EXPECT_THAT(out.str(), Eq("123\n42\n7\n5 6\n7 8\n"));
+
+    istringstream in(out.str());
+    typedManipulator.parseInput(&in);
+    EXPECT_THAT(A, Eq(123));
+    EXPECT_THAT(V, Eq((vector<int>{42, 7})));
+    EXPECT_THAT(M, Eq((vector<vector<int>>{{5, 6}, {7, 8}})));
+}
+
+TEST_F(IOManipulatorTests, Snapshot_Successful) {
+    A = 123;
+    V = {42, 7};
+    M = {{5, 6}, {7, 8}};
+    ostringstream out;
+    manipulator->snapshotInput(&out);
+
+    A = 0;
+    V.clear();
+    M.clear();
+    istringstream in(out.str());
+    manipulator->restoreInput(&in);
+    EXPECT_THAT(A, Eq(123));
+    EXPECT_THAT(V, Eq((vector<int>{42, 7})));
+    EXPECT_THAT(M, Eq((vector<vector<int>>{{5, 6}, {7, 8}})));
+}
+
+TEST_F(IOManipulatorTests, Snapshot_Failed_FormatMismatch) {
+    IOFormatBuilder ioFormatBuilder;
+    ioFormatBuilder.prepareForInputFormat();
+    ioFormatBuilder.newLineIOSegment()
+            .addScalarVariable(Scalar::create(A, "B"));
+    IOManipulator otherManipulator(ioFormatBuilder.build());
+    ostringstream out;
+    otherManipulator.snapshotInput(&out);
+
+    istringstream in(out.str());
+    try {
+        manipulator->restoreInput(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Snapshot does not match the input format"));
+    }
+}
+
+TEST_F(IOManipulatorTests, Snapshot_Failed_NotSnapshot) {
+    istringstream in("123\n42\n7\n5 6\n7 8\n");
+    try {
+        manipulator->restoreInput(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Snapshot is truncated"));
+    }
+}
+
+TEST_F(IOManipulatorTests, TypedFormat_Snapshot_Successful) {
+    IOFormatBuilder ioFormatBuilder;
+    ioFormatBuilder.prepareForInputFormat();
+    ioFormatBuilder.setTypedFormat(new TypedIOFormatImpl<
+            TypedLineIOSegment<ScalarImpl<int>>,
+            TypedLinesIOSegment<VectorImpl<int>>,
+            TypedGridIOSegment<int>>(
+                    TypedLineIOSegment<ScalarImpl<int>>(ScalarImpl<int>(A, "A")),
+                    TypedLinesIOSegment<VectorImpl<int>>(VectorImpl<int>(V, "V")).setSize(2),
+                    TypedGridIOSegment<int>(MatrixImpl<int>(M, "M")).setSize(2, 2)));
+    IOManipulator typedManipulator(ioFormatBuilder.build());
+
+    A = 123;
+    V = {42, 7};
+    M = {{5, 6}, {7, 8}};
+    ostringstream out;
+    typedManipulator.snapshotInput(&out);
+
+    A = 0;
+    V.clear();
+    M.clear();
+    istringstream in(out.str());
+    manipulator->restoreInput(&in);
+    EXPECT_THAT(A, Eq(123));
+    EXPECT_THAT(V, Eq((vector<int>{42, 7})));
+    EXPECT_THAT(M, Eq((vector<vector<int>>{{5, 6}, {7, 8}})));
+}
+
 }
@@ -12,8 +12,13 @@ public:
             : IOManipulator(IOFormat()) {}
 
     MOCK_METHOD1(printInput, void(ostream*));
+    MOCK_METHOD0(collectInputStatistics, void());
+    MOCK_CONST_METHOD0(inputStatistics, vector<VariableStatistics>());
     MOCK_METHOD1(parseInput, void(istream*));
+    MOCK_METHOD1(parseInputWithoutEof, void(istream*));
     MOCK_METHOD1(parseOutput, void(istream*));
+    MOCK_METHOD1(snapshotInput, void(ostream*));
+    MOCK_METHOD1(restoreInput, void(istream*));
 };
 
 }
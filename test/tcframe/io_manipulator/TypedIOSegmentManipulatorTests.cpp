@@ -0,0 +1,172 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/io_manipulator/TypedIOSegmentManipulator.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class TypedIOSegmentManipulatorTests : public Test {
+protected:
+    int A, B;
+    vector<int> C;
+    vector<int> X, Y;
+    vector<vector<int>> Z;
+    vector<vector<char>> M;
+
+    TypedLineIOSegment<ScalarImpl<int>, ScalarImpl<int>, TypedLineIOSegmentVector<int>> lineSegment =
+            TypedLineIOSegment<ScalarImpl<int>, ScalarImpl<int>, TypedLineIOSegmentVector<int>>(
+                    ScalarImpl<int>(A, "A"),
+                    ScalarImpl<int>(B, "B"),
+                    TypedLineIOSegmentVector<int>(VectorImpl<int>(C, "C"), 2));
+    TypedLinesIOSegment<VectorImpl<int>, VectorImpl<int>, MatrixImpl<int>> linesSegment =
+            TypedLinesIOSegment<VectorImpl<int>, VectorImpl<int>, MatrixImpl<int>>(
+                    VectorImpl<int>(X, "X"),
+                    VectorImpl<int>(Y, "Y"),
+                    MatrixImpl<int>(Z, "Z"))
+            .setSize(3);
+    TypedGridIOSegment<char> gridSegment = TypedGridIOSegment<char>(MatrixImpl<char>(M, "M"))
+            .setSize(2, 3);
+};
+
+TEST_F(TypedIOSegmentManipulatorTests, Line_Parsing_Successful) {
+    istringstream in("1 2 3 4\n");
+
+    TypedIOSegmentManipulator::parse(lineSegment, &in);
+    EXPECT_THAT(A, Eq(1));
+    EXPECT_THAT(B, Eq(2));
+    EXPECT_THAT(C, Eq(vector<int>{3, 4}));
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Line_Parsing_Failed_MissingSpace) {
+    istringstream in("1\n");
+
+    try {
+        TypedIOSegmentManipulator::parse(lineSegment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'A'"));
+    }
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Line_Parsing_Failed_MissingNewline) {
+    istringstream in("1 2 3 4 5\n");
+
+    try {
+        TypedIOSegmentManipulator::parse(lineSegment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <newline> after 'C'"));
+    }
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Line_Printing_Successful) {
+    A = 1;
+    B = 2;
+    C = {3, 4};
+    ostringstream out;
+
+    TypedIOSegmentManipulator::print(lineSegment, &out);
+    EXPECT_THAT(out.str(), Eq("1 2 3 4\n"));
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Line_Printing_Failed_SizeMismatch) {
+    C = {3};
+    ostringstream out;
+
+    try {
+        TypedIOSegmentManipulator::print(lineSegment, &out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Number of elements of vector 'C' unsatisfied. Expected: 2, actual: 1"));
+    }
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Lines_Parsing_Successful) {
+    istringstream in("1 2\n3 4 5 6\n7 8 9\n");
+
+    TypedIOSegmentManipulator::parse(linesSegment, &in);
+    EXPECT_THAT(X, Eq(vector<int>{1, 3, 7}));
+    EXPECT_THAT(Y, Eq(vector<int>{2, 4, 8}));
+    EXPECT_THAT(Z, Eq(vector<vector<int>>{{}, {5, 6}, {9}}));
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Lines_Parsing_Failed_MissingSpace) {
+    istringstream in("1 2\n3\n");
+
+    try {
+        TypedIOSegmentManipulator::parse(linesSegment, &in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'X[1]'"));
+    }
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Lines_Printing_Successful) {
+    X = {1, 3, 7};
+    Y = {2, 4, 8};
+    Z = {{}, {5, 6}, {9}};
+    ostringstream out;
+
+    TypedIOSegmentManipulator::print(linesSegment, &out);
+    EXPECT_THAT(out.str(), Eq("1 2\n3 4 5 6\n7 8 9\n"));
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Lines_Printing_Failed_SizeMismatch) {
+    X = {1, 3, 7};
+    Y = {2, 4};
+    Z = {{}, {}, {}};
+    ostringstream out;
+
+    try {
+        TypedIOSegmentManipulator::print(linesSegment, &out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Number of elements of vector 'Y' unsatisfied. Expected: 3, actual: 2"));
+    }
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Grid_Parsing_Successful) {
+    istringstream in("abc\ndef\n");
+
+    TypedIOSegmentManipulator::parse(gridSegment, &in);
+    EXPECT_THAT(M, Eq(vector<vector<char>>{{'a', 'b', 'c'}, {'d', 'e', 'f'}}));
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Grid_Printing_Successful) {
+    M = {{'a', 'b', 'c'}, {'d', 'e', 'f'}};
+    ostringstream out;
+
+    TypedIOSegmentManipulator::print(gridSegment, &out);
+    EXPECT_THAT(out.str(), Eq("abc\ndef\n"));
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Grid_Printing_Failed_SizeMismatch) {
+    M = {{'a', 'b', 'c'}, {'d', 'e'}};
+    ostringstream out;
+
+    try {
+        TypedIOSegmentManipulator::print(gridSegment, &out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Number of columns of row 1 of matrix 'M' unsatisfied. Expected: 3, actual: 2"));
+    }
+}
+
+TEST_F(TypedIOSegmentManipulatorTests, Format_CheckState_Failed) {
+    try {
+        new TypedIOFormatImpl<TypedGridIOSegment<char>>(TypedGridIOSegment<char>(MatrixImpl<char>(M, "M")));
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Grid segment must define matrix sizes"));
+    }
+}
+
+}
@@ -0,0 +1,76 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "tcframe/logger/BufferedLoggerEngine.hpp"
+#include "tcframe/util/StringUtils.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::ostringstream;
+using std::thread;
+using std::vector;
+
+namespace tcframe {
+
+class BufferedLoggerEngineTests : public Test {
+protected:
+    ostringstream out;
+    BufferedLoggerEngine engine{&out};
+};
+
+TEST_F(BufferedLoggerEngineTests, Formatting) {
+    engine.logHeading("SAMPLE TEST CASES");
+    engine.logHangingParagraph(1, "foo_1: ");
+    engine.logParagraph(0, "FAILED");
+    engine.logParagraph(2, "Reasons:");
+    engine.logListItem1(2, "Does not satisfy constraints, on:");
+    engine.logListItem2(3, "1 <= N <= 10");
+    engine.flush();
+
+    EXPECT_THAT(out.str(), Eq(
+            "\n"
+            "[ SAMPLE TEST CASES ]\n"
+            "  foo_1: FAILED\n"
+            "    Reasons:\n"
+            "    * Does not satisfy constraints, on:\n"
+            "      - 1 <= N <= 10\n"));
+}
+
+TEST_F(BufferedLoggerEngineTests, Flushing_Empty) {
+    engine.flush();
+
+    EXPECT_THAT(out.str(), Eq(""));
+}
+
+TEST_F(BufferedLoggerEngineTests, ConcurrentLogging_KeepsOrderOfEachCaller) {
+    int callersCount = 4;
+    int messagesCount = 1000;
+
+    vector<thread> callers;
+    for (int c = 0; c < callersCount; c++) {
+        callers.push_back(thread([=] {
+            for (int m = 0; m < messagesCount; m++) {
+                engine.logParagraph(0, StringUtils::toString(c) + " " + StringUtils::toString(m));
+            }
+        }));
+    }
+    for (thread& caller : callers) {
+        caller.join();
+    }
+    engine.flush();
+
+    vector<int> nextMessages(callersCount, 0);
+    istringstream in(out.str());
+    int c, m;
+    while (in >> c >> m) {
+        EXPECT_THAT(m, Eq(nextMessages[c]));
+        nextMessages[c] = m + 1;
+    }
+    EXPECT_THAT(nextMessages, Eq(vector<int>(callersCount, messagesCount)));
+}
+
+}
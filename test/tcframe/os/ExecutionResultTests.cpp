@@ -0,0 +1,22 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/os/ExecutionResult.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::istringstream;
+
+namespace tcframe {
+
+class ExecutionResultTests : public Test {};
+
+TEST_F(ExecutionResultTests, DescribeExitStatus) {
+    EXPECT_THAT(ExecutionResult(3, new istringstream(), new istringstream()).describeExitStatus(), Eq("exit code 3"));
+    EXPECT_THAT(ExecutionResult(128 + 11, new istringstream(), new istringstream()).describeExitStatus(),
+                Eq(string(strsignal(11))));
+}
+
+}
@@ -11,13 +11,24 @@ public:
     MOCK_METHOD1(openForReading, istream*(const string&));
     MOCK_METHOD1(openForWriting, ostream*(const string&));
     MOCK_METHOD1(closeOpenedWritingStream, void(ostream*));
+    MOCK_METHOD1(openForAppending, ostream*(const string&));
+    MOCK_METHOD1(syncFile, void(const string&));
     MOCK_METHOD1(forceMakeDir, void(const string&));
+    MOCK_METHOD1(makeDir, void(const string&));
+    MOCK_METHOD1(listFiles, vector<string>(const string&));
     MOCK_METHOD1(removeFile, void(const string&));
+    MOCK_METHOD2(renameFile, void(const string&, const string&));
     MOCK_METHOD4(execute, ExecutionResult(
             const string&,
             const string&,
             const string&,
             const string&));
+    MOCK_METHOD4(executeConcurrently, vector<ExecutionResult>(
+            const vector<string>&,
+            const string&,
+            const vector<string>&,
+            const vector<string>&));
+    MOCK_METHOD2(executeConcurrentlyOnInput, vector<ExecutionResult>(const vector<string>&, const string&));
     MOCK_METHOD2(combineMultipleTestCases, void(const string&, int));
 };
 
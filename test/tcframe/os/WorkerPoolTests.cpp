@@ -0,0 +1,84 @@
+#include "gmock/gmock.h"
+
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "tcframe/os/WorkerPool.hpp"
+
+using ::testing::Eq;
+using ::testing::Ne;
+using ::testing::Test;
+
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+class WorkerPoolTests : public Test {
+protected:
+    WorkerPool pool;
+    int tasksRunInThisProcess = 0;
+};
+
+TEST_F(WorkerPoolTests, Run_SingleWorker_InCallingProcess) {
+    vector<string> results = pool.run(1, 3, [&] (int task) {
+        tasksRunInThisProcess++;
+        return StringUtils::toString(task * task);
+    });
+
+    EXPECT_THAT(results, Eq(vector<string>{"0", "1", "4"}));
+    EXPECT_THAT(tasksRunInThisProcess, Eq(3));
+}
+
+TEST_F(WorkerPoolTests, Run_MultipleWorkers_InForkedProcesses) {
+    pid_t parentPid = getpid();
+    vector<string> results = pool.run(3, 10, [&] (int task) {
+        tasksRunInThisProcess++;
+        return StringUtils::toString(task) + (getpid() == parentPid ? " parent" : " child") + string(task * 1000, 'x');
+    });
+
+    ASSERT_THAT(results.size(), Eq(10u));
+    for (int task = 0; task < 10; task++) {
+        EXPECT_THAT(results[task], Eq(StringUtils::toString(task) + " child" + string(task * 1000, 'x')));
+    }
+    EXPECT_THAT(tasksRunInThisProcess, Eq(0));
+}
+
+TEST_F(WorkerPoolTests, Run_MultipleWorkers_TaskThrows) {
+    pid_t parentPid = getpid();
+    try {
+        pool.run(2, 4, [&] (int task) {
+            if (task == 3) {
+                throw runtime_error("Cannot read task 3");
+            }
+            return StringUtils::toString(task);
+        });
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(getpid(), Eq(parentPid));
+        EXPECT_THAT(string(e.what()), Eq("Cannot read task 3"));
+    }
+}
+
+TEST_F(WorkerPoolTests, Run_MultipleWorkers_WorkerExitsAbnormally) {
+    try {
+        pool.run(2, 4, [&] (int task) {
+            if (task == 1) {
+                _exit(3);
+            }
+            return StringUtils::toString(task);
+        });
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(string(e.what()), Eq("Worker 1 exited abnormally"));
+    }
+}
+
+TEST_F(WorkerPoolTests, Run_NoTasks) {
+    EXPECT_THAT(pool.run(4, 0, [] (int) {return string("x");}), Eq(vector<string>()));
+}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/reporter/SubtaskReporter.hpp"
+
+namespace tcframe {
+
+class MockSubtaskReporter : public SubtaskReporter {
+public:
+    MockSubtaskReporter()
+            : SubtaskReporter(nullptr, nullptr) {}
+
+    MOCK_METHOD1(report, SubtaskReport(const TestSuite&));
+};
+
+class MockSubtaskReporterFactory : public SubtaskReporterFactory {
+public:
+    MOCK_METHOD2(create, SubtaskReporter*(Verifier*, SubtaskReporterLogger*));
+};
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/reporter/SubtaskReporterLogger.hpp"
+
+namespace tcframe {
+
+class MockSubtaskReporterLogger : public SubtaskReporterLogger {
+public:
+    MockSubtaskReporterLogger()
+            : SubtaskReporterLogger(nullptr) {}
+
+    MOCK_METHOD0(logIntroduction, void());
+    MOCK_METHOD2(logTestCaseFailure, void(const string&, const string&));
+    MOCK_METHOD1(logSuggestions, void(const vector<SubtaskAssignmentSuggestion>&));
+    MOCK_METHOD1(logReportWritten, void(const string&));
+};
+
+}
@@ -0,0 +1,54 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/reporter/SubtaskReportWriter.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::ostringstream;
+
+namespace tcframe {
+
+class SubtaskReportWriterTests : public Test {
+protected:
+    SubtaskReport report = SubtaskReport(
+            {1, 2},
+            {
+                    SubtaskReportRow("foo_1_1", 1, {1, 2}, {true, true}, ""),
+                    SubtaskReportRow("foo_1_2", 1, {1, 2}, {true, false}, ""),
+                    SubtaskReportRow("foo_2_1", 2, {2}, {false, false}, "Expected: \"N\", got: <EOF>")},
+            {
+                    SubtaskAssignmentSuggestion("TestGroup1", {1, 2}, {1}, {2}),
+                    SubtaskAssignmentSuggestion("TestGroup2", {2}, {}, {})});
+
+    ostringstream out;
+};
+
+TEST_F(SubtaskReportWriterTests, Csv) {
+    SubtaskReportWriter::writeCsv(report, &out);
+
+    EXPECT_THAT(out.str(), Eq(
+            "testCase,group,assigned,subtask1,subtask2,error\n"
+            "foo_1_1,1,1 2,1,1,\n"
+            "foo_1_2,1,1 2,1,0,\n"
+            "foo_2_1,2,2,0,0,\"Expected: \"\"N\"\", got: <EOF>\"\n"));
+}
+
+TEST_F(SubtaskReportWriterTests, Json) {
+    SubtaskReportWriter::writeJson(report, &out);
+
+    EXPECT_THAT(out.str(), Eq(
+            "{\"subtasks\":[1,2],\"testCases\":["
+            "{\"id\":\"foo_1_1\",\"group\":1,\"assigned\":[1,2],\"satisfied\":[1,2]},"
+            "{\"id\":\"foo_1_2\",\"group\":1,\"assigned\":[1,2],\"satisfied\":[1]},"
+            "{\"id\":\"foo_2_1\",\"group\":2,\"assigned\":[2],\"satisfied\":[],"
+            "\"error\":\"Expected: \\\"N\\\", got: <EOF>\"}"
+            "],\"suggestions\":["
+            "{\"target\":\"TestGroup1\",\"assigned\":[1,2],\"suggested\":[1],\"conflicting\":[2]},"
+            "{\"target\":\"TestGroup2\",\"assigned\":[2],\"suggested\":[],\"conflicting\":[]}"
+            "]}\n"));
+}
+
+}
@@ -0,0 +1,42 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include "../logger/MockLoggerEngine.hpp"
+#include "tcframe/reporter/SubtaskReporterLogger.hpp"
+
+using ::testing::InSequence;
+using ::testing::Test;
+
+namespace tcframe {
+
+class SubtaskReporterLoggerTests : public Test {
+protected:
+    Mock(LoggerEngine) engine;
+
+    SubtaskReporterLogger logger = SubtaskReporterLogger(&engine);
+};
+
+TEST_F(SubtaskReporterLoggerTests, TestCaseFailure) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(1, "foo_1_1: FAILED"));
+        EXPECT_CALL(engine, logListItem1(2, "Cannot apply"));
+    }
+    logger.logTestCaseFailure("foo_1_1", "Cannot apply");
+}
+
+TEST_F(SubtaskReporterLoggerTests, Suggestions) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logHeading("SUGGESTED SUBTASK ASSIGNMENTS"));
+        EXPECT_CALL(engine, logParagraph(1, "foo_sample_1: {1, 2}"));
+        EXPECT_CALL(engine, logParagraph(1, "TestGroup1: {1} (currently {1, 2})"));
+        EXPECT_CALL(engine, logListItem1(2, "Only some test cases satisfy subtask 2"));
+        EXPECT_CALL(engine, logListItem1(2, "Only some test cases satisfy subtask 3"));
+    }
+    logger.logSuggestions({
+            SubtaskAssignmentSuggestion("foo_sample_1", {1, 2}, {1, 2}, {}),
+            SubtaskAssignmentSuggestion("TestGroup1", {1, 2}, {1}, {2, 3})});
+}
+
+}
@@ -0,0 +1,87 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include "../verifier/MockVerifier.hpp"
+#include "MockSubtaskReporterLogger.hpp"
+#include "tcframe/reporter/SubtaskReporter.hpp"
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::Test;
+
+namespace tcframe {
+
+int appliedCase;
+
+class SubtaskReporterTests : public Test {
+protected:
+    Mock(Verifier) verifier;
+    Mock(SubtaskReporterLogger) logger;
+
+    TestSuite testSuite = TestSuite({
+            TestGroup(0, {
+                    TestCaseBuilder().setId("foo_sample_1").setSubtaskIds({1, 2}).setApplier([]{appliedCase = 0;}).build()}),
+            TestGroup(1, {
+                    TestCaseBuilder().setId("foo_1_1").setSubtaskIds({1}).setApplier([]{appliedCase = 1;}).build(),
+                    TestCaseBuilder().setId("foo_1_2").setSubtaskIds({1}).setApplier([]{appliedCase = 2;}).build()}),
+            TestGroup(2, {
+                    TestCaseBuilder().setId("foo_2_1").setSubtaskIds({2}).setApplier([]{appliedCase = 3;}).build(),
+                    TestCaseBuilder().setId("foo_2_2").setSubtaskIds({2}).setApplier([]{
+                        throw runtime_error("Cannot apply");
+                    }).build()})});
+
+    SubtaskReporter reporter = SubtaskReporter(&verifier, &logger);
+
+    void SetUp() {
+        ON_CALL(verifier, subtaskIds()).WillByDefault(Return(set<int>{1, 2, 3}));
+        ON_CALL(verifier, satisfiedSubtaskIds()).WillByDefault(Invoke([] () -> set<int> {
+            switch (appliedCase) {
+                case 0: return set<int>{1, 2, 3};
+                case 1: return set<int>{1, 2};
+                case 2: return set<int>{1, 3};
+                default: return set<int>{2};
+            }
+        }));
+    }
+};
+
+TEST_F(SubtaskReporterTests, Report) {
+    vector<SubtaskAssignmentSuggestion> expectedSuggestions = {
+            SubtaskAssignmentSuggestion("foo_sample_1", {1, 2}, {1, 2, 3}, {}),
+            SubtaskAssignmentSuggestion("TestGroup1", {1}, {1}, {2, 3}),
+            SubtaskAssignmentSuggestion("TestGroup2", {2}, {2}, {})};
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction());
+        EXPECT_CALL(logger, logTestCaseFailure("foo_2_2", "Cannot apply"));
+        EXPECT_CALL(logger, logSuggestions(expectedSuggestions));
+    }
+
+    SubtaskReport report = reporter.report(testSuite);
+
+    EXPECT_THAT(report.subtaskIds(), ElementsAre(1, 2, 3));
+    EXPECT_THAT(report.rows(), ElementsAre(
+            SubtaskReportRow("foo_sample_1", 0, {1, 2}, {true, true, true}, ""),
+            SubtaskReportRow("foo_1_1", 1, {1}, {true, true, false}, ""),
+            SubtaskReportRow("foo_1_2", 1, {1}, {true, false, true}, ""),
+            SubtaskReportRow("foo_2_1", 2, {2}, {false, true, false}, ""),
+            SubtaskReportRow("foo_2_2", 2, {2}, {false, false, false}, "Cannot apply")));
+    EXPECT_THAT(report.suggestions(), Eq(expectedSuggestions));
+}
+
+TEST_F(SubtaskReporterTests, Report_WithoutTestGroups) {
+    ON_CALL(verifier, subtaskIds()).WillByDefault(Return(set<int>{-1}));
+    ON_CALL(verifier, satisfiedSubtaskIds()).WillByDefault(Return(set<int>{-1}));
+
+    SubtaskReport report = reporter.report(TestSuite({
+            TestGroup(-1, {TestCaseBuilder().setId("foo_1").setSubtaskIds({-1}).setApplier([]{}).build()})}));
+
+    EXPECT_THAT(report.suggestions(), ElementsAre(
+            SubtaskAssignmentSuggestion("TestCases", {-1}, {-1}, {})));
+}
+
+}
@@ -2,6 +2,7 @@
 
 #include "tcframe/runner/ArgsParser.hpp"
 
+using ::testing::ElementsAre;
 using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
@@ -16,7 +17,22 @@ TEST_F(ArgsParserTests, Parsing_AllOptions) {
             (char*) "--slug=foo",
             (char*) "--solution=python Sol.py",
             (char*) "--tc-dir=my/testdata",
-            (char*) "--seed=42"};
+            (char*) "--seed=42",
+            (char*) "--json-log=log.ndjson",
+            (char*) "--profile-constraints",
+            (char*) "--jobs=4",
+            (char*) "--no-output",
+            (char*) "--dry-run",
+            (char*) "--groups=0,7",
+            (char*) "--cases=foo_1_1,foo_2_3",
+            (char*) "--shard=2/4",
+            (char*) "--durations=durations.profile",
+            (char*) "--snapshot-dir=snapshots",
+            (char*) "--from-snapshots",
+            (char*) "--fail-on-duplicates",
+            (char*) "--near-duplicates=90",
+            (char*) "--resume",
+            (char*) "--trace=trace.json"};
     int argc = sizeof(argv) / sizeof(char*);
 
     Args args = ArgsParser::parse(argc, argv);
@@ -24,6 +40,22 @@ TEST_F(ArgsParserTests, Parsing_AllOptions) {
     EXPECT_THAT(args.solution(), Eq(optional<string>("python Sol.py")));
     EXPECT_THAT(args.tcDir(), Eq(optional<string>("my/testdata")));
     EXPECT_THAT(args.seed(), Eq(optional<unsigned>(42)));
+    EXPECT_THAT(args.jsonLog(), Eq(optional<string>("log.ndjson")));
+    EXPECT_TRUE(args.profileConstraints());
+    EXPECT_THAT(args.jobs(), Eq(optional<int>(4)));
+    EXPECT_TRUE(args.noOutput());
+    EXPECT_TRUE(args.dryRun());
+    EXPECT_THAT(args.groups(), Eq(optional<set<int>>({0, 7})));
+    EXPECT_THAT(args.cases(), Eq(optional<set<string>>({"foo_1_1", "foo_2_3"})));
+    EXPECT_THAT(args.shard(), Eq(optional<pair<int, int>>(make_pair(2, 4))));
+    EXPECT_THAT(args.durations(), Eq(optional<string>("durations.profile")));
+    EXPECT_THAT(args.snapshotDir(), Eq(optional<string>("snapshots")));
+    EXPECT_TRUE(args.fromSnapshots());
+    EXPECT_TRUE(args.failOnDuplicates());
+    EXPECT_THAT(args.nearDuplicates(), Eq(optional<int>(90)));
+    EXPECT_TRUE(args.resume());
+    EXPECT_THAT(args.trace(), Eq(optional<string>("trace.json")));
+    EXPECT_THAT(args.command(), Eq(Args::Command::GEN));
 }
 
 TEST_F(ArgsParserTests, Parsing_SomeOptions) {
@@ -39,6 +71,213 @@ TEST_F(ArgsParserTests, Parsing_SomeOptions) {
     EXPECT_THAT(args.solution(), Eq(optional<string>()));
     EXPECT_THAT(args.tcDir(), Eq(optional<string>("my/testdata")));
     EXPECT_THAT(args.seed(), Eq(optional<unsigned>(42)));
+    EXPECT_THAT(args.jsonLog(), Eq(optional<string>()));
+    EXPECT_FALSE(args.profileConstraints());
+    EXPECT_THAT(args.jobs(), Eq(optional<int>()));
+    EXPECT_FALSE(args.noOutput());
+    EXPECT_FALSE(args.dryRun());
+    EXPECT_THAT(args.groups(), Eq(optional<set<int>>()));
+    EXPECT_THAT(args.cases(), Eq(optional<set<string>>()));
+    EXPECT_THAT(args.shard(), Eq(optional<pair<int, int>>()));
+    EXPECT_THAT(args.durations(), Eq(optional<string>()));
+    EXPECT_THAT(args.snapshotDir(), Eq(optional<string>()));
+    EXPECT_FALSE(args.fromSnapshots());
+    EXPECT_THAT(args.alternativeSolutions(), ElementsAre());
+}
+
+TEST_F(ArgsParserTests, Parsing_MultipleSolutions) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--solution=python Sol.py",
+            (char*) "--solution=./alt1",
+            (char*) "--solution=./alt2"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    Args args = ArgsParser::parse(argc, argv);
+    EXPECT_THAT(args.solution(), Eq(optional<string>("python Sol.py")));
+    EXPECT_THAT(args.alternativeSolutions(), ElementsAre("./alt1", "./alt2"));
+}
+
+TEST_F(ArgsParserTests, Parsing_StressCommand) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "stress",
+            (char*) "--solution=./sol",
+            (char*) "--solution=./brute",
+            (char*) "--iterations=500",
+            (char*) "foo_1_2"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    Args args = ArgsParser::parse(argc, argv);
+    EXPECT_THAT(args.command(), Eq(Args::Command::STRESS));
+    EXPECT_THAT(args.iterations(), Eq(optional<int>(500)));
+    EXPECT_THAT(args.operands(), ElementsAre("foo_1_2"));
+}
+
+TEST_F(ArgsParserTests, Parsing_StressCommandWithoutAlternativeSolution) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "stress",
+            (char*) "--solution=./sol",
+            (char*) "foo_1_2"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: command stress requires at least two --solution options"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_Command) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "validate",
+            (char*) "--tc-dir=my/testdata"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    Args args = ArgsParser::parse(argc, argv);
+    EXPECT_THAT(args.command(), Eq(Args::Command::VALIDATE));
+    EXPECT_THAT(args.tcDir(), Eq(optional<string>("my/testdata")));
+}
+
+TEST_F(ArgsParserTests, Parsing_ReportCommand) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "report",
+            (char*) "--report=subtasks.json"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    Args args = ArgsParser::parse(argc, argv);
+    EXPECT_THAT(args.command(), Eq(Args::Command::REPORT));
+    EXPECT_THAT(args.report(), Eq(optional<string>("subtasks.json")));
+}
+
+TEST_F(ArgsParserTests, Parsing_DiffCommand) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "diff",
+            (char*) "old.manifest",
+            (char*) "tc/files.manifest"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    Args args = ArgsParser::parse(argc, argv);
+    EXPECT_THAT(args.command(), Eq(Args::Command::DIFF));
+    EXPECT_THAT(args.operands(), ElementsAre("old.manifest", "tc/files.manifest"));
+}
+
+TEST_F(ArgsParserTests, Parsing_DiffCommand_MissingOperand) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "diff",
+            (char*) "old.manifest"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: command diff requires two file manifests"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_InvalidCommand) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "blah"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: command blah unknown"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_InvalidJobs) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--jobs=0"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --jobs requires a positive number"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_InvalidGroups) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--groups=1,x"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --groups requires a comma-separated list of test group numbers"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_InvalidShard) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--shard=5/4"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --shard requires i/n, with 1 <= i <= n"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_DurationsWithoutShard) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--durations=durations.profile"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --durations requires --shard"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_InvalidNearDuplicates) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--near-duplicates=101"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --near-duplicates requires a percentage from 1 to 100"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_FromSnapshotsWithoutSnapshotDir) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--from-snapshots"};
+    int argc = sizeof(argv) / sizeof(char*);
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --from-snapshots requires --snapshot-dir"));
+    }
 }
 
 TEST_F(ArgsParserTests, Parsing_MissingOptionArgument) {
@@ -12,6 +12,8 @@ public:
             : RunnerLogger(nullptr) {}
 
     MOCK_METHOD1(logSpecificationFailure, void(const vector<string>&));
+    MOCK_METHOD1(logFileManifestDiff, void(const FileManifestDiff&));
+    MOCK_METHOD1(logFileManifestFailure, void(const string&));
 };
 
 }
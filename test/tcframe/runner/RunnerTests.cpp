@@ -3,14 +3,20 @@
 
 #include "../generator/MockGenerator.hpp"
 #include "../os/MockOperatingSystem.hpp"
+#include "../reporter/MockSubtaskReporter.hpp"
+#include "../stresser/MockStresser.hpp"
+#include "../validator/MockValidator.hpp"
 #include "MockRunnerLogger.hpp"
 #include "MockRunnerLoggerFactory.hpp"
 #include "tcframe/experimental/runner.hpp"
 
 using ::testing::_;
+using ::testing::ElementsAre;
 using ::testing::Eq;
+using ::testing::HasSubstr;
 using ::testing::Ne;
 using ::testing::Return;
+using ::testing::SaveArg;
 using ::testing::Test;
 
 namespace tcframe {
@@ -47,14 +53,26 @@ protected:
 
     Mock(RunnerLogger) logger;
     Mock(Generator) generator;
+    Mock(Validator) validator;
+    Mock(SubtaskReporter) subtaskReporter;
+    Mock(Stresser) stresser;
 
     Mock(OperatingSystem) os;
     Mock(RunnerLoggerFactory) loggerFactory;
     Mock(GeneratorFactory) generatorFactory;
+    Mock(ValidatorFactory) validatorFactory;
+    Mock(SubtaskReporterFactory) subtaskReporterFactory;
+    Mock(StresserFactory) stresserFactory;
+
+    ostringstream reportOut;
 
     void SetUp() {
         ON_CALL(loggerFactory, create(_)).WillByDefault(Return(&logger));
         ON_CALL(generatorFactory, create(_, _, _, _)).WillByDefault(Return(&generator));
+        ON_CALL(validatorFactory, create(_, _, _, _)).WillByDefault(Return(&validator));
+        ON_CALL(subtaskReporterFactory, create(_, _)).WillByDefault(Return(&subtaskReporter));
+        ON_CALL(stresserFactory, create(_, _, _, _, _, _)).WillByDefault(Return(&stresser));
+        ON_CALL(subtaskReporter, report(_)).WillByDefault(Return(SubtaskReport({-1}, {}, {})));
     }
 };
 
@@ -85,6 +103,29 @@ TEST_F(RunnerTests, Run_Generation_Failed) {
     EXPECT_THAT(runner.run(argc, argv), Ne(0));
 }
 
+TEST_F(RunnerTests, Run_Generation_Traced) {
+    Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
+    ostringstream trace;
+    ON_CALL(os, openForWriting("trace.json"))
+            .WillByDefault(Return(&trace));
+    EXPECT_CALL(os, closeOpenedWritingStream(&trace));
+
+    runner.run(2, new char*[2]{(char*) "./runner", (char*) "--trace=trace.json"});
+    EXPECT_THAT(trace.str(), HasSubstr("\"name\":\"buildCoreSpec\",\"cat\":\"spec\""));
+    EXPECT_THAT(trace.str(), HasSubstr("\"name\":\"buildRawTestSuite\",\"cat\":\"spec\""));
+    EXPECT_THAT(trace.str(), HasSubstr("\"name\":\"provideTestSuite\",\"cat\":\"spec\""));
+}
+
+TEST_F(RunnerTests, Run_Generation_JsonLog) {
+    Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
+    ostringstream jsonLog;
+    ON_CALL(os, openForWriting("log.ndjson"))
+            .WillByDefault(Return(&jsonLog));
+    EXPECT_CALL(os, closeOpenedWritingStream(&jsonLog));
+
+    runner.run(2, new char*[2]{(char*) "./runner", (char*) "--json-log=log.ndjson"});
+}
+
 TEST_F(RunnerTests, Run_Generation_UseDefaultOptions) {
     Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
     EXPECT_CALL(generator, generate(_, GeneratorConfigBuilder()
@@ -118,14 +159,157 @@ TEST_F(RunnerTests, Run_Generation_UseArgsOptions) {
             .setSlug("bar")
             .setSolutionCommand("\"java Solution\"")
             .setTestCasesDir("testdata")
+            .setNoOutput(true)
+            .setFailOnDuplicates(true)
+            .setNearDuplicateSimilarity(95)
+            .setResume(true)
             .build()));
 
-    runner.run(5, new char*[5]{
+    runner.run(9, new char*[9]{
             (char*) "./runner",
             (char*) "--seed=42",
             (char*) "--slug=bar",
             (char*) "--solution=\"java Solution\"",
-            (char*) "--tc-dir=testdata"});
+            (char*) "--tc-dir=testdata",
+            (char*) "--no-output",
+            (char*) "--fail-on-duplicates",
+            (char*) "--near-duplicates=95",
+            (char*) "--resume"});
+}
+
+TEST_F(RunnerTests, Run_Validation) {
+    Runner<ProblemSpecWithConfig> runner(
+            new TestSpecWithConfig(), loggerEngine, &os, &loggerFactory, &generatorFactory, &validatorFactory);
+    EXPECT_CALL(generator, generate(_, _)).Times(0);
+    EXPECT_CALL(validator, validate(_, ValidatorConfigBuilder()
+            .setSlug("foo")
+            .setTestCasesDir("testdata")
+            .setJobsCount(3)
+            .build()))
+            .WillOnce(Return(true));
+
+    EXPECT_THAT(runner.run(4, new char*[4]{
+            (char*) "./runner",
+            (char*) "validate",
+            (char*) "--tc-dir=testdata",
+            (char*) "--jobs=3"}), Eq(0));
+}
+
+TEST_F(RunnerTests, Run_Generation_Sharded) {
+    Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
+    EXPECT_CALL(generator, generate(_, GeneratorConfigBuilder()
+            .setShard(2, 3)
+            .build()));
+
+    runner.run(2, new char*[2]{(char*) "./runner", (char*) "--shard=2/3"});
+}
+
+TEST_F(RunnerTests, Run_Generation_Sharded_Durations) {
+    Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
+    EXPECT_CALL(generator, generate(_, GeneratorConfigBuilder()
+            .setShard(2, 3)
+            .setDurationsFilename("durations.profile")
+            .build()));
+
+    runner.run(3, new char*[3]{(char*) "./runner", (char*) "--shard=2/3", (char*) "--durations=durations.profile"});
+}
+
+TEST_F(RunnerTests, Run_Merge) {
+    Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
+    EXPECT_CALL(generator, generate(_, _)).Times(0);
+    EXPECT_CALL(generator, merge(_, GeneratorConfigBuilder().build()))
+            .WillOnce(Return(true));
+
+    EXPECT_THAT(runner.run(2, new char*[2]{(char*) "./runner", (char*) "merge"}), Eq(0));
+}
+
+TEST_F(RunnerTests, Run_Diff) {
+    Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
+    ON_CALL(os, openForReading("old.manifest"))
+            .WillByDefault(Return(new istringstream("0000000000000001 1 foo_1.in\n")));
+    ON_CALL(os, openForReading("new.manifest"))
+            .WillByDefault(Return(new istringstream("0000000000000002 1 foo_1.in\n")));
+    FileManifestDiff diff = FileManifestDiff(FileManifest(), FileManifest());
+    EXPECT_CALL(generator, generate(_, _)).Times(0);
+    EXPECT_CALL(logger, logFileManifestDiff(_))
+            .WillOnce(SaveArg<0>(&diff));
+
+    EXPECT_THAT(runner.run(4, new char*[4]{
+            (char*) "./runner",
+            (char*) "diff",
+            (char*) "old.manifest",
+            (char*) "new.manifest"}), Eq(0));
+    EXPECT_THAT(diff.changedFilenames(), ElementsAre("foo_1.in"));
+}
+
+TEST_F(RunnerTests, Run_Diff_Failed) {
+    Runner<ProblemSpec> runner(new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory);
+    EXPECT_CALL(logger, logFileManifestFailure("Cannot read file manifest old.manifest"));
+
+    EXPECT_THAT(runner.run(4, new char*[4]{
+            (char*) "./runner",
+            (char*) "diff",
+            (char*) "old.manifest",
+            (char*) "new.manifest"}), Ne(0));
+}
+
+TEST_F(RunnerTests, Run_Stress) {
+    Runner<ProblemSpec> runner(
+            new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory, &validatorFactory,
+            &subtaskReporterFactory, &stresserFactory);
+    EXPECT_CALL(generator, generate(_, _)).Times(0);
+    EXPECT_CALL(stresser, stress(_, StresserConfigBuilder()
+            .setTestCaseId("problem_3")
+            .setSeed(7)
+            .setSolutionCommand("./sol")
+            .setAlternativeSolutionCommands({"./brute"})
+            .setIterationsCount(500)
+            .setJobsCount(2)
+            .build()))
+            .WillOnce(Return(false));
+
+    EXPECT_THAT(runner.run(8, new char*[8]{
+            (char*) "./runner",
+            (char*) "stress",
+            (char*) "--solution=./sol",
+            (char*) "--solution=./brute",
+            (char*) "--seed=7",
+            (char*) "--iterations=500",
+            (char*) "--jobs=2",
+            (char*) "problem_3"}), Ne(0));
+}
+
+TEST_F(RunnerTests, Run_Report) {
+    Runner<ProblemSpec> runner(
+            new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory, &validatorFactory,
+            &subtaskReporterFactory);
+    ON_CALL(subtaskReporter, report(_)).WillByDefault(Return(SubtaskReport(
+            {-1},
+            {SubtaskReportRow("problem_1", -1, {-1}, {true}, "")},
+            {SubtaskAssignmentSuggestion("TestCases", {-1}, {-1}, {})})));
+    EXPECT_CALL(generator, generate(_, _)).Times(0);
+    EXPECT_CALL(os, openForWriting("subtasks.csv")).WillOnce(Return(&reportOut));
+    EXPECT_CALL(os, closeOpenedWritingStream(&reportOut));
+
+    EXPECT_THAT(runner.run(2, new char*[2]{(char*) "./runner", (char*) "report"}), Eq(0));
+    EXPECT_THAT(reportOut.str(), Eq("testCase,group,assigned,constraints,error\nproblem_1,-1,-1,1,\n"));
+}
+
+TEST_F(RunnerTests, Run_Report_Failed) {
+    Runner<ProblemSpec> runner(
+            new TestSpec(), loggerEngine, &os, &loggerFactory, &generatorFactory, &validatorFactory,
+            &subtaskReporterFactory);
+    ON_CALL(subtaskReporter, report(_)).WillByDefault(Return(SubtaskReport(
+            {-1},
+            {SubtaskReportRow("problem_1", -1, {-1}, {false}, "Cannot apply")},
+            {})));
+    ON_CALL(os, openForWriting("out.json")).WillByDefault(Return(&reportOut));
+
+    EXPECT_THAT(runner.run(3, new char*[3]{
+            (char*) "./runner",
+            (char*) "report",
+            (char*) "--report=out.json"}), Ne(0));
+    EXPECT_THAT(reportOut.str()[0], Eq('{'));
 }
 
 }
@@ -0,0 +1,157 @@
+#include "gmock/gmock.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tcframe/spec/constraint/BulkConstraints.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::string;
+using std::thread;
+using std::vector;
+
+namespace tcframe {
+
+class BulkConstraintsTests : public Test {
+protected:
+    void SetUp() {
+        ConstraintViolation::take();
+    }
+
+    static vector<int> range(int size) {
+        vector<int> v(size);
+        for (int i = 0; i < size; i++) {
+            v[i] = i;
+        }
+        return v;
+    }
+};
+
+TEST_F(BulkConstraintsTests, EachElementBetween) {
+    vector<int> v = range(1000);
+    EXPECT_TRUE(eachElementBetween(v, 0, 999));
+    EXPECT_THAT(ConstraintViolation::take(), Eq(""));
+
+    EXPECT_FALSE(eachElementBetween(v, 0, 700));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 701"));
+
+    EXPECT_TRUE(eachElementBetween(vector<long long>{1, 1000000000000LL}, 1, 1000000000000LL));
+    EXPECT_TRUE(eachElementBetween(vector<int>(), 1, 2));
+}
+
+TEST_F(BulkConstraintsTests, EachElementBetween_Matrix) {
+    vector<vector<int>> m = {{1, 2, 3}, {4, 5, 6}};
+    EXPECT_TRUE(eachElementBetween(m, 1, 6));
+
+    EXPECT_FALSE(eachElementBetween(m, 1, 4));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at row 1, column 1"));
+}
+
+TEST_F(BulkConstraintsTests, IsSorted) {
+    vector<int> v = range(1000);
+    v.push_back(999);
+    EXPECT_TRUE(isSorted(v));
+    EXPECT_TRUE(isSorted(vector<int>()));
+
+    v.push_back(998);
+    EXPECT_FALSE(isSorted(v));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 1001"));
+}
+
+TEST_F(BulkConstraintsTests, EachElementBetween_Streamed) {
+    StreamedVector<int> v(10000, [] (long long i) {return (int) i;});
+    EXPECT_TRUE(eachElementBetween(v, 0, 9999));
+    EXPECT_THAT(ConstraintViolation::take(), Eq(""));
+
+    EXPECT_FALSE(eachElementBetween(v, 0, 5000));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 5001"));
+
+    EXPECT_TRUE(eachElementBetween(StreamedVector<int>(), 1, 2));
+}
+
+TEST_F(BulkConstraintsTests, IsSorted_Streamed) {
+    EXPECT_TRUE(isSorted(StreamedVector<int>(10000, [] (long long i) {return (int) (i / 3);})));
+
+    EXPECT_FALSE(isSorted(StreamedVector<int>(10000, [] (long long i) {return i == 4096 ? 0 : (int) i;})));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 4096"));
+
+    EXPECT_FALSE(isSorted(StreamedVector<int>(10000, [] (long long i) {return i == 4097 ? 0 : (int) i;})));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 4097"));
+}
+
+TEST_F(BulkConstraintsTests, IsStrictlySorted) {
+    vector<int> v = range(1000);
+    EXPECT_TRUE(isStrictlySorted(v));
+
+    v.push_back(999);
+    EXPECT_FALSE(isStrictlySorted(v));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 1000"));
+}
+
+TEST_F(BulkConstraintsTests, EachElementDistinct_Dense) {
+    vector<int> v = range(1000);
+    EXPECT_TRUE(eachElementDistinct(v));
+
+    v[500] = 3;
+    EXPECT_FALSE(eachElementDistinct(v));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 500"));
+}
+
+TEST_F(BulkConstraintsTests, EachElementDistinct_Sparse) {
+    vector<long long> v = {-1000000000000LL, 5, 1000000000000LL};
+    EXPECT_TRUE(eachElementDistinct(v));
+
+    v.push_back(5);
+    EXPECT_FALSE(eachElementDistinct(v));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 3"));
+}
+
+TEST_F(BulkConstraintsTests, EachElementDistinct_NonIntegral) {
+    EXPECT_TRUE(eachElementDistinct(vector<string>{"a", "b"}));
+
+    EXPECT_FALSE(eachElementDistinct(vector<string>{"a", "b", "a"}));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 2"));
+}
+
+TEST_F(BulkConstraintsTests, EachRowHasSize) {
+    vector<vector<int>> m = {{1, 2}, {3, 4}, {5}};
+    EXPECT_FALSE(eachRowHasSize(m, 2));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 2"));
+
+    EXPECT_FALSE(eachRowHasSameSize(m));
+    m[2].push_back(6);
+    EXPECT_TRUE(eachRowHasSameSize(m));
+    EXPECT_TRUE(eachRowHasSameSize(vector<vector<int>>()));
+}
+
+TEST_F(BulkConstraintsTests, EachCharIn) {
+    vector<vector<char>> grid = {{'.', '#'}, {'#', '.'}};
+    EXPECT_TRUE(eachCharIn(grid, ".#"));
+
+    grid[1][1] = 'x';
+    EXPECT_FALSE(eachCharIn(grid, ".#"));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at row 1, column 1"));
+
+    EXPECT_TRUE(eachCharIn(string("abba"), "ab"));
+    EXPECT_FALSE(eachCharIn(string("abca"), "ab"));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 2"));
+}
+
+TEST_F(BulkConstraintsTests, Violation_FirstReportKept) {
+    EXPECT_FALSE(eachElementBetween(vector<int>{1, 5}, 1, 2) || eachElementBetween(vector<int>{1, 2, 5}, 1, 2));
+    EXPECT_THAT(ConstraintViolation::take(), Eq("first violation at index 1"));
+    EXPECT_THAT(ConstraintViolation::take(), Eq(""));
+}
+
+TEST_F(BulkConstraintsTests, Violation_PerThread) {
+    thread worker([] {
+        eachElementBetween(vector<int>{1, 5}, 1, 2);
+    });
+    worker.join();
+    EXPECT_THAT(ConstraintViolation::take(), Eq(""));
+}
+
+}
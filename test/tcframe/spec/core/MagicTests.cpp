@@ -1,5 +1,7 @@
 #include "gmock/gmock.h"
 
+#include <sstream>
+
 #include "../variable/FakeVariable.hpp"
 #include "tcframe/experimental/runner.hpp"
 
@@ -7,6 +9,9 @@ using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
+using std::istringstream;
+using std::ostringstream;
+
 namespace tcframe {
 
 class MagicTests : public Test {
@@ -62,6 +67,7 @@ protected:
     protected:
         int A, B;
         vector<int> C, D;
+        StreamedVector<int> E;
 
         vector<vector<int>> bogus;
 
@@ -70,6 +76,7 @@ protected:
             LINE(A);
             LINE(A, B);
             LINE(A, B, C % SIZE(3), D);
+            LINE(A, E);
         }
 
         void testInvalid() {
@@ -96,6 +103,27 @@ protected:
         }
     };
 
+    class TYPED_FORMAT_Tester : public IOFormatBuilder {
+    public:
+        int A, B;
+        vector<int> C, D;
+        vector<int> X;
+        vector<vector<int>> Z;
+        vector<vector<char>> M;
+
+        void testValid() {
+            TYPED_FORMAT(
+                    TYPED_LINE(A, B, C % SIZE(2), D),
+                    TYPED_LINES(X, Z) % SIZE(2),
+                    TYPED_GRID(M) % SIZE(2, 3));
+        }
+
+        void testMixed() {
+            LINE(A);
+            TYPED_FORMAT(TYPED_LINE(B));
+        }
+    };
+
     class GRID_Tester : public IOFormatBuilder {
     protected:
         vector<vector<int>> M;
@@ -111,6 +139,27 @@ protected:
             GRID(bogus);
         }
     };
+
+    class EDGES_Tester : public IOFormatBuilder {
+    protected:
+        int N, M;
+        vector<int> U, V;
+        vector<long long> W;
+
+        vector<string> bogus;
+
+    public:
+        void testValid() {
+            N = 5;
+            M = 4;
+            EDGES(U, V) % SIZE(M);
+            EDGES(U, V, W) % SIZE(M) % VERTICES(1, N) % NO_SELF_LOOPS % NO_MULTI_EDGES;
+        }
+
+        void testInvalid() {
+            EDGES(W, U, V) % SIZE(M);
+        }
+    };
 };
 
 TEST_F(MagicTests, VariableNamesExtractor) {
@@ -185,6 +234,9 @@ TEST_F(MagicTests, LINE_Valid) {
             .addScalarVariable(Scalar::create(dummy, "B"))
             .addVectorVariable(Vector::create(dummy2, "C"), 3)
             .addVectorVariable(Vector::create(dummy2, "D"));
+    builder.newLineIOSegment()
+            .addScalarVariable(Scalar::create(dummy, "A"))
+            .addVectorVariable(Vector::create(dummy2, "E"));
 
     EXPECT_THAT(ioFormat, Eq(builder.build()));
 }
@@ -270,4 +322,80 @@ TEST_F(MagicTests, GRID_Invalid) {
     }
 }
 
+TEST_F(MagicTests, EDGES_Valid) {
+    EDGES_Tester tester;
+    tester.prepareForInputFormat();
+    tester.testValid();
+    IOFormat ioFormat = tester.build();
+
+    vector<int> dummy;
+    vector<long long> dummy2;
+    IOFormatBuilder builder;
+    builder.prepareForInputFormat();
+    builder.newEdgesIOSegment()
+            .addVertexVariable(new VectorImpl<int>(dummy, "U"))
+            .addVertexVariable(new VectorImpl<int>(dummy, "V"))
+            .setSize(4);
+    builder.newEdgesIOSegment()
+            .addVertexVariable(new VectorImpl<int>(dummy, "U"))
+            .addVertexVariable(new VectorImpl<int>(dummy, "V"))
+            .setWeightVariable(Vector::create(dummy2, "W"))
+            .setSize(4)
+            .setVertexRange(1, 5)
+            .setNoSelfLoops()
+            .setNoMultiEdges();
+
+    EXPECT_THAT(ioFormat, Eq(builder.build()));
+}
+
+TEST_F(MagicTests, EDGES_Invalid) {
+    EDGES_Tester tester;
+    tester.prepareForInputFormat();
+
+    try {
+        tester.testInvalid();
+        tester.build();
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Edges segment must start with two vertex variables of type vector<int>"));
+    }
+}
+
+TEST_F(MagicTests, TYPED_FORMAT_Valid) {
+    TYPED_FORMAT_Tester tester;
+    tester.prepareForInputFormat();
+    tester.testValid();
+    IOFormat ioFormat = tester.build();
+
+    EXPECT_TRUE(ioFormat.inputFormat().empty());
+    ASSERT_TRUE(ioFormat.typedInputFormat() != nullptr);
+
+    istringstream in("1 2 3 4 5 6\n7\n8 9 10\nabc\ndef\n");
+    ioFormat.typedInputFormat()->parse(&in);
+    EXPECT_THAT(tester.A, Eq(1));
+    EXPECT_THAT(tester.B, Eq(2));
+    EXPECT_THAT(tester.C, Eq(vector<int>{3, 4}));
+    EXPECT_THAT(tester.D, Eq(vector<int>{5, 6}));
+    EXPECT_THAT(tester.X, Eq(vector<int>{7, 8}));
+    EXPECT_THAT(tester.Z, Eq(vector<vector<int>>{{}, {9, 10}}));
+    EXPECT_THAT(tester.M, Eq(vector<vector<char>>{{'a', 'b', 'c'}, {'d', 'e', 'f'}}));
+
+    ostringstream out;
+    ioFormat.typedInputFormat()->print(&out);
+    EXPECT_THAT(out.str(), Eq(in.str()));
+}
+
+TEST_F(MagicTests, TYPED_FORMAT_Mixed) {
+    TYPED_FORMAT_Tester tester;
+    tester.prepareForInputFormat();
+
+    try {
+        tester.testMixed();
+        tester.build();
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Typed format cannot be mixed with other segments in the same format"));
+    }
+}
+
 }
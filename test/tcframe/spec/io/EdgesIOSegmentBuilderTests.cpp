@@ -0,0 +1,61 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/io/EdgesIOSegment.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class EdgesIOSegmentBuilderTests : public Test {
+protected:
+    vector<int> U, V;
+    vector<long long> W;
+
+    EdgesIOSegmentBuilder builder;
+};
+
+TEST_F(EdgesIOSegmentBuilderTests, Building_Successful) {
+    EdgesIOSegment* segment = builder
+            .addVertexVariable(new VectorImpl<int>(U, "U"))
+            .addVertexVariable(new VectorImpl<int>(V, "V"))
+            .setWeightVariable(Vector::create(W, "W"))
+            .setSize(3)
+            .setVertexRange(1, 5)
+            .setNoMultiEdges()
+            .build();
+
+    EXPECT_TRUE(segment->from()->equals(Vector::create(U, "U")));
+    EXPECT_TRUE(segment->to()->equals(Vector::create(V, "V")));
+    EXPECT_TRUE(segment->weight()->equals(Vector::create(W, "W")));
+    EXPECT_THAT(segment->size(), Eq(3));
+    EXPECT_THAT(segment->vertexRange(), Eq(optional<pair<int, int>>(make_pair(1, 5))));
+    EXPECT_FALSE(segment->noSelfLoops());
+    EXPECT_TRUE(segment->noMultiEdges());
+}
+
+TEST_F(EdgesIOSegmentBuilderTests, Building_Failed_MissingVertexVariable) {
+    try {
+        builder
+                .addVertexVariable(new VectorImpl<int>(U, "U"))
+                .setWeightVariable(Vector::create(W, "W"));
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Edges segment must start with two vertex variables of type vector<int>"));
+    }
+}
+
+TEST_F(EdgesIOSegmentBuilderTests, Building_Failed_NoSizeDefined) {
+    try {
+        builder
+                .addVertexVariable(new VectorImpl<int>(U, "U"))
+                .addVertexVariable(new VectorImpl<int>(V, "V"))
+                .build();
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Edges segment must define the number of edges"));
+    }
+}
+
+}
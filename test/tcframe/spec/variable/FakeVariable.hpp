@@ -9,6 +9,9 @@ public:
     FakeVariable(const string& name, VariableType type)
             : Variable(name, type) {}
 
+    void snapshotTo(ostream*) {}
+    void restoreFrom(istream*) {}
+
     template<typename T>
     void parseValue(istream* in, T& val, const string& context) {
         Variable::parseValue(in, val, context);
@@ -129,4 +129,33 @@ TEST_F(MatrixTests, Printing_Char) {
     EXPECT_THAT(out.str(), Eq("abc\ndef\n"));
 }
 
+TEST_F(MatrixTests, Snapshot) {
+    m = {{1, 2, 3}, {}, {4}};
+    c = {{'a', 'b'}, {'c', 'd'}};
+    ostringstream out;
+    M->snapshotTo(&out);
+    C->snapshotTo(&out);
+
+    m.clear();
+    c = {{'x'}};
+    istringstream in(out.str());
+    M->restoreFrom(&in);
+    C->restoreFrom(&in);
+    EXPECT_THAT(m, Eq(vector<vector<int>>{{1, 2, 3}, {}, {4}}));
+    EXPECT_THAT(c, Eq(vector<vector<char>>{{'a', 'b'}, {'c', 'd'}}));
+}
+
+TEST_F(MatrixTests, Snapshot_Failed_TypeMismatch) {
+    ostringstream out;
+    C->snapshotTo(&out);
+
+    istringstream in(out.str());
+    try {
+        M->restoreFrom(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Snapshot of 'M' does not match its type"));
+    }
+}
+
 }
@@ -8,6 +8,7 @@ using std::istringstream;
 using std::ostringstream;
 
 using ::testing::Eq;
+using ::testing::StrEq;
 using ::testing::Test;
 
 namespace tcframe {
@@ -15,7 +16,10 @@ namespace tcframe {
 class ScalarTests : public Test {
 protected:
     int a;
+    string s;
+    bool b;
     Scalar* A = Scalar::create(a, "a");
+    Scalar* S = Scalar::create(s, "s");
 };
 
 TEST_F(ScalarTests, Parsing) {
@@ -31,4 +35,54 @@ TEST_F(ScalarTests, Printing) {
     EXPECT_THAT(out.str(), Eq("42"));
 }
 
+TEST_F(ScalarTests, Snapshot) {
+    a = 42;
+    s = "hello world";
+    ostringstream out;
+    b = true;
+    Scalar* B = Scalar::create(b, "b");
+    A->snapshotTo(&out);
+    S->snapshotTo(&out);
+    B->snapshotTo(&out);
+
+    a = 0;
+    s = "";
+    b = false;
+    istringstream in(out.str());
+    A->restoreFrom(&in);
+    S->restoreFrom(&in);
+    B->restoreFrom(&in);
+    EXPECT_THAT(a, Eq(42));
+    EXPECT_THAT(s, Eq("hello world"));
+    EXPECT_TRUE(b);
+}
+
+TEST_F(ScalarTests, Snapshot_Failed_TypeMismatch) {
+    long long b = 42;
+    ostringstream out;
+    Scalar::create(b, "a")->snapshotTo(&out);
+
+    istringstream in(out.str());
+    try {
+        A->restoreFrom(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Snapshot of 'a' does not match its type"));
+    }
+}
+
+TEST_F(ScalarTests, Snapshot_Failed_Truncated) {
+    a = 42;
+    ostringstream out;
+    A->snapshotTo(&out);
+
+    istringstream in(out.str().substr(0, out.str().size() - 1));
+    try {
+        A->restoreFrom(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Snapshot is truncated"));
+    }
+}
+
 }
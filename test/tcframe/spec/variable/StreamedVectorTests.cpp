@@ -0,0 +1,118 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/Vector.hpp"
+
+#include <sstream>
+
+using std::istringstream;
+using std::ostringstream;
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class StreamedVectorTests : public Test {
+protected:
+    StreamedVector<int> v;
+    Vector* V = Vector::create(v, "V");
+};
+
+TEST_F(StreamedVectorTests, Printing) {
+    v = StreamedVector<int>(10000, [] (long long i) {return (int) (i % 7);});
+    ostringstream out;
+    V->printTo(&out);
+
+    ostringstream expected;
+    for (int i = 0; i < 10000; i++) {
+        expected << (i > 0 ? " " : "") << i % 7;
+    }
+    EXPECT_THAT(out.str(), Eq(expected.str()));
+    EXPECT_THAT(V->size(), Eq(10000));
+}
+
+TEST_F(StreamedVectorTests, Printing_Random_SameOnEveryTraversal) {
+    Random rnd;
+    v = StreamedVector<int>(5000, rnd, [] (Random& r) {return r.nextInt(1, 1000000);});
+    ostringstream out1, out2;
+    V->printTo(&out1);
+    V->printTo(&out2);
+
+    EXPECT_THAT(out1.str(), Eq(out2.str()));
+}
+
+TEST_F(StreamedVectorTests, Printing_Elements_Failed) {
+    v = StreamedVector<int>(3, [] (long long i) {return (int) i;});
+    ostringstream out;
+
+    try {
+        V->printElementTo(0, &out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Streamed vector 'V' is only supported in a line segment"));
+    }
+}
+
+TEST_F(StreamedVectorTests, Parsing_Successful) {
+    istringstream in("1 2 3");
+    V->parseFrom(&in, 3);
+
+    EXPECT_THAT(V->size(), Eq(3));
+}
+
+TEST_F(StreamedVectorTests, Parsing_WithoutSize_Successful) {
+    istringstream in("1 2 3 4\n");
+    V->parseFrom(&in);
+
+    EXPECT_THAT(V->size(), Eq(4));
+}
+
+TEST_F(StreamedVectorTests, Parsing_Failed_MissingSpace) {
+    istringstream in("1 2");
+
+    try {
+        V->parseFrom(&in, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'V[1]'"));
+    }
+}
+
+TEST_F(StreamedVectorTests, Parsing_Failed_InvalidElement) {
+    istringstream in("1 x 3\n");
+
+    try {
+        V->parseFrom(&in);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'V[1]'. Found: 'x'"));
+    }
+}
+
+TEST_F(StreamedVectorTests, Printing_Failed_Parsed) {
+    istringstream in("1 2 3\n");
+    V->parseFrom(&in);
+    ostringstream out;
+
+    try {
+        V->printTo(&out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Streamed vector 'V' has no producer"));
+    }
+}
+
+TEST_F(StreamedVectorTests, Snapshot_Failed) {
+    v = StreamedVector<int>(3, [] (long long i) {return (int) i;});
+    ostringstream out;
+
+    try {
+        V->snapshotTo(&out);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Streamed vector 'V' cannot be snapshotted"));
+    }
+}
+
+}
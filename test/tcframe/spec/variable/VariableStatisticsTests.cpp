@@ -0,0 +1,86 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable.hpp"
+
+#include <sstream>
+
+using std::ostringstream;
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class VariableStatisticsTests : public Test {
+protected:
+    VariableStatistics statistics = VariableStatistics("v", VariableType::VECTOR);
+};
+
+TEST_F(VariableStatisticsTests, Empty) {
+    EXPECT_THAT(statistics.valuesCount(), Eq(0));
+    EXPECT_THAT(statistics.tokensCount(), Eq(0));
+    EXPECT_FALSE(statistics.hasRange());
+}
+
+TEST_F(VariableStatisticsTests, Numbers) {
+    vector<int> values = {5, -3, 8};
+    statistics.addAll(values.begin(), values.end());
+    statistics.add(2);
+
+    EXPECT_THAT(statistics.valuesCount(), Eq(4));
+    EXPECT_THAT(statistics.tokensCount(), Eq(4));
+    EXPECT_TRUE(statistics.hasRange());
+    EXPECT_TRUE(statistics.isIntegral());
+    EXPECT_THAT(statistics.min(), Eq(-3));
+    EXPECT_THAT(statistics.max(), Eq(8));
+}
+
+TEST_F(VariableStatisticsTests, NonNumbers) {
+    vector<string> values = {"hello world", "a"};
+    statistics.addAll(values.begin(), values.end(), 3);
+    statistics.add('x');
+
+    EXPECT_THAT(statistics.valuesCount(), Eq(3));
+    EXPECT_THAT(statistics.tokensCount(), Eq(4));
+    EXPECT_FALSE(statistics.hasRange());
+}
+
+TEST_F(VariableStatisticsTests, Clear) {
+    statistics.add(1.5);
+    statistics.clear();
+
+    EXPECT_THAT(statistics.valuesCount(), Eq(0));
+    EXPECT_FALSE(statistics.hasRange());
+}
+
+TEST_F(VariableStatisticsTests, GatheredWhilePrinting) {
+    int n = 3;
+    vector<long long> v = {7, 1000000000000LL, -2};
+    vector<vector<int>> m = {{1, 2}, {3, 4}};
+    Scalar* N = Scalar::create(n, "n");
+    Vector* V = Vector::create(v, "v");
+    Matrix* M = Matrix::create(m, "m");
+
+    VariableStatistics nStatistics("n", VariableType::SCALAR);
+    VariableStatistics mStatistics("m", VariableType::MATRIX);
+    N->setStatistics(&nStatistics);
+    V->setStatistics(&statistics);
+    M->setStatistics(&mStatistics);
+
+    ostringstream out;
+    N->printTo(&out);
+    V->printTo(&out);
+    M->printRowTo(0, &out);
+    M->printRowTo(1, &out);
+
+    EXPECT_THAT(nStatistics.valuesCount(), Eq(1));
+    EXPECT_THAT(nStatistics.min(), Eq(3));
+    EXPECT_THAT(statistics.valuesCount(), Eq(3));
+    EXPECT_THAT(statistics.min(), Eq(-2));
+    EXPECT_THAT(statistics.max(), Eq(1000000000000LL));
+    EXPECT_THAT(mStatistics.valuesCount(), Eq(4));
+    EXPECT_THAT(mStatistics.tokensCount(), Eq(4));
+    EXPECT_THAT(mStatistics.max(), Eq(4));
+}
+
+}
@@ -108,4 +108,27 @@ TEST_F(VectorTests, Printing_Elements) {
     EXPECT_THAT(out.str(), Eq("1 2 3"));
 }
 
+TEST_F(VectorTests, Snapshot) {
+    v = {1, 2, 3};
+    vector<double> b = {0.5, -2, 1e18};
+    vector<string> s = {"a", "", "bc"};
+    Vector* B = Vector::create(b, "B");
+    Vector* S = Vector::create(s, "S");
+    ostringstream out;
+    V->snapshotTo(&out);
+    B->snapshotTo(&out);
+    S->snapshotTo(&out);
+
+    v = {4};
+    b.clear();
+    s.clear();
+    istringstream in(out.str());
+    V->restoreFrom(&in);
+    B->restoreFrom(&in);
+    S->restoreFrom(&in);
+    EXPECT_THAT(v, Eq(vector<int>{1, 2, 3}));
+    EXPECT_THAT(b, Eq(vector<double>{0.5, -2, 1e18}));
+    EXPECT_THAT(s, Eq(vector<string>{"a", "", "bc"}));
+}
+
 }
@@ -36,6 +36,16 @@ TEST_F(WhitespaceManipulatorTests, Parsing_Space_Failed) {
     }
 }
 
+TEST_F(WhitespaceManipulatorTests, SkippingSpace) {
+    istringstream in(" 1\n");
+    EXPECT_TRUE(WhitespaceManipulator::skipSpace(&in));
+    EXPECT_FALSE(WhitespaceManipulator::skipSpace(&in));
+    EXPECT_THAT(in.peek(), Eq('1'));
+    in.get();
+    EXPECT_TRUE(WhitespaceManipulator::skipNewline(&in));
+    EXPECT_FALSE(WhitespaceManipulator::skipNewline(&in));
+}
+
 TEST_F(WhitespaceManipulatorTests, Parsing_SpaceAfterMissingNewline_Successful) {
     istringstream in(" 123");
     EXPECT_NO_THROW({
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/stresser/Stresser.hpp"
+
+namespace tcframe {
+
+class MockStresser : public Stresser {
+public:
+    MockStresser()
+            : Stresser(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr) {}
+
+    MOCK_METHOD2(stress, bool(const TestSuite&, const StresserConfig&));
+};
+
+class MockStresserFactory : public StresserFactory {
+public:
+    MOCK_METHOD6(create, Stresser*(
+            Random*,
+            Verifier*,
+            IOManipulator*,
+            OperatingSystem*,
+            WorkerPool*,
+            StresserLogger*));
+};
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/stresser/StresserLogger.hpp"
+
+namespace tcframe {
+
+class MockStresserLogger : public StresserLogger {
+public:
+    MockStresserLogger()
+            : StresserLogger(nullptr) {}
+
+    MOCK_METHOD3(logIntroduction, void(const string&, int, int));
+    MOCK_METHOD1(logTestCaseNotFound, void(const string&));
+    MOCK_METHOD3(logIterationFailure, void(int, unsigned, const vector<string>&));
+    MOCK_METHOD2(logIterationNotReproduced, void(int, unsigned));
+    MOCK_METHOD3(logReproducerWritten, void(const string&, long long, long long));
+    MOCK_METHOD2(logSuccessfulResult, void(int, double));
+    MOCK_METHOD1(logSimpleFailure, void(const string&));
+    MOCK_METHOD0(logFailedResult, void());
+};
+
+}
@@ -0,0 +1,64 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include "../logger/MockLoggerEngine.hpp"
+#include "tcframe/stresser/StresserLogger.hpp"
+
+using ::testing::InSequence;
+using ::testing::Test;
+
+namespace tcframe {
+
+class StresserLoggerTests : public Test {
+protected:
+    Mock(LoggerEngine) engine;
+
+    StresserLogger logger = StresserLogger(&engine);
+};
+
+TEST_F(StresserLoggerTests, Introduction) {
+    EXPECT_CALL(engine, logParagraph(0, "Stress testing foo_1 for 1000 iterations on 4 workers..."));
+
+    logger.logIntroduction("foo_1", 1000, 4);
+}
+
+TEST_F(StresserLoggerTests, IterationFailure) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(1, "Iteration 7 (seed 49): FAILED"));
+        EXPECT_CALL(engine, logParagraph(2, "Reasons:"));
+        EXPECT_CALL(engine, logListItem1(2, "./brute: output differs from ./sol"));
+    }
+    logger.logIterationFailure(7, 49, {"./brute: output differs from ./sol"});
+}
+
+TEST_F(StresserLoggerTests, ReproducerWritten) {
+    EXPECT_CALL(engine, logParagraph(1, "Reproducer written to foo_1_stress.in (2 bytes, shrunk from 8 bytes)."));
+
+    logger.logReproducerWritten("foo_1_stress.in", 2, 8);
+}
+
+TEST_F(StresserLoggerTests, Result_Successful) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Stress testing finished. All 1000 iterations OK (4000 iterations/s)."));
+    }
+    logger.logSuccessfulResult(1000, 0.25);
+}
+
+TEST_F(StresserLoggerTests, SimpleFailure) {
+    EXPECT_CALL(engine, logListItem1(1, "Cannot fork worker: Resource temporarily unavailable"));
+    logger.logSimpleFailure("Cannot fork worker: Resource temporarily unavailable");
+}
+
+TEST_F(StresserLoggerTests, Result_Failed) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Stress testing finished. Some iteration FAILED."));
+    }
+    logger.logFailedResult();
+}
+
+}
@@ -0,0 +1,193 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include <sstream>
+
+#include "../os/MockOperatingSystem.hpp"
+#include "../verifier/MockVerifier.hpp"
+#include "MockStresserLogger.hpp"
+#include "tcframe/stresser/Stresser.hpp"
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::Test;
+using ::testing::Throw;
+
+using std::ostringstream;
+
+namespace tcframe {
+
+class StresserTests : public Test {
+protected:
+    int N = 0;
+    vector<int> A;
+    int appliedCount = 0;
+
+    Random random;
+    Mock(Verifier) verifier;
+    Mock(OperatingSystem) os;
+    Mock(StresserLogger) logger;
+    WorkerPool workerPool;
+    IOManipulator* ioManipulator;
+
+    ostringstream reproducerIn;
+    ostringstream reproducerOut1;
+    ostringstream reproducerOut2;
+
+    StresserConfig config = StresserConfigBuilder()
+            .setTestCaseId("foo_1")
+            .setSeed(42)
+            .setSolutionCommand("./sol")
+            .setAlternativeSolutionCommands({"./brute"})
+            .setIterationsCount(5)
+            .build();
+
+    Stresser* stresser;
+
+    void SetUp() {
+        IOFormatBuilder ioFormatBuilder;
+        ioFormatBuilder.prepareForInputFormat();
+        ioFormatBuilder.newLineIOSegment()
+                .addScalarVariable(Scalar::create(N, "N"));
+        ioFormatBuilder.newLineIOSegment()
+                .addVectorVariable(Vector::create(A, "A"));
+        ioManipulator = new IOManipulator(ioFormatBuilder.build());
+        stresser = new Stresser(&random, &verifier, ioManipulator, &os, &workerPool, &logger);
+
+        ON_CALL(verifier, verifyConstraints(_))
+                .WillByDefault(Invoke([&] (const set<int>&) {
+                    return N == A.size()
+                           ? ConstraintsVerificationResult::validResult()
+                           : ConstraintsVerificationResult({{-1, {"N == |A|"}}}, {});
+                }));
+
+        // The brute force solution disagrees on every input with a 7.
+        ON_CALL(os, executeConcurrentlyOnInput(_, _))
+                .WillByDefault(Invoke([] (const vector<string>&, const string& input) {
+                    string bruteOutput = input.find('7') == string::npos ? "ok\n" : "wrong\n";
+                    return vector<ExecutionResult>{
+                            ExecutionResult(0, new istringstream("ok\n"), new istringstream()),
+                            ExecutionResult(0, new istringstream(bruteOutput), new istringstream())};
+                }));
+        ON_CALL(os, openForWriting("foo_1_stress.in")).WillByDefault(Return(&reproducerIn));
+        ON_CALL(os, openForWriting("foo_1_stress_1.out")).WillByDefault(Return(&reproducerOut1));
+        ON_CALL(os, openForWriting("foo_1_stress_2.out")).WillByDefault(Return(&reproducerOut2));
+    }
+
+    void TearDown() {
+        delete stresser;
+        delete ioManipulator;
+    }
+
+    TestSuite testSuiteWithApplier(function<void()> applier) {
+        return TestSuite({TestGroup(-1, {TestCaseBuilder()
+                .setId("foo_1")
+                .setSubtaskIds({-1})
+                .setApplier(applier)
+                .build()})});
+    }
+};
+
+TEST_F(StresserTests, Stress_Successful) {
+    TestSuite testSuite = testSuiteWithApplier([&] {
+        appliedCount++;
+        N = 1;
+        A = {random.nextInt(1, 6)};
+    });
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction("foo_1", 5, 1));
+        EXPECT_CALL(os, executeConcurrentlyOnInput(ElementsAre("./sol", "./brute"), _)).Times(5);
+        EXPECT_CALL(logger, logSuccessfulResult(5, _));
+    }
+    EXPECT_CALL(os, openForWriting(_)).Times(0);
+
+    EXPECT_TRUE(stresser->stress(testSuite, config));
+    EXPECT_THAT(appliedCount, Eq(5));
+}
+
+TEST_F(StresserTests, Stress_Successful_FreshSeeds) {
+    vector<int> values;
+    TestSuite testSuite = testSuiteWithApplier([&] {
+        values.push_back(random.nextInt(0, 1000000000));
+    });
+    stresser->stress(testSuite, config);
+
+    vector<int> expectedValues;
+    for (unsigned seed = 42; seed < 47; seed++) {
+        random.setSeed(seed);
+        expectedValues.push_back(random.nextInt(0, 1000000000));
+    }
+    EXPECT_THAT(values, Eq(expectedValues));
+}
+
+TEST_F(StresserTests, Stress_Failed_ShrunkReproducer) {
+    TestSuite testSuite = testSuiteWithApplier([&] {
+        appliedCount++;
+        A = appliedCount < 3 ? vector<int>{1} : vector<int>{3, 7, 4, 9};
+        N = A.size();
+    });
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIterationFailure(2, 44, ElementsAre("./brute: output differs from ./sol")));
+        EXPECT_CALL(logger, logReproducerWritten("foo_1_stress.in", 4, 10));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(logger, logSuccessfulResult(_, _)).Times(0);
+
+    EXPECT_FALSE(stresser->stress(testSuite, config));
+    EXPECT_THAT(reproducerIn.str(), Eq("1\n7\n"));
+    EXPECT_THAT(reproducerOut1.str(), Eq("ok\n"));
+    EXPECT_THAT(reproducerOut2.str(), Eq("wrong\n"));
+}
+
+TEST_F(StresserTests, Stress_Failed_Constraints) {
+    TestSuite testSuite = testSuiteWithApplier([&] {
+        N = 5;
+        A = {3, 7};
+    });
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIterationFailure(0, 42, ElementsAre("Does not satisfy constraint: N == |A|")));
+        EXPECT_CALL(logger, logReproducerWritten("foo_1_stress.in", 6, 6));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(os, executeConcurrentlyOnInput(_, _)).Times(1);
+
+    EXPECT_FALSE(stresser->stress(testSuite, config));
+    EXPECT_THAT(reproducerIn.str(), Eq("5\n3 7\n"));
+}
+
+TEST_F(StresserTests, Stress_Failed_Solutions) {
+    TestSuite testSuite = testSuiteWithApplier([&] {
+        N = 1;
+        A = {1};
+    });
+    ON_CALL(os, executeConcurrentlyOnInput(_, _))
+            .WillByDefault(Throw(runtime_error("Cannot create a pipe for ./sol: Too many open files")));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logSimpleFailure("Cannot create a pipe for ./sol: Too many open files"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_FALSE(stresser->stress(testSuite, config));
+}
+
+TEST_F(StresserTests, Stress_Failed_TestCaseNotFound) {
+    TestSuite testSuite = testSuiteWithApplier([] {});
+    StresserConfig unknownConfig = StresserConfigBuilder(config)
+            .setTestCaseId("foo_2")
+            .build();
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseNotFound("foo_2"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_FALSE(stresser->stress(testSuite, unknownConfig));
+}
+
+}
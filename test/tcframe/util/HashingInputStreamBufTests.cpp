@@ -0,0 +1,58 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/util/HashingInputStreamBuf.hpp"
+#include "tcframe/util/StringUtils.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::istream;
+using std::istringstream;
+
+namespace tcframe {
+
+class HashingInputStreamBufTests : public Test {};
+
+TEST_F(HashingInputStreamBufTests, ReadsAndHashes) {
+    string content;
+    for (int i = 0; i < 20000; i++) {
+        content += StringUtils::toString(i) + "\n";
+    }
+    istringstream source(content);
+    HashingInputStreamBuf hashingBuf(source.rdbuf());
+    istream in(&hashingBuf);
+
+    int first;
+    int second;
+    in >> first >> second;
+    EXPECT_THAT(first, Eq(0));
+    EXPECT_THAT(second, Eq(1));
+
+    // The content that was not read is still hashed.
+    XxHash64 hash;
+    hash.update(content);
+    EXPECT_THAT(hashingBuf.digest(), Eq(hash.digest()));
+    EXPECT_THAT(hashingBuf.size(), Eq((long long) content.size()));
+}
+
+TEST_F(HashingInputStreamBufTests, SeeksBackWithinBuffer) {
+    istringstream source("12 abc");
+    HashingInputStreamBuf hashingBuf(source.rdbuf());
+    istream in(&hashingBuf);
+
+    int value;
+    in >> value;
+    long long position = in.tellg();
+    in >> value;
+    EXPECT_TRUE(in.fail());
+
+    in.clear();
+    in.seekg(position);
+    string found;
+    in >> found;
+    EXPECT_THAT(found, Eq("abc"));
+}
+
+}
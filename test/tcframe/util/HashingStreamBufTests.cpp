@@ -0,0 +1,37 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/util/HashingStreamBuf.hpp"
+#include "tcframe/util/StringUtils.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::endl;
+using std::ostream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class HashingStreamBufTests : public Test {};
+
+TEST_F(HashingStreamBufTests, ForwardsAndHashes) {
+    ostringstream target;
+    HashingStreamBuf hashingBuf(target.rdbuf());
+    ostream out(&hashingBuf);
+
+    string expected;
+    for (int i = 0; i < 20000; i++) {
+        out << i << endl;
+        expected += StringUtils::toString(i) + "\n";
+    }
+
+    XxHash64 hash;
+    hash.update(expected);
+    EXPECT_THAT(hashingBuf.digest(), Eq(hash.digest()));
+    EXPECT_THAT(hashingBuf.size(), Eq((long long) expected.size()));
+    EXPECT_THAT(target.str(), Eq(expected));
+}
+
+}
@@ -0,0 +1,72 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/util/MinHashStreamBuf.hpp"
+#include "tcframe/util/StringUtils.hpp"
+
+using ::testing::Eq;
+using ::testing::Gt;
+using ::testing::Lt;
+using ::testing::Ne;
+using ::testing::Test;
+
+using std::endl;
+using std::ostream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class MinHashStreamBufTests : public Test {
+protected:
+    static MinHashSignature signatureOf(const string& content) {
+        ostringstream target;
+        MinHashStreamBuf minHashBuf(target.rdbuf());
+        ostream out(&minHashBuf);
+        out << content;
+        return minHashBuf.signature();
+    }
+};
+
+TEST_F(MinHashStreamBufTests, ForwardsAndSketches) {
+    ostringstream target;
+    MinHashStreamBuf minHashBuf(target.rdbuf());
+    ostream out(&minHashBuf);
+
+    string expected;
+    for (int i = 0; i < 20000; i++) {
+        out << i << endl;
+        expected += StringUtils::toString(i) + "\n";
+    }
+
+    EXPECT_THAT(minHashBuf.signature(), Eq(signatureOf(expected)));
+    EXPECT_THAT(target.str(), Eq(expected));
+}
+
+TEST_F(MinHashStreamBufTests, Signature_IgnoresWhitespaceLayout) {
+    EXPECT_THAT(signatureOf("3\n1 2 3\n"), Eq(signatureOf("3 1\t2\r\n3")));
+    EXPECT_THAT(signatureOf("3\n1 2 3\n"), Ne(signatureOf("3\n1 2 4\n")));
+}
+
+TEST_F(MinHashStreamBufTests, Signature_FewerTokensThanShingle) {
+    EXPECT_THAT(signatureOf("42\n"), Eq(signatureOf("42")));
+    EXPECT_THAT(signatureOf("42\n"), Ne(signatureOf("43\n")));
+    EXPECT_THAT(signatureOf("42\n"), Ne(MinHashSignature()));
+}
+
+TEST_F(MinHashStreamBufTests, Similarity) {
+    string content;
+    string similarContent;
+    string differentContent;
+    for (int i = 0; i < 10000; i++) {
+        content += StringUtils::toString(i) + " ";
+        similarContent += StringUtils::toString(i % 100 == 0 ? -i : i) + " ";
+        differentContent += StringUtils::toString(i * 7 + 1) + " ";
+    }
+
+    EXPECT_THAT(signatureOf(content).similarity(signatureOf(content)), Eq(1.0));
+    EXPECT_THAT(signatureOf(content).similarity(signatureOf(similarContent)), Gt(0.8));
+    EXPECT_THAT(signatureOf(content).similarity(signatureOf(differentContent)), Lt(0.2));
+}
+
+}
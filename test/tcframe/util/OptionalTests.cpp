@@ -1,7 +1,12 @@
 #include "gmock/gmock.h"
 
+#include <memory>
+
 #include "tcframe/util/optional.hpp"
 
+using std::shared_ptr;
+using std::weak_ptr;
+
 using ::testing::Eq;
 using ::testing::Test;
 
@@ -25,4 +30,17 @@ TEST_F(OptionalTests, ValueOr) {
     EXPECT_THAT(optional<int>().value_or(10), Eq(10));
 }
 
+TEST_F(OptionalTests, ValueReleased) {
+    weak_ptr<int> observer;
+    {
+        shared_ptr<int> value(new int(7));
+        observer = value;
+        optional<shared_ptr<int>> x(value);
+        optional<shared_ptr<int>> y = x;
+        value.reset();
+        EXPECT_FALSE(observer.expired());
+    }
+    EXPECT_TRUE(observer.expired());
+}
+
 }
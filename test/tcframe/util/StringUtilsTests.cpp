@@ -3,6 +3,7 @@
 #include "tcframe/util/StringUtils.hpp"
 
 using ::testing::ElementsAre;
+using ::testing::Eq;
 using ::testing::Test;
 
 namespace tcframe {
@@ -19,4 +20,9 @@ TEST_F(StringUtilsTests, Split) {
             " A", "B", " C", "   D "));
 }
 
+TEST_F(StringUtilsTests, ToJsonString) {
+    EXPECT_THAT(StringUtils::toJsonString("1 <= S.size() && S[0] != '\"'"), Eq("\"1 <= S.size() && S[0] != '\\\"'\""));
+    EXPECT_THAT(StringUtils::toJsonString("a\\b\nc\x01"), Eq("\"a\\\\b\\nc\\u0001\""));
+}
+
 }
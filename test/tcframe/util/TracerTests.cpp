@@ -0,0 +1,71 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <thread>
+
+#include "tcframe/util/Tracer.hpp"
+
+using ::testing::Eq;
+using ::testing::HasSubstr;
+using ::testing::Not;
+using ::testing::Test;
+
+using std::ostringstream;
+using std::thread;
+
+namespace tcframe {
+
+class TracerTests : public Test {
+protected:
+    Tracer tracer;
+};
+
+TEST_F(TracerTests, Write) {
+    tracer.record("apply", "testCase", "foo_1", 5, 12);
+    tracer.record("generate", "generator", "", 0, 20);
+
+    ostringstream out;
+    tracer.write(&out);
+    EXPECT_THAT(out.str(), Eq(
+            "{\"traceEvents\":[\n"
+            "{\"name\":\"apply\",\"cat\":\"testCase\",\"ph\":\"X\",\"ts\":5,\"dur\":7,\"pid\":1,\"tid\":1,"
+            "\"args\":{\"id\":\"foo_1\"}},\n"
+            "{\"name\":\"generate\",\"cat\":\"generator\",\"ph\":\"X\",\"ts\":0,\"dur\":20,\"pid\":1,\"tid\":1}\n"
+            "]}\n"));
+}
+
+TEST_F(TracerTests, Write_Empty) {
+    ostringstream out;
+    tracer.write(&out);
+    EXPECT_THAT(out.str(), Eq("{\"traceEvents\":[\n]}\n"));
+}
+
+TEST_F(TracerTests, Write_Threads) {
+    tracer.record("apply", "testCase", "foo_1", 0, 1);
+    thread worker([this] {
+        tracer.record("apply", "testCase", "foo_2", 0, 1);
+    });
+    worker.join();
+    tracer.record("apply", "testCase", "foo_3", 1, 2);
+
+    ostringstream out;
+    tracer.write(&out);
+    EXPECT_THAT(out.str(), HasSubstr("\"tid\":1,\"args\":{\"id\":\"foo_1\"}"));
+    EXPECT_THAT(out.str(), HasSubstr("\"tid\":2,\"args\":{\"id\":\"foo_2\"}"));
+    EXPECT_THAT(out.str(), HasSubstr("\"tid\":1,\"args\":{\"id\":\"foo_3\"}"));
+}
+
+TEST_F(TracerTests, TraceSpan) {
+    {
+        TraceSpan span(&tracer, "print", "testCase", "foo_1");
+        TraceSpan untracedSpan(nullptr, "print", "testCase", "foo_2");
+    }
+
+    ostringstream out;
+    tracer.write(&out);
+    EXPECT_THAT(out.str(), HasSubstr("{\"name\":\"print\",\"cat\":\"testCase\",\"ph\":\"X\""));
+    EXPECT_THAT(out.str(), HasSubstr("\"args\":{\"id\":\"foo_1\"}"));
+    EXPECT_THAT(out.str(), Not(HasSubstr("foo_2")));
+}
+
+}
@@ -0,0 +1,47 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/util/XxHash64.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class XxHash64Tests : public Test {
+protected:
+    static unsigned long long hash(const string& data) {
+        XxHash64 hash;
+        hash.update(data);
+        return hash.digest();
+    }
+};
+
+TEST_F(XxHash64Tests, Digest) {
+    EXPECT_THAT(hash(""), Eq(0xef46db3751d8e999ULL));
+    EXPECT_THAT(hash("a"), Eq(0xd24ec4f1a98c6e5bULL));
+    EXPECT_THAT(hash("abc"), Eq(0x44bc2cf5ad770999ULL));
+    EXPECT_THAT(hash("Nobody inspects the spammish repetition"), Eq(0xfbcea83c8a378bf1ULL));
+}
+
+TEST_F(XxHash64Tests, Digest_Incremental) {
+    string data;
+    for (int i = 0; i < 768; i++) {
+        data += (char) (i % 256);
+    }
+    EXPECT_THAT(hash(data), Eq(0x8e03c838c596036fULL));
+
+    for (size_t chunkSize : {1, 7, 31, 32, 33, 100}) {
+        XxHash64 incremental;
+        for (size_t i = 0; i < data.size(); i += chunkSize) {
+            incremental.update(data.substr(i, chunkSize));
+        }
+        EXPECT_THAT(incremental.digest(), Eq(0x8e03c838c596036fULL));
+    }
+}
+
+TEST_F(XxHash64Tests, ToHex) {
+    EXPECT_THAT(XxHash64::toHex(0x44bc2cf5ad770999ULL), Eq("44bc2cf5ad770999"));
+    EXPECT_THAT(XxHash64::toHex(42), Eq("000000000000002a"));
+}
+
+}
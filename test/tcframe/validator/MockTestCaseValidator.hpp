@@ -0,0 +1,17 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/validator/TestCaseValidator.hpp"
+
+namespace tcframe {
+
+class MockTestCaseValidator : public TestCaseValidator {
+public:
+    MockTestCaseValidator()
+            : TestCaseValidator(nullptr, nullptr, nullptr) {}
+
+    MOCK_METHOD3(validate, ValidationResult(const string&, const optional<set<int>>&, const ValidatorConfig&));
+};
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/validator/Validator.hpp"
+
+namespace tcframe {
+
+class MockValidator : public Validator {
+public:
+    MockValidator()
+            : Validator(nullptr, nullptr, nullptr, nullptr) {}
+
+    MOCK_METHOD2(validate, bool(const TestSuite&, const ValidatorConfig&));
+};
+
+class MockValidatorFactory : public ValidatorFactory {
+public:
+    MOCK_METHOD4(create, Validator*(TestCaseValidator*, OperatingSystem*, WorkerPool*, ValidatorLogger*));
+};
+
+}
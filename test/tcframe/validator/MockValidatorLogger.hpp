@@ -0,0 +1,22 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/validator/ValidatorLogger.hpp"
+
+namespace tcframe {
+
+class MockValidatorLogger : public ValidatorLogger {
+public:
+    MockValidatorLogger()
+            : ValidatorLogger(nullptr) {}
+
+    MOCK_METHOD1(logIntroduction, void(const string&));
+    MOCK_METHOD0(logNoTestCasesFound, void());
+    MOCK_METHOD0(logSuccessfulResult, void());
+    MOCK_METHOD0(logFailedResult, void());
+    MOCK_METHOD1(logTestCaseResult, void(const ValidationResult&));
+    MOCK_METHOD1(logSimpleFailure, void(const string&));
+};
+
+}
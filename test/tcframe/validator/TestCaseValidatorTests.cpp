@@ -0,0 +1,158 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include <sstream>
+#include <stdexcept>
+
+#include "../io_manipulator/MockIOManipulator.hpp"
+#include "../os/MockOperatingSystem.hpp"
+#include "../verifier/MockVerifier.hpp"
+#include "tcframe/validator/TestCaseValidator.hpp"
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::Test;
+using ::testing::Throw;
+
+using std::istringstream;
+using std::out_of_range;
+
+namespace tcframe {
+
+class TestCaseValidatorTests : public Test {
+protected:
+    int T;
+
+    Mock(IOManipulator) ioManipulator;
+    Mock(Verifier) verifier;
+    Mock(OperatingSystem) os;
+
+    ValidatorConfig config = ValidatorConfigBuilder()
+            .setTestCasesDir("dir")
+            .build();
+    ValidatorConfig multipleTestCasesConfig = ValidatorConfigBuilder()
+            .setTestCasesDir("dir")
+            .setMultipleTestCasesCount(&T)
+            .build();
+
+    TestCaseValidator validator = TestCaseValidator(&ioManipulator, &verifier, &os);
+
+    void SetUp() {
+        ON_CALL(os, openForReading(_))
+                .WillByDefault(Invoke([] (const string&) {return new istringstream("2\n");}));
+        ON_CALL(verifier, verifyConstraints(_))
+                .WillByDefault(Return(ConstraintsVerificationResult::validResult()));
+        ON_CALL(verifier, verifyMultipleTestCasesConstraints())
+                .WillByDefault(Return(MultipleTestCasesConstraintsVerificationResult({})));
+    }
+};
+
+TEST_F(TestCaseValidatorTests, Validation_Successful) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, openForReading("dir/foo_1_1.in"));
+        EXPECT_CALL(ioManipulator, parseInput(_));
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1, 2}));
+    }
+    ValidationResult result = validator.validate("foo_1_1.in", optional<set<int>>({1, 2}), config);
+
+    EXPECT_THAT(result, Eq(ValidationResult("foo_1_1.in", {})));
+}
+
+TEST_F(TestCaseValidatorTests, Validation_Failed_Parsing) {
+    ON_CALL(ioManipulator, parseInput(_))
+            .WillByDefault(Throw(runtime_error("Expected: <EOF>")));
+    EXPECT_CALL(verifier, verifyConstraints(_)).Times(0);
+
+    ValidationResult result = validator.validate("foo_1_1.in", optional<set<int>>({1}), config);
+
+    EXPECT_THAT(result.failures(), ElementsAre("Expected: <EOF>"));
+}
+
+TEST_F(TestCaseValidatorTests, Validation_Failed_ConstraintThrows) {
+    ON_CALL(verifier, verifyConstraints(_))
+            .WillByDefault(Throw(out_of_range("vector::_M_range_check")));
+
+    ValidationResult result = validator.validate("foo_1_1.in", optional<set<int>>({1}), config);
+
+    EXPECT_THAT(result.failures(), ElementsAre("vector::_M_range_check"));
+}
+
+TEST_F(TestCaseValidatorTests, Validation_Failed_Verification) {
+    ON_CALL(verifier, verifyConstraints(set<int>{1}))
+            .WillByDefault(Return(ConstraintsVerificationResult({{1, {"N <= 10"}}}, {2})));
+
+    ValidationResult result = validator.validate("foo_1_1.in", optional<set<int>>({1}), config);
+
+    EXPECT_THAT(result.failures(), ElementsAre(
+            "Does not satisfy subtask 1, on constraint: N <= 10",
+            "Satisfies subtask 2 but is not assigned to it"));
+}
+
+TEST_F(TestCaseValidatorTests, Validation_UnknownSubtasks_Successful) {
+    ON_CALL(verifier, verifyConstraints(set<int>{}))
+            .WillByDefault(Return(ConstraintsVerificationResult({}, {2})));
+
+    ValidationResult result = validator.validate("custom.in", optional<set<int>>(), config);
+
+    EXPECT_TRUE(result.isValid());
+}
+
+TEST_F(TestCaseValidatorTests, Validation_UnknownSubtasks_Failed) {
+    ON_CALL(verifier, verifyConstraints(set<int>{}))
+            .WillByDefault(Return(ConstraintsVerificationResult({}, {})));
+    ON_CALL(verifier, subtaskIds())
+            .WillByDefault(Return(set<int>{1, 2}));
+    ON_CALL(verifier, verifyConstraints(set<int>{1, 2}))
+            .WillByDefault(Return(ConstraintsVerificationResult({{1, {"N <= 10"}}, {2, {"N <= 20"}}}, {})));
+
+    ValidationResult result = validator.validate("custom.in", optional<set<int>>(), config);
+
+    EXPECT_THAT(result.failures(), ElementsAre(
+            "Does not satisfy subtask 1, on constraint: N <= 10",
+            "Does not satisfy subtask 2, on constraint: N <= 20"));
+}
+
+TEST_F(TestCaseValidatorTests, Validation_MultipleTestCases_Successful) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(ioManipulator, parseInputWithoutEof(_));
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1}));
+        EXPECT_CALL(ioManipulator, parseInputWithoutEof(_));
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1}));
+        EXPECT_CALL(verifier, verifyMultipleTestCasesConstraints());
+    }
+    ValidationResult result = validator.validate("foo_1.in", optional<set<int>>({1}), multipleTestCasesConfig);
+
+    EXPECT_TRUE(result.isValid());
+    EXPECT_THAT(T, Eq(2));
+}
+
+TEST_F(TestCaseValidatorTests, Validation_MultipleTestCases_Failed) {
+    ON_CALL(verifier, verifyConstraints(set<int>{1}))
+            .WillByDefault(Return(ConstraintsVerificationResult({{1, {"N <= 10"}}}, {})));
+    ON_CALL(verifier, verifyMultipleTestCasesConstraints())
+            .WillByDefault(Return(MultipleTestCasesConstraintsVerificationResult({"T <= 1"})));
+
+    ValidationResult result = validator.validate("foo_1.in", optional<set<int>>({1}), multipleTestCasesConfig);
+
+    EXPECT_THAT(result.failures(), ElementsAre(
+            "Test case 1: Does not satisfy subtask 1, on constraint: N <= 10",
+            "Test case 2: Does not satisfy subtask 1, on constraint: N <= 10",
+            "Does not satisfy constraint: T <= 1"));
+}
+
+TEST_F(TestCaseValidatorTests, Validation_MultipleTestCases_Failed_Parsing) {
+    ON_CALL(ioManipulator, parseInputWithoutEof(_))
+            .WillByDefault(Throw(runtime_error("Cannot parse for 'N'. Found: <EOF>")));
+
+    ValidationResult result = validator.validate("foo_1.in", optional<set<int>>({1}), multipleTestCasesConfig);
+
+    EXPECT_THAT(result.failures(), ElementsAre("Test case 1: Cannot parse for 'N'. Found: <EOF>"));
+}
+
+}
@@ -0,0 +1,59 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include "../logger/MockLoggerEngine.hpp"
+#include "tcframe/validator/ValidatorLogger.hpp"
+
+using ::testing::InSequence;
+using ::testing::Test;
+
+namespace tcframe {
+
+class ValidatorLoggerTests : public Test {
+protected:
+    Mock(LoggerEngine) engine;
+
+    ValidatorLogger logger = ValidatorLogger(&engine);
+};
+
+TEST_F(ValidatorLoggerTests, Introduction) {
+    EXPECT_CALL(engine, logParagraph(0, "Validating test cases in tc..."));
+
+    logger.logIntroduction("tc");
+}
+
+TEST_F(ValidatorLoggerTests, TestCaseResult_Successful) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logHangingParagraph(1, "foo_1_1.in: "));
+        EXPECT_CALL(engine, logParagraph(0, "OK"));
+    }
+    logger.logTestCaseResult(ValidationResult("foo_1_1.in", {}));
+}
+
+TEST_F(ValidatorLoggerTests, TestCaseResult_Failed) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logHangingParagraph(1, "foo_1_1.in: "));
+        EXPECT_CALL(engine, logParagraph(0, "FAILED"));
+        EXPECT_CALL(engine, logParagraph(2, "Reasons:"));
+        EXPECT_CALL(engine, logListItem1(2, "Expected: <EOF>"));
+    }
+    logger.logTestCaseResult(ValidationResult("foo_1_1.in", {"Expected: <EOF>"}));
+}
+
+TEST_F(ValidatorLoggerTests, SimpleFailure) {
+    EXPECT_CALL(engine, logListItem1(1, "Worker 1 exited abnormally"));
+    logger.logSimpleFailure("Worker 1 exited abnormally");
+}
+
+TEST_F(ValidatorLoggerTests, Result_Failed) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Validation finished. Some test cases FAILED."));
+    }
+    logger.logFailedResult();
+}
+
+}
@@ -0,0 +1,141 @@
+#include "gmock/gmock.h"
+#include "../mock.hpp"
+
+#include "../os/MockOperatingSystem.hpp"
+#include "MockTestCaseValidator.hpp"
+#include "MockValidatorLogger.hpp"
+#include "tcframe/validator/Validator.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::Test;
+
+namespace tcframe {
+
+class ValidatorTests : public Test {
+protected:
+    Mock(TestCaseValidator) testCaseValidator;
+    Mock(OperatingSystem) os;
+    Mock(ValidatorLogger) logger;
+    WorkerPool workerPool;
+
+    TestSuite testSuite = TestSuite({
+            TestGroup(0, {TestCaseBuilder().setId("foo_sample_1").setSubtaskIds({1, 2}).build()}),
+            TestGroup(1, {TestCaseBuilder().setId("foo_1_1").setSubtaskIds({1}).build()}),
+            TestGroup(2, {TestCaseBuilder().setId("foo_2_1").setSubtaskIds({2}).build()})});
+
+    ValidatorConfig config = ValidatorConfigBuilder()
+            .setSlug("foo")
+            .setTestCasesDir("dir")
+            .build();
+
+    Validator validator = Validator(&testCaseValidator, &os, &workerPool, &logger);
+
+    void SetUp() {
+        ON_CALL(testCaseValidator, validate(_, _, _))
+                .WillByDefault(Invoke([] (const string& filename, const optional<set<int>>&, const ValidatorConfig&) {
+                    return ValidationResult(filename, {});
+                }));
+    }
+};
+
+TEST_F(ValidatorTests, Validation_Successful) {
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1_1.in", "foo_1_1.out", "foo_2_7.in", "foo_sample_1.in"}));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction("dir"));
+        EXPECT_CALL(testCaseValidator, validate("foo_1_1.in", optional<set<int>>({1}), config));
+        EXPECT_CALL(testCaseValidator, validate("foo_2_7.in", optional<set<int>>({2}), config));
+        EXPECT_CALL(testCaseValidator, validate("foo_sample_1.in", optional<set<int>>({1, 2}), config));
+        EXPECT_CALL(logger, logTestCaseResult(ValidationResult("foo_1_1.in", {})));
+        EXPECT_CALL(logger, logTestCaseResult(ValidationResult("foo_2_7.in", {})));
+        EXPECT_CALL(logger, logTestCaseResult(ValidationResult("foo_sample_1.in", {})));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_TRUE(validator.validate(testSuite, config));
+}
+
+TEST_F(ValidatorTests, Validation_SubtasksInference) {
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"custom.in", "foo_2.in", "foo_2_x.in"}));
+    {
+        InSequence sequence;
+        EXPECT_CALL(testCaseValidator, validate("custom.in", optional<set<int>>(), config));
+        EXPECT_CALL(testCaseValidator, validate("foo_2.in", optional<set<int>>({2}), config));
+        EXPECT_CALL(testCaseValidator, validate("foo_2_x.in", optional<set<int>>(), config));
+    }
+    validator.validate(testSuite, config);
+}
+
+TEST_F(ValidatorTests, Validation_Failed) {
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1_1.in"}));
+    ON_CALL(testCaseValidator, validate("foo_1_1.in", _, _))
+            .WillByDefault(Return(ValidationResult("foo_1_1.in", {"Expected: <EOF>", "Multi\nline"})));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseResult(ValidationResult("foo_1_1.in", {"Expected: <EOF>", "Multi line"})));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_FALSE(validator.validate(testSuite, config));
+}
+
+TEST_F(ValidatorTests, Validation_Failed_NoTestCases) {
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1_1.out"}));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logNoTestCasesFound());
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_FALSE(validator.validate(testSuite, config));
+}
+
+TEST_F(ValidatorTests, Validation_Failed_Worker) {
+    ValidatorConfig parallelConfig = ValidatorConfigBuilder()
+            .setSlug("foo")
+            .setTestCasesDir("dir")
+            .setJobsCount(2)
+            .build();
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1_1.in", "foo_2_1.in"}));
+    ON_CALL(testCaseValidator, validate("foo_2_1.in", _, _))
+            .WillByDefault(Invoke([] (const string&, const optional<set<int>>&, const ValidatorConfig&)
+                    -> ValidationResult {
+                throw runtime_error("Cannot read foo_2_1.in");
+            }));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logSimpleFailure("Cannot read foo_2_1.in"));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(logger, logTestCaseResult(_)).Times(0);
+
+    EXPECT_FALSE(validator.validate(testSuite, parallelConfig));
+}
+
+TEST_F(ValidatorTests, Validation_MultipleJobs) {
+    ValidatorConfig parallelConfig = ValidatorConfigBuilder()
+            .setSlug("foo")
+            .setTestCasesDir("dir")
+            .setJobsCount(2)
+            .build();
+    ON_CALL(os, listFiles("dir"))
+            .WillByDefault(Return(vector<string>{"foo_1_1.in", "foo_2_1.in", "foo_sample_1.in"}));
+    ON_CALL(testCaseValidator, validate("foo_2_1.in", _, _))
+            .WillByDefault(Return(ValidationResult("foo_2_1.in", {"N <= 10"})));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseResult(ValidationResult("foo_1_1.in", {})));
+        EXPECT_CALL(logger, logTestCaseResult(ValidationResult("foo_2_1.in", {"N <= 10"})));
+        EXPECT_CALL(logger, logTestCaseResult(ValidationResult("foo_sample_1.in", {})));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_FALSE(validator.validate(testSuite, parallelConfig));
+}
+
+}
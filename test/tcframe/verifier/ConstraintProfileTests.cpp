@@ -0,0 +1,45 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/verifier/ConstraintProfile.hpp"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::IsEmpty;
+using ::testing::Test;
+
+namespace tcframe {
+
+class ConstraintProfileTests : public Test {
+protected:
+    ConstraintProfile profile;
+};
+
+TEST_F(ConstraintProfileTests, TopEntries_Empty) {
+    EXPECT_TRUE(profile.empty());
+    EXPECT_THAT(profile.topEntries(3), IsEmpty());
+}
+
+TEST_F(ConstraintProfileTests, TopEntries_SortedByTotalTime) {
+    profile.record("A", 1.0);
+    profile.record("B", 3.0);
+    profile.record("A", 1.5);
+    profile.record("C", 0.5);
+
+    EXPECT_THAT(profile.topEntries(3), ElementsAre(
+            ConstraintProfileEntry("B", 1, 3.0),
+            ConstraintProfileEntry("A", 2, 2.5),
+            ConstraintProfileEntry("C", 1, 0.5)));
+    EXPECT_THAT(profile.topEntries(3)[1].meanSeconds(), Eq(1.25));
+}
+
+TEST_F(ConstraintProfileTests, TopEntries_Truncated) {
+    profile.record("A", 1.0);
+    profile.record("B", 3.0);
+    profile.record("C", 0.5);
+
+    EXPECT_THAT(profile.topEntries(2), ElementsAre(
+            ConstraintProfileEntry("B", 1, 3.0),
+            ConstraintProfileEntry("A", 1, 1.0)));
+}
+
+}
@@ -13,6 +13,9 @@ public:
 
     MOCK_METHOD1(verifyConstraints, ConstraintsVerificationResult(const set<int>&));
     MOCK_METHOD0(verifyMultipleTestCasesConstraints, MultipleTestCasesConstraintsVerificationResult());
+    MOCK_CONST_METHOD0(subtaskIds, set<int>());
+    MOCK_METHOD0(satisfiedSubtaskIds, set<int>());
+    MOCK_CONST_METHOD0(profile, const ConstraintProfile*());
 };
 
 }
@@ -3,7 +3,9 @@
 #include "tcframe/verifier/Verifier.hpp"
 
 using ::testing::ElementsAre;
+using ::testing::Eq;
 using ::testing::IsEmpty;
+using ::testing::IsNull;
 using ::testing::Pair;
 using ::testing::Test;
 
@@ -67,6 +69,21 @@ TEST_F(VerifierTests, Verification_Invalid_SomeConstraintsInvalid) {
             Pair(-1, ElementsAre(constraint2.description()))));
 }
 
+TEST_F(VerifierTests, Verification_Profiled) {
+    ConstraintProfile profile;
+    Verifier profiledVerifier(constraintSuiteWithSubtasks, &profile);
+    profiledVerifier.verifyConstraints({1, 2, 3});
+    profiledVerifier.verifyConstraints({1, 2, 3});
+
+    vector<ConstraintProfileEntry> entries = profile.topEntries(10);
+    EXPECT_THAT(entries.size(), Eq(5u));
+    for (const ConstraintProfileEntry& entry : entries) {
+        EXPECT_THAT(entry.callsCount(), Eq(2));
+    }
+    EXPECT_THAT(profiledVerifier.profile(), Eq(&profile));
+    EXPECT_THAT(verifier.profile(), IsNull());
+}
+
 TEST_F(VerifierTests, Verification_WithSubtasks_Valid_AllConstraintsValid) {
     ConstraintsVerificationResult result = verifierWithSubtasks.verifyConstraints({1, 2, 3});
 
@@ -94,4 +111,85 @@ TEST_F(VerifierTests, Verification_WithSubtasks_Invalid_SomeConstraintsInvalid)
             Pair(2, ElementsAre(constraint4.description()))));
 }
 
+TEST_F(VerifierTests, Verification_WithSubtasks_RepeatedConstraintsEvaluatedOnce) {
+    int evaluationsCount = 0;
+    Constraint countedConstraint([&] {evaluationsCount++; return true;}, "1 <= N && N <= 10");
+    Verifier countingVerifier(ConstraintSuiteBuilder()
+            .newSubtask()
+            .addConstraint(countedConstraint)
+            .addConstraint(constraint1)
+            .newSubtask()
+            .addConstraint(countedConstraint)
+            .addConstraint(constraint2)
+            .newSubtask()
+            .addConstraint(countedConstraint)
+            .build());
+
+    ConstraintsVerificationResult result = countingVerifier.verifyConstraints({1, 2, 3});
+
+    EXPECT_TRUE(result.isValid());
+    EXPECT_THAT(evaluationsCount, Eq(1));
+}
+
+TEST_F(VerifierTests, Verification_WithSubtasks_NotAssignedSubtaskStopsAtFirstUnsatisfiedConstraint) {
+    int evaluationsCount = 0;
+    Constraint countedConstraint([&] {evaluationsCount++; return true;}, "1 <= N && N <= 10");
+    Verifier countingVerifier(ConstraintSuiteBuilder()
+            .newSubtask()
+            .addConstraint(constraint1)
+            .newSubtask()
+            .addConstraint(constraint2)
+            .addConstraint(constraint1)
+            .addConstraint(countedConstraint)
+            .build());
+    b1 = false;
+
+    ConstraintsVerificationResult result = countingVerifier.verifyConstraints({1});
+
+    EXPECT_FALSE(result.isValid());
+    EXPECT_THAT(result.satisfiedButNotAssignedSubtaskIds(), IsEmpty());
+    EXPECT_THAT(evaluationsCount, Eq(0));
+}
+
+TEST_F(VerifierTests, SatisfiedSubtaskIds) {
+    b4 = false;
+    EXPECT_THAT(verifierWithSubtasks.satisfiedSubtaskIds(), ElementsAre(1, 3));
+}
+
+TEST_F(VerifierTests, SatisfiedSubtaskIds_WithoutSubtasks) {
+    EXPECT_THAT(verifier.satisfiedSubtaskIds(), ElementsAre(-1));
+    b1 = false;
+    EXPECT_THAT(verifier.satisfiedSubtaskIds(), IsEmpty());
+}
+
+TEST_F(VerifierTests, Verification_Invalid_WithViolationDetails) {
+    vector<int> A = {1, 2, 3};
+    Verifier detailingVerifier(ConstraintSuiteBuilder()
+            .addConstraint(Constraint([=] {return eachElementBetween(A, 1, 2);}, "eachElementBetween(A, 1, 2)"))
+            .addConstraint(constraint1)
+            .build());
+    b1 = false;
+
+    ConstraintsVerificationResult result = detailingVerifier.verifyConstraints({-1});
+
+    EXPECT_THAT(result.unsatisfiedConstraintDescriptionsBySubtaskId(), ElementsAre(
+            Pair(-1, ElementsAre("eachElementBetween(A, 1, 2) (first violation at index 2)", constraint1.description()))));
+}
+
+TEST_F(VerifierTests, Verification_Invalid_WithViolationDetails_FirstViolation) {
+    vector<int> A = {1, 2, 3};
+    vector<int> B = {1, 2, 2, 3};
+    Verifier detailingVerifier(ConstraintSuiteBuilder()
+            .addConstraint(Constraint(
+                    [=] {return eachElementBetween(A, 1, 2) || eachElementBetween(B, 1, 2);},
+                    "eachElementBetween(A, 1, 2) || eachElementBetween(B, 1, 2)"))
+            .build());
+
+    ConstraintsVerificationResult result = detailingVerifier.verifyConstraints({-1});
+
+    EXPECT_THAT(result.unsatisfiedConstraintDescriptionsBySubtaskId(), ElementsAre(
+            Pair(-1, ElementsAre(
+                    "eachElementBetween(A, 1, 2) || eachElementBetween(B, 1, 2) (first violation at index 2)"))));
+}
+
 }